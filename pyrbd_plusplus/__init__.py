@@ -1,6 +1,6 @@
 from .evaluator import evaluate_availability
 from .datasets import *
-from .algorithms import minimalcuts_optimized, minimalpaths, minimalcuts
+from .algorithms import minimalcuts_optimized, minimalcuts_native, minimalpaths, minimalpaths_native, boundedpaths_native, minimalcuts
 from .utils import relabel_graph_A_dict
 
 
@@ -19,6 +19,9 @@ __all__ = [
     'save_availability',
     'minimalcuts',
     'minimalcuts_optimized',
+    'minimalcuts_native',
     'minimalpaths',
+    'minimalpaths_native',
+    'boundedpaths_native',
     'relabel_graph_A_dict',
     ]
\ No newline at end of file
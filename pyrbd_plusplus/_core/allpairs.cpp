@@ -0,0 +1,115 @@
+#include <pyrbd_plusplus/allpairs.hpp>
+#include <pyrbd_plusplus/enumeration.hpp>
+#include <stdexcept>
+#include <unordered_map>
+#include <omp.h>
+
+namespace pyrbdpp::allpairs
+{
+    Graph relabelGraph(const std::vector<Label> &nodes, const LabelEdges &edges)
+    {
+        // Map each label to its node ID
+        std::unordered_map<Label, NodeID> nodeIDOf;
+        nodeIDOf.reserve(nodes.size());
+        for (size_t i = 0; i < nodes.size(); ++i)
+        {
+            if (!nodeIDOf.emplace(nodes[i], static_cast<NodeID>(i + 1)).second)
+            {
+                throw std::invalid_argument("Duplicate node label " + std::to_string(nodes[i]));
+            }
+        }
+
+        auto nodeID = [&nodeIDOf](Label label)
+        {
+            auto it = nodeIDOf.find(label);
+            if (it == nodeIDOf.end())
+            {
+                throw std::invalid_argument("Edge with unknown node label " + std::to_string(label));
+            }
+            return it->second;
+        };
+
+        std::vector<std::pair<NodeID, NodeID>> relabeledEdges;
+        relabeledEdges.reserve(edges.size());
+        for (const auto &[u, v] : edges)
+        {
+            relabeledEdges.emplace_back(nodeID(u), nodeID(v));
+        }
+
+        return Graph::fromEdges(static_cast<int>(nodes.size()), relabeledEdges);
+    }
+
+    // Evaluate the pairs (src, t) for all later nodes t and write both triangles of the matrix
+    static void evalSource(const Graph &graph, const ProbabilityMap &probaMap, Engine engine, size_t order, NodeID src,
+                           AvailMatrix &matrix)
+    {
+        std::vector<NodeID> targets;
+        for (NodeID dst = src + 1; dst <= graph.size(); ++dst)
+        {
+            targets.push_back(dst);
+        }
+
+        // The path sets of the source are freed at the end of the function
+        std::vector<enumeration::PathSets> buckets = enumeration::minimalPathsFromSource(graph, src, targets);
+
+        for (size_t k = 0; k < targets.size(); ++k)
+        {
+            NodeID dst = targets[k];
+            const auto &pathSets = buckets[k];
+
+            // Disconnected pairs are never available
+            double availability = 0.0;
+            if (!pathSets.empty())
+            {
+                enumeration::MinCutSets minCutSets;
+                if (engine == Engine::MCS)
+                {
+                    minCutSets = enumeration::minimalCuts(pathSets, src, dst, order);
+                }
+                availability = selector::evalAvailWith(engine, src, dst, probaMap, pathSets, minCutSets);
+            }
+
+            matrix.values[(src - 1) * matrix.numNodes + (dst - 1)] = availability;
+            matrix.values[(dst - 1) * matrix.numNodes + (src - 1)] = availability;
+        }
+    }
+
+    AvailMatrix evalAvailMatrix(const std::vector<Label> &nodes, const LabelEdges &edges, const std::vector<double> &probabilities,
+                                Engine engine, bool parallel)
+    {
+        if (probabilities.size() != nodes.size())
+        {
+            throw std::invalid_argument("Expected " + std::to_string(nodes.size()) + " probabilities, got " + std::to_string(probabilities.size()));
+        }
+
+        // Relabel the nodes and build the probability map on the node IDs
+        Graph graph = relabelGraph(nodes, edges);
+        std::map<int, double> availMap;
+        for (size_t i = 0; i < probabilities.size(); ++i)
+        {
+            availMap[static_cast<int>(i + 1)] = probabilities[i];
+        }
+        ProbabilityMap probaMap(availMap);
+
+        // The diagonal is the availability of the node itself
+        AvailMatrix matrix;
+        matrix.numNodes = nodes.size();
+        matrix.values.assign(matrix.numNodes * matrix.numNodes, 0.0);
+        for (size_t i = 0; i < matrix.numNodes; ++i)
+        {
+            matrix.values[i * matrix.numNodes + i] = probabilities[i];
+        }
+
+        size_t order = enumeration::cutOrder(nodes.size());
+
+        // The early sources have the most pairs, the dynamic schedule balances them
+        #pragma omp parallel for schedule(dynamic) if (parallel)
+        for (NodeID src = 1; src <= graph.size(); ++src)
+        {
+            evalSource(graph, probaMap, engine, order, src, matrix);
+        }
+
+        return matrix;
+    }
+
+} // namespace pyrbdpp::allpairs
\ No newline at end of file
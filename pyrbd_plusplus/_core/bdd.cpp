@@ -0,0 +1,609 @@
+#include <pyrbd_plusplus/bdd.hpp>
+#include <pyrbd_plusplus/perf.hpp>
+#include <algorithm>
+#include <limits>
+#include <unordered_map>
+#include <omp.h>
+
+namespace pyrbdpp::bdd
+{
+    // Marks a node that is not a variable of the diagram
+    constexpr uint32_t NO_LEVEL = std::numeric_limits<uint32_t>::max();
+
+    // Hash of a frontier state
+    struct StateHash
+    {
+        size_t operator()(const std::vector<int> &state) const
+        {
+            size_t hash = state.size();
+            for (int label : state)
+            {
+                hash ^= std::hash<int>{}(label) + 0x9e3779b97f4a7c15ULL + (hash << 6) + (hash >> 2);
+            }
+            return hash;
+        }
+    };
+
+    // Hash of a decision node for the unique table
+    struct NodeHash
+    {
+        size_t operator()(const BddNode &node) const
+        {
+            uint64_t key = (static_cast<uint64_t>(node.level) << 40) ^ (static_cast<uint64_t>(node.low) << 20) ^ node.high;
+            return std::hash<uint64_t>{}(key);
+        }
+    };
+
+    struct NodeEqual
+    {
+        bool operator()(const BddNode &a, const BddNode &b) const
+        {
+            return a.level == b.level && a.low == b.low && a.high == b.high;
+        }
+    };
+
+    // Hash-consing of the nodes of one diagram, with the computed table of the OR operation
+    class Builder
+    {
+    public:
+        explicit Builder(uint32_t numLevels) : nodes_{{numLevels, FALSE_NODE, FALSE_NODE}, {numLevels, TRUE_NODE, TRUE_NODE}} {}
+
+        // Get the node (level, low, high), a node with equal children is its child
+        uint32_t make(uint32_t level, uint32_t low, uint32_t high)
+        {
+            if (low == high)
+            {
+                return low;
+            }
+            BddNode node{level, low, high};
+            auto [it, inserted] = unique_.emplace(node, static_cast<uint32_t>(nodes_.size()));
+            if (inserted)
+            {
+                nodes_.push_back(node);
+            }
+            return it->second;
+        }
+
+        // AND of the variables of the levels, sorted in ascending order
+        uint32_t chain(const std::vector<uint32_t> &levels)
+        {
+            uint32_t node = TRUE_NODE;
+            for (auto it = levels.rbegin(); it != levels.rend(); ++it)
+            {
+                node = make(*it, FALSE_NODE, node);
+            }
+            return node;
+        }
+
+        // Apply operation OR, the computed table keeps the result of every pair of operands
+        uint32_t orOf(uint32_t f, uint32_t g)
+        {
+            if (f == TRUE_NODE || g == TRUE_NODE)
+            {
+                return TRUE_NODE;
+            }
+            if (f == FALSE_NODE || f == g)
+            {
+                return g;
+            }
+            if (g == FALSE_NODE)
+            {
+                return f;
+            }
+            if (f > g)
+            {
+                std::swap(f, g);
+            }
+
+            uint64_t key = (static_cast<uint64_t>(f) << 32) | g;
+            auto it = computed_.find(key);
+            if (it != computed_.end())
+            {
+                return it->second;
+            }
+            ++applySteps_;
+
+            // Shannon expansion on the top variable, the nodes are copied since make() may grow the vector
+            BddNode a = nodes_[f];
+            BddNode b = nodes_[g];
+            uint32_t level = std::min(a.level, b.level);
+            uint32_t low = orOf(a.level == level ? a.low : f, b.level == level ? b.low : g);
+            uint32_t high = orOf(a.level == level ? a.high : f, b.level == level ? b.high : g);
+            uint32_t result = make(level, low, high);
+            computed_.emplace(key, result);
+            return result;
+        }
+
+        size_t applySteps() const { return applySteps_; }
+
+        // Keep the nodes reachable from the root, renumbered in ascending order so the children stay first
+        Diagram finish(NodeID src, NodeID dst, std::vector<NodeID> order, uint32_t root)
+        {
+            std::vector<char> reachable(nodes_.size(), 0);
+            reachable[root] = 1;
+            for (size_t i = root; i > TRUE_NODE; --i)
+            {
+                if (reachable[i])
+                {
+                    reachable[nodes_[i].low] = 1;
+                    reachable[nodes_[i].high] = 1;
+                }
+            }
+
+            Diagram diagram;
+            diagram.src = src;
+            diagram.dst = dst;
+            std::vector<uint32_t> newIndex(nodes_.size(), 0);
+            std::vector<size_t> width(order.size(), 0);
+            diagram.nodes = {nodes_[FALSE_NODE], nodes_[TRUE_NODE]};
+            newIndex[TRUE_NODE] = TRUE_NODE;
+            for (size_t i = TRUE_NODE + 1; i < nodes_.size(); ++i)
+            {
+                if (reachable[i])
+                {
+                    const BddNode &node = nodes_[i];
+                    newIndex[i] = static_cast<uint32_t>(diagram.nodes.size());
+                    diagram.nodes.push_back({node.level, newIndex[node.low], newIndex[node.high]});
+                    diagram.maxWidth = std::max(diagram.maxWidth, ++width[node.level]);
+                }
+            }
+            diagram.root = newIndex[root];
+            diagram.order = std::move(order);
+            return diagram;
+        }
+
+    private:
+        std::vector<BddNode> nodes_;
+        std::unordered_map<BddNode, uint32_t, NodeHash, NodeEqual> unique_;
+        std::unordered_map<uint64_t, uint32_t> computed_;
+        size_t applySteps_ = 0;
+    };
+
+    // Breadth-first order from the source over an adjacency given as a callback
+    template <typename ForNeighbors>
+    static std::vector<NodeID> breadthFirst(NodeID src, size_t numIds, ForNeighbors forNeighbors)
+    {
+        std::vector<char> seen(numIds, 0);
+        std::vector<NodeID> order{src};
+        seen[src] = 1;
+        for (size_t head = 0; head < order.size(); ++head)
+        {
+            forNeighbors(order[head], [&](NodeID neighbor)
+                         {
+                if (!seen[neighbor])
+                {
+                    seen[neighbor] = 1;
+                    order.push_back(neighbor);
+                } });
+        }
+        return order;
+    }
+
+    // Sort the BFS order by decreasing weight, the BFS order breaks the ties
+    template <typename Weight>
+    static void sortByWeight(std::vector<NodeID> &order, Weight weight)
+    {
+        std::stable_sort(order.begin(), order.end(), [&](NodeID a, NodeID b)
+                         { return weight(a) > weight(b); });
+    }
+
+    double Diagram::availability(const ProbabilityMap &probaMap) const
+    {
+        std::vector<double> probability(nodes.size());
+        probability[FALSE_NODE] = 0.0;
+        probability[TRUE_NODE] = 1.0;
+        for (size_t i = TRUE_NODE + 1; i < nodes.size(); ++i)
+        {
+            const BddNode &node = nodes[i];
+            double p = probaMap[order[node.level]];
+            probability[i] = p * probability[node.high] + (1.0 - p) * probability[node.low];
+        }
+        return probability[root];
+    }
+
+    std::vector<NodeID> variableOrder(const PathSets &pathSets, NodeID src, Ordering ordering)
+    {
+        if (pathSets.empty())
+        {
+            return {};
+        }
+
+        // The consecutive nodes of the paths are the edges used by the paths
+        NodeID maxId = src;
+        for (const auto &path : pathSets)
+        {
+            maxId = std::max(maxId, *std::max_element(path.begin(), path.end()));
+        }
+        std::vector<std::vector<NodeID>> adjacency(maxId + 1);
+        std::vector<size_t> count(maxId + 1, 0);
+        for (const auto &path : pathSets)
+        {
+            for (size_t k = 0; k < path.size(); ++k)
+            {
+                ++count[path[k]];
+                if (k + 1 < path.size())
+                {
+                    adjacency[path[k]].push_back(path[k + 1]);
+                    adjacency[path[k + 1]].push_back(path[k]);
+                }
+            }
+        }
+
+        std::vector<NodeID> order = breadthFirst(src, maxId + 1, [&](NodeID node, auto visit)
+                                                 { for (NodeID neighbor : adjacency[node]) visit(neighbor); });
+        if (ordering == Ordering::Frequency)
+        {
+            sortByWeight(order, [&](NodeID node)
+                         { return count[node]; });
+        }
+        return order;
+    }
+
+    std::vector<NodeID> variableOrder(const Graph &graph, NodeID src, Ordering ordering)
+    {
+        auto forNeighbors = [&](NodeID node, auto visit)
+        { for (const NodeID *it = graph.begin(node); it != graph.end(node); ++it) visit(*it); };
+
+        // Restart from the last node of the BFS until the depth stops growing, the BFS from this pseudo-peripheral
+        // node sweeps the graph in layers, so the frontier stays as narrow as a layer
+        std::vector<NodeID> order = breadthFirst(src, graph.size() + 1, forNeighbors);
+        size_t depth = 0;
+        for (int round = 0; round < 4; ++round)
+        {
+            std::vector<NodeID> sweep = breadthFirst(order.back(), graph.size() + 1, forNeighbors);
+            std::vector<size_t> layer(graph.size() + 1, 0);
+            for (NodeID node : sweep)
+            {
+                forNeighbors(node, [&](NodeID neighbor)
+                             { if (neighbor != sweep.front() && layer[neighbor] == 0) layer[neighbor] = layer[node] + 1; });
+            }
+            if (layer[sweep.back()] <= depth)
+            {
+                break;
+            }
+            depth = layer[sweep.back()];
+            order = std::move(sweep);
+        }
+        if (ordering == Ordering::Frequency)
+        {
+            sortByWeight(order, [&](NodeID node)
+                         { return graph.end(node) - graph.begin(node); });
+        }
+        return order;
+    }
+
+    Diagram fromPathSets(const PathSets &pathSets, NodeID src, NodeID dst, Ordering ordering)
+    {
+        std::vector<NodeID> order = variableOrder(pathSets, src, ordering);
+        Builder builder(static_cast<uint32_t>(order.size()));
+
+        std::vector<uint32_t> levelOf;
+        for (size_t level = 0; level < order.size(); ++level)
+        {
+            levelOf.resize(std::max<size_t>(levelOf.size(), order[level] + 1), NO_LEVEL);
+            levelOf[order[level]] = static_cast<uint32_t>(level);
+        }
+
+        // OR of the AND chains of the path sets
+        uint32_t root = FALSE_NODE;
+        std::vector<uint32_t> levels;
+        for (const auto &path : pathSets)
+        {
+            levels.clear();
+            for (NodeID node : path)
+            {
+                levels.push_back(levelOf[node]);
+            }
+            std::sort(levels.begin(), levels.end());
+            levels.erase(std::unique(levels.begin(), levels.end()), levels.end());
+            root = builder.orOf(root, builder.chain(levels));
+        }
+
+        stats::add(&stats::PairStats::decompositions, builder.applySteps());
+        return builder.finish(src, dst, std::move(order), root);
+    }
+
+    Diagram fromGraph(const Graph &graph, NodeID src, NodeID dst, Ordering ordering)
+    {
+        // Step 1: Order the nodes connected to the source
+        std::vector<NodeID> order = variableOrder(graph, src, ordering);
+        uint32_t numLevels = static_cast<uint32_t>(order.size());
+        Builder builder(numLevels);
+
+        std::vector<uint32_t> levelOf(graph.size() + 1, NO_LEVEL);
+        for (uint32_t level = 0; level < numLevels; ++level)
+        {
+            levelOf[order[level]] = level;
+        }
+        if (levelOf[dst] == NO_LEVEL)
+        {
+            return builder.finish(src, dst, std::move(order), FALSE_NODE);
+        }
+
+        // A decided node stays on the frontier until its last neighbor is decided
+        std::vector<uint32_t> lastLevel(graph.size() + 1, 0);
+        for (NodeID node : order)
+        {
+            for (const NodeID *it = graph.begin(node); it != graph.end(node); ++it)
+            {
+                lastLevel[node] = std::max(lastLevel[node], levelOf[*it]);
+            }
+        }
+
+        // Step 2: Expand the states level by level, a state is the frontier labels followed by the labels of src and dst
+        // The children are indices of the next level, or the terminals encoded as -1 (false) and -2 (true)
+        constexpr int64_t FALSE_CHILD = -1;
+        constexpr int64_t TRUE_CHILD = -2;
+        std::vector<std::vector<std::pair<int64_t, int64_t>>> children(numLevels);
+        std::vector<std::vector<int>> states{{0, 0}};
+        std::vector<NodeID> frontier;
+        std::vector<int> positionOf(graph.size() + 1, -1);
+
+        for (uint32_t level = 0; level < numLevels; ++level)
+        {
+            NodeID node = order[level];
+            std::vector<NodeID> nextFrontier;
+            for (NodeID other : frontier)
+            {
+                if (lastLevel[other] > level)
+                {
+                    nextFrontier.push_back(other);
+                }
+            }
+            if (lastLevel[node] > level)
+            {
+                nextFrontier.push_back(node);
+            }
+            for (size_t k = 0; k < frontier.size(); ++k)
+            {
+                positionOf[frontier[k]] = static_cast<int>(k);
+            }
+
+            std::vector<std::vector<int>> nextStates;
+            std::unordered_map<std::vector<int>, int64_t, StateHash> nextIndex;
+            std::vector<int> labels(frontier.size() + 1);
+            std::vector<int> renamed;
+
+            auto transition = [&](const std::vector<int> &state, bool works) -> int64_t
+            {
+                int srcLabel = state[state.size() - 2];
+                int dstLabel = state[state.size() - 1];
+                if (!works && (node == src || node == dst))
+                {
+                    return FALSE_CHILD;
+                }
+
+                // The node is the last entry of the labels, a working node merges the components of its neighbors
+                std::copy(state.begin(), state.begin() + frontier.size(), labels.begin());
+                int nodeLabel = 0;
+                if (works)
+                {
+                    nodeLabel = static_cast<int>(frontier.size()) + 1;
+                    for (const NodeID *it = graph.begin(node); it != graph.end(node); ++it)
+                    {
+                        int position = levelOf[*it] < level ? positionOf[*it] : -1;
+                        int merged = position >= 0 ? labels[position] : 0;
+                        if (merged == 0 || merged == nodeLabel)
+                        {
+                            continue;
+                        }
+                        std::replace(labels.begin(), labels.begin() + frontier.size(), merged, nodeLabel);
+                        srcLabel = srcLabel == merged ? nodeLabel : srcLabel;
+                        dstLabel = dstLabel == merged ? nodeLabel : dstLabel;
+                    }
+                    srcLabel = node == src ? nodeLabel : srcLabel;
+                    dstLabel = node == dst ? nodeLabel : dstLabel;
+                }
+                labels[frontier.size()] = nodeLabel;
+                if (srcLabel != 0 && srcLabel == dstLabel)
+                {
+                    return TRUE_CHILD;
+                }
+
+                // Relabel the next frontier by first appearance, a component of src or dst may not leave it
+                renamed.assign(frontier.size() + 2, 0);
+                std::vector<int> next;
+                next.reserve(nextFrontier.size() + 2);
+                int numLabels = 0;
+                for (NodeID other : nextFrontier)
+                {
+                    int label = other == node ? nodeLabel : labels[positionOf[other]];
+                    if (label != 0 && renamed[label] == 0)
+                    {
+                        renamed[label] = ++numLabels;
+                    }
+                    next.push_back(label != 0 ? renamed[label] : 0);
+                }
+                if ((srcLabel != 0 && renamed[srcLabel] == 0) || (dstLabel != 0 && renamed[dstLabel] == 0))
+                {
+                    return FALSE_CHILD;
+                }
+                next.push_back(srcLabel != 0 ? renamed[srcLabel] : 0);
+                next.push_back(dstLabel != 0 ? renamed[dstLabel] : 0);
+
+                auto [it, inserted] = nextIndex.emplace(next, static_cast<int64_t>(nextStates.size()));
+                if (inserted)
+                {
+                    nextStates.push_back(std::move(next));
+                }
+                return it->second;
+            };
+
+            children[level].reserve(states.size());
+            for (const auto &state : states)
+            {
+                int64_t low = transition(state, false);
+                int64_t high = transition(state, true);
+                children[level].emplace_back(low, high);
+            }
+
+            for (NodeID other : frontier)
+            {
+                positionOf[other] = -1;
+            }
+            frontier = std::move(nextFrontier);
+            states = std::move(nextStates);
+        }
+
+        // Step 3: Reduce the levels bottom-up through the unique table
+        std::vector<uint32_t> below;
+        for (uint32_t level = numLevels; level-- > 0;)
+        {
+            auto resolve = [&](int64_t child)
+            {
+                return child == FALSE_CHILD ? FALSE_NODE : child == TRUE_CHILD ? TRUE_NODE : below[child];
+            };
+            std::vector<uint32_t> current(children[level].size());
+            for (size_t k = 0; k < children[level].size(); ++k)
+            {
+                current[k] = builder.make(level, resolve(children[level][k].first), resolve(children[level][k].second));
+            }
+            below = std::move(current);
+            children[level].clear();
+            children[level].shrink_to_fit();
+        }
+
+        return builder.finish(src, dst, std::move(order), below.empty() ? FALSE_NODE : below[0]);
+    }
+
+    // Evaluate a compiled diagram and record its counters in the active stats record
+    static double evaluate(const Diagram &diagram, const ProbabilityMap &probaMap)
+    {
+        stats::add(&stats::PairStats::terms, diagram.size());
+        stats::raise(&stats::PairStats::queueHighWater, diagram.maxWidth);
+        stats::add(&stats::PairStats::bytesAllocated, diagram.size() * sizeof(BddNode));
+
+        stats::ScopedTimer timer(&stats::PairStats::evalTime);
+        perf::ScopedCounters counters(perf::Stage::Eval);
+        return diagram.availability(probaMap);
+    }
+
+    double evalAvail(NodeID src, NodeID dst, const ProbabilityMap &probaMap, const PathSets &pathSets, stats::PairStats *pairStats)
+    {
+        // Collect the stats of the pair if requested
+        stats::Scope scope(pairStats);
+        if (pairStats)
+        {
+            pairStats->src = src;
+            pairStats->dst = dst;
+        }
+
+        // Compile the diagram of the path sets
+        Diagram diagram;
+        {
+            stats::ScopedTimer timer(&stats::PairStats::rcTime);
+            perf::ScopedCounters counters(perf::Stage::RC);
+            diagram = fromPathSets(pathSets, src, dst);
+        }
+
+        // Compute the availability
+        return evaluate(diagram, probaMap);
+    }
+
+    std::vector<AvailTriple> evalAvailTopo(const NodePairs &nodePairs, const ProbabilityMap &probaMap, const std::vector<PathSets> &pathsetsList,
+                                           std::vector<stats::PairStats> *statsList)
+    {
+        std::vector<AvailTriple> availList;
+
+        // Prepare one stats record per pair if requested
+        if (statsList)
+        {
+            statsList->assign(nodePairs.size(), {});
+        }
+
+        for (size_t i = 0; i < nodePairs.size(); ++i)
+        {
+            const auto &[src, dst] = nodePairs[i];
+            double availability = evalAvail(src, dst, probaMap, pathsetsList[i], statsList ? &(*statsList)[i] : nullptr);
+            availList.emplace_back(src, dst, availability);
+        }
+
+        return availList;
+    }
+
+    std::vector<AvailTriple> evalAvailTopoParallel(const NodePairs &nodePairs, const ProbabilityMap &probaMap, const std::vector<PathSets> &pathsetsList,
+                                                   std::vector<stats::PairStats> *statsList)
+    {
+        std::vector<AvailTriple> availList(nodePairs.size());
+
+        // Prepare one stats record per pair if requested
+        if (statsList)
+        {
+            statsList->assign(nodePairs.size(), {});
+        }
+
+        #pragma omp parallel for schedule(dynamic)
+        for (size_t i = 0; i < nodePairs.size(); ++i)
+        {
+            const auto &[src, dst] = nodePairs[i];
+            double availability = evalAvail(src, dst, probaMap, pathsetsList[i], statsList ? &(*statsList)[i] : nullptr);
+            availList[i] = std::make_tuple(src, dst, availability);
+        }
+
+        return availList;
+    }
+
+    std::vector<Diagram> compileTopo(const Graph &graph, const NodePairs &nodePairs, Ordering ordering, bool parallel)
+    {
+        std::vector<Diagram> diagrams(nodePairs.size());
+
+        #pragma omp parallel for schedule(dynamic) if (parallel)
+        for (size_t i = 0; i < nodePairs.size(); ++i)
+        {
+            diagrams[i] = fromGraph(graph, nodePairs[i].first, nodePairs[i].second, ordering);
+        }
+
+        return diagrams;
+    }
+
+    std::vector<AvailTriple> evalDiagrams(const std::vector<Diagram> &diagrams, const ProbabilityMap &probaMap, bool parallel)
+    {
+        std::vector<AvailTriple> availList(diagrams.size());
+
+        #pragma omp parallel for schedule(dynamic) if (parallel)
+        for (size_t i = 0; i < diagrams.size(); ++i)
+        {
+            const Diagram &diagram = diagrams[i];
+            availList[i] = std::make_tuple(diagram.src, diagram.dst, diagram.availability(probaMap));
+        }
+
+        return availList;
+    }
+
+    std::vector<AvailTriple> evalAvailTopoGraph(const Graph &graph, const NodePairs &nodePairs, const ProbabilityMap &probaMap,
+                                                Ordering ordering, bool parallel, std::vector<stats::PairStats> *statsList)
+    {
+        std::vector<AvailTriple> availList(nodePairs.size());
+
+        // Prepare one stats record per pair if requested
+        if (statsList)
+        {
+            statsList->assign(nodePairs.size(), {});
+        }
+
+        #pragma omp parallel for schedule(dynamic) if (parallel)
+        for (size_t i = 0; i < nodePairs.size(); ++i)
+        {
+            const auto &[src, dst] = nodePairs[i];
+            stats::PairStats *pairStats = statsList ? &(*statsList)[i] : nullptr;
+            stats::Scope scope(pairStats);
+            if (pairStats)
+            {
+                pairStats->src = src;
+                pairStats->dst = dst;
+            }
+
+            // Compile the diagram from the graph, no path set is enumerated
+            Diagram diagram;
+            {
+                stats::ScopedTimer timer(&stats::PairStats::rcTime);
+                perf::ScopedCounters counters(perf::Stage::RC);
+                diagram = fromGraph(graph, src, dst, ordering);
+            }
+            availList[i] = std::make_tuple(src, dst, evaluate(diagram, probaMap));
+        }
+
+        return availList;
+    }
+
+} // namespace pyrbdpp::bdd
\ No newline at end of file
@@ -0,0 +1,251 @@
+#include "topology.hpp"
+#include <benchmark/benchmark.h>
+#include <pyrbd_plusplus/enumeration.hpp>
+#include <pyrbd_plusplus/graph.hpp>
+#include <pyrbd_plusplus/mcs.hpp>
+#include <pyrbd_plusplus/pathset.hpp>
+#include <pyrbd_plusplus/sdp.hpp>
+#include <pyrbd_plusplus/utils.hpp>
+#include <algorithm>
+#include <cstdlib>
+#include <filesystem>
+#include <iostream>
+#include <iterator>
+#include <map>
+#include <memory>
+#include <omp.h>
+
+using namespace pyrbdpp;
+using namespace pyrbdpp::bench;
+
+namespace
+{
+    // Maximal order of the minimal cut sets, keeps the cut set enumeration of the larger topologies short
+    constexpr size_t MAX_CUT_ORDER = 4;
+
+    // Thread counts of the parallel benchmarks
+    const std::vector<int> THREAD_COUNTS = {1, 2, 4, 8};
+
+    /**
+     * @brief Precomputed inputs of all stages for the benchmark pair of a topology
+     */
+    struct Case
+    {
+        Topology topology;
+        NodeID src = 0;
+        NodeID dst = 0;
+        std::unique_ptr<ProbabilityMap> probaMap;
+        sdp::PathSets pathSets;
+        sdp::PathSets sortedPathSets;
+        mcs::MinCutSets minCutSets;
+        std::vector<sdp::SDPSets> sdpSets;
+        std::vector<sdp::SDPSets> decomposeInputs; // the absorbed SDP sets of toSDPSet() that need a decomposition
+    };
+
+    std::shared_ptr<Case> makeCase(Topology topology)
+    {
+        auto c = std::make_shared<Case>();
+        std::tie(c->src, c->dst) = farthestPair(topology);
+
+        // Uniform availability of 0.9 for every node
+        std::map<int, double> probabilities;
+        for (int node = 1; node <= topology.numNodes; ++node)
+        {
+            probabilities[node] = 0.9;
+        }
+        c->probaMap = std::make_unique<ProbabilityMap>(probabilities);
+
+        // Enumerate the sets with the library, the same path and cut sets as the Python pipeline
+        Graph graph = Graph::fromEdges(topology.numNodes, topology.edges);
+        c->pathSets = enumeration::minimalPaths(graph, c->src, c->dst);
+        c->sortedPathSets = sdp::sortPathSet(c->pathSets);
+        size_t order = std::min<size_t>(MAX_CUT_ORDER, enumeration::cutOrder(topology.numNodes));
+        c->minCutSets = enumeration::minimalCuts(c->pathSets, c->src, c->dst, order);
+        c->sdpSets = sdp::toSDPSet(c->src, c->dst, c->pathSets);
+
+        // Rebuild the inputs of decomposeSDPSet() the same way toSDPSet() does
+        const auto &sorted = c->sortedPathSets;
+        for (size_t i = 1; i < sorted.size(); ++i)
+        {
+            sdp::SDPSets resultSDPs = {{false, sorted[i]}};
+            for (size_t j = 0; j < i; ++j)
+            {
+                Set RC;
+                std::set_difference(sorted[j].begin(), sorted[j].end(), sorted[i].begin(), sorted[i].end(),
+                                    std::back_inserter(RC));
+                if (!RC.empty())
+                {
+                    resultSDPs.emplace_back(true, std::move(RC));
+                }
+            }
+            resultSDPs = sdp::absorbSDPSet(std::move(resultSDPs));
+            if (utils::hasCommonElement(resultSDPs))
+            {
+                c->decomposeInputs.push_back(std::move(resultSDPs));
+            }
+        }
+
+        c->topology = std::move(topology);
+        return c;
+    }
+
+    // Directory of the exported topologies, can be overwritten with the environment variable PYRBD_TOPOLOGY_DIR
+    std::string topologyDir()
+    {
+        if (const char *dir = std::getenv("PYRBD_TOPOLOGY_DIR"))
+        {
+            return dir;
+        }
+        return PYRBD_TOPOLOGY_DIR;
+    }
+
+    std::vector<std::shared_ptr<Case>> makeCases()
+    {
+        std::vector<Topology> topologies;
+        for (int n : {8, 16, 32, 64})
+        {
+            topologies.push_back(ring(n));
+        }
+        for (int k : {3, 4, 5})
+        {
+            topologies.push_back(grid(k, k));
+        }
+        for (int k : {3, 4})
+        {
+            topologies.push_back(grid(k, k, true));
+        }
+        for (int n : {15, 20, 25})
+        {
+            topologies.push_back(randomGeometric(n, 0.4, 1));
+            topologies.push_back(waxman(n, 0.6, 0.6, 1));
+        }
+
+        // Bundled SNDlib topologies exported by export_topology.py
+        std::filesystem::path dir = topologyDir();
+        for (const std::string name : {"Germany_17"})
+        {
+            std::filesystem::path file = dir / name / ("Edges_" + name + ".txt");
+            if (!std::filesystem::exists(file))
+            {
+                std::cerr << "Skipping " << name << ": " << file << " not found, run export_topology.py first" << std::endl;
+                continue;
+            }
+            Topology topology = readEdgeList(file.string());
+            topology.name = name;
+            topologies.push_back(std::move(topology));
+        }
+
+        std::vector<std::shared_ptr<Case>> cases;
+        for (auto &topology : topologies)
+        {
+            cases.push_back(makeCase(std::move(topology)));
+        }
+        return cases;
+    }
+
+    void setCounters(benchmark::State &state, const Case &c)
+    {
+        state.SetLabel(c.topology.name);
+        state.counters["nodes"] = c.topology.numNodes;
+        state.counters["edges"] = static_cast<double>(c.topology.edges.size());
+        state.counters["paths"] = static_cast<double>(c.pathSets.size());
+        state.counters["cuts"] = static_cast<double>(c.minCutSets.size() - 2);
+        state.counters["terms"] = static_cast<double>(c.sdpSets.size());
+    }
+
+    void registerCase(const std::shared_ptr<Case> &c)
+    {
+        std::string suffix = "/" + c->topology.name + "/" + std::to_string(c->topology.numNodes);
+
+        benchmark::RegisterBenchmark(("sortPathSet" + suffix).c_str(), [c](benchmark::State &state)
+                                     {
+            for (auto _ : state)
+            {
+                benchmark::DoNotOptimize(sdp::sortPathSet(c->pathSets));
+            }
+            setCounters(state, *c); });
+
+        benchmark::RegisterBenchmark(("toSDPSet" + suffix).c_str(), [c](benchmark::State &state)
+                                     {
+            for (auto _ : state)
+            {
+                benchmark::DoNotOptimize(sdp::toSDPSet(c->src, c->dst, c->pathSets));
+            }
+            setCounters(state, *c); });
+
+        auto parallel = benchmark::RegisterBenchmark(("toSDPSetParallel" + suffix).c_str(), [c](benchmark::State &state)
+                                                     {
+            int previous = omp_get_max_threads();
+            omp_set_num_threads(static_cast<int>(state.range(0)));
+            for (auto _ : state)
+            {
+                benchmark::DoNotOptimize(sdp::toSDPSetParallel(c->src, c->dst, c->pathSets));
+            }
+            omp_set_num_threads(previous);
+            setCounters(state, *c);
+            state.counters["threads"] = static_cast<double>(state.range(0)); });
+        parallel->ArgName("threads")->UseRealTime();
+        for (int threads : THREAD_COUNTS)
+        {
+            parallel->Arg(threads);
+        }
+
+        if (!c->decomposeInputs.empty())
+        {
+            benchmark::RegisterBenchmark(("decomposeSDPSet" + suffix).c_str(), [c](benchmark::State &state)
+                                         {
+                for (auto _ : state)
+                {
+                    for (const auto &input : c->decomposeInputs)
+                    {
+                        benchmark::DoNotOptimize(sdp::decomposeSDPSet(input));
+                    }
+                }
+                setCounters(state, *c);
+                state.counters["decompositions"] = static_cast<double>(c->decomposeInputs.size()); });
+        }
+
+        benchmark::RegisterBenchmark(("SDPSetToAvail" + suffix).c_str(), [c](benchmark::State &state)
+                                     {
+            for (auto _ : state)
+            {
+                benchmark::DoNotOptimize(sdp::SDPSetToAvail(*c->probaMap, c->sdpSets));
+            }
+            setCounters(state, *c); });
+
+        benchmark::RegisterBenchmark(("mcs::toProbaSet" + suffix).c_str(), [c](benchmark::State &state)
+                                     {
+            for (auto _ : state)
+            {
+                benchmark::DoNotOptimize(mcs::toProbaSet(c->src, c->dst, c->minCutSets));
+            }
+            setCounters(state, *c); });
+
+        benchmark::RegisterBenchmark(("pathset::toProbaSet" + suffix).c_str(), [c](benchmark::State &state)
+                                     {
+            for (auto _ : state)
+            {
+                benchmark::DoNotOptimize(pathset::toProbaSet(c->src, c->dst, c->pathSets));
+            }
+            setCounters(state, *c); });
+    }
+} // namespace
+
+int main(int argc, char **argv)
+{
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv))
+    {
+        return 1;
+    }
+
+    // Prepare the inputs once, the benchmarks only measure the stages
+    for (const auto &c : makeCases())
+    {
+        registerCase(c);
+    }
+
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,42 @@
+"""Export a bundled topology pickle to the edge list format read by the native benchmarks.
+
+Usage (from the project root):
+    python pyrbd_plusplus/_core/benchmarks/export_topology.py topologies/Germany_17 Germany_17
+
+The nodes are relabelled to 1..n with relabel_graph_A_dict(), the same labels the C++ core sees,
+and the edge list is written to <directory>/Edges_<topology>.txt.
+"""
+
+import argparse
+import os
+
+from pyrbd_plusplus import read_graph, relabel_graph_A_dict
+
+
+def write_edge_list(G, file_path, title):
+    """Write the graph as '# comments', 'num_nodes num_edges' and one 'u v weight' line per edge."""
+    G_relabel, _, relabel_mapping = relabel_graph_A_dict(G, {})
+    edges = sorted((min(u, v), max(u, v), data.get('weight', 1.0)) for u, v, data in G_relabel.edges(data=True))
+
+    with open(file_path, "w") as handle:
+        handle.write(f"# {title}: {G_relabel.number_of_nodes()} nodes, {len(edges)} edges\n")
+        handle.write("# node labels: " + " ".join(f"{node}={label}" for node, label in relabel_mapping.items()) + "\n")
+        handle.write(f"{G_relabel.number_of_nodes()} {len(edges)}\n")
+        for u, v, weight in edges:
+            handle.write(f"{u} {v} {weight}\n")
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Export a topology pickle to an edge list for the native benchmarks.")
+    parser.add_argument("directory", help="directory containing Pickle_<topology>.pickle")
+    parser.add_argument("topology", help="name of the topology, e.g. Germany_17")
+    args = parser.parse_args()
+
+    G, _, _ = read_graph(args.directory, args.topology)
+    file_path = os.path.join(args.directory, "Edges_" + args.topology + ".txt")
+    write_edge_list(G, file_path, args.topology)
+    print(f"Exported {args.topology} to {file_path}")
+
+
+if __name__ == "__main__":
+    main()
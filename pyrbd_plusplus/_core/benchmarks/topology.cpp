@@ -0,0 +1,257 @@
+#include "topology.hpp"
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <limits>
+#include <queue>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+
+namespace pyrbdpp::bench
+{
+    namespace
+    {
+        using Point = std::pair<double, double>;
+
+        double distance(const Point &a, const Point &b)
+        {
+            return std::hypot(a.first - b.first, a.second - b.second);
+        }
+
+        std::vector<Point> randomPoints(int n, std::mt19937_64 &rng)
+        {
+            std::uniform_real_distribution<double> uniform(0.0, 1.0);
+            std::vector<Point> points(n + 1);
+            for (int i = 1; i <= n; ++i)
+            {
+                points[i] = {uniform(rng), uniform(rng)};
+            }
+            return points;
+        }
+
+        // Label the connected components, returns the number of components
+        int components(const Topology &topology, std::vector<int> &label)
+        {
+            Adjacency adj = adjacency(topology);
+            label.assign(topology.numNodes + 1, -1);
+            int count = 0;
+            for (int start = 1; start <= topology.numNodes; ++start)
+            {
+                if (label[start] >= 0)
+                {
+                    continue;
+                }
+                std::queue<NodeID> queue;
+                queue.push(start);
+                label[start] = count;
+                while (!queue.empty())
+                {
+                    NodeID node = queue.front();
+                    queue.pop();
+                    for (NodeID next : adj[node])
+                    {
+                        if (label[next] < 0)
+                        {
+                            label[next] = count;
+                            queue.push(next);
+                        }
+                    }
+                }
+                ++count;
+            }
+            return count;
+        }
+
+        // Join the components with the shortest edge between the component of node 1 and any other component
+        void connect(Topology &topology, const std::vector<Point> &points)
+        {
+            std::vector<int> label;
+            while (components(topology, label) > 1)
+            {
+                double best = std::numeric_limits<double>::infinity();
+                std::pair<NodeID, NodeID> edge;
+                for (int u = 1; u <= topology.numNodes; ++u)
+                {
+                    for (int v = 1; v <= topology.numNodes; ++v)
+                    {
+                        if (label[u] == label[1] && label[v] != label[1] && distance(points[u], points[v]) < best)
+                        {
+                            best = distance(points[u], points[v]);
+                            edge = {std::min(u, v), std::max(u, v)};
+                        }
+                    }
+                }
+                topology.edges.push_back(edge);
+            }
+        }
+    } // namespace
+
+    Topology ring(int n)
+    {
+        Topology topology{"ring", n, {}};
+        for (int i = 1; i <= n; ++i)
+        {
+            int j = i % n + 1;
+            topology.edges.emplace_back(std::min(i, j), std::max(i, j));
+        }
+        return topology;
+    }
+
+    Topology grid(int rows, int cols, bool torus)
+    {
+        Topology topology{torus ? "torus" : "grid", rows * cols, {}};
+        auto id = [cols](int r, int c) { return r * cols + c + 1; };
+
+        for (int r = 0; r < rows; ++r)
+        {
+            for (int c = 0; c < cols; ++c)
+            {
+                // Right and down neighbors, wrapped around for the torus
+                if (c + 1 < cols || (torus && cols > 2))
+                {
+                    topology.edges.emplace_back(id(r, c), id(r, (c + 1) % cols));
+                }
+                if (r + 1 < rows || (torus && rows > 2))
+                {
+                    topology.edges.emplace_back(id(r, c), id((r + 1) % rows, c));
+                }
+            }
+        }
+        return topology;
+    }
+
+    Topology randomGeometric(int n, double radius, uint64_t seed)
+    {
+        std::mt19937_64 rng(seed);
+        std::vector<Point> points = randomPoints(n, rng);
+
+        Topology topology{"geometric", n, {}};
+        for (int u = 1; u <= n; ++u)
+        {
+            for (int v = u + 1; v <= n; ++v)
+            {
+                if (distance(points[u], points[v]) < radius)
+                {
+                    topology.edges.emplace_back(u, v);
+                }
+            }
+        }
+        connect(topology, points);
+        return topology;
+    }
+
+    Topology waxman(int n, double alpha, double beta, uint64_t seed)
+    {
+        std::mt19937_64 rng(seed);
+        std::vector<Point> points = randomPoints(n, rng);
+        std::uniform_real_distribution<double> uniform(0.0, 1.0);
+
+        // Largest distance between two nodes
+        double maxDistance = 0.0;
+        for (int u = 1; u <= n; ++u)
+        {
+            for (int v = u + 1; v <= n; ++v)
+            {
+                maxDistance = std::max(maxDistance, distance(points[u], points[v]));
+            }
+        }
+
+        Topology topology{"waxman", n, {}};
+        for (int u = 1; u <= n; ++u)
+        {
+            for (int v = u + 1; v <= n; ++v)
+            {
+                if (uniform(rng) < beta * std::exp(-distance(points[u], points[v]) / (alpha * maxDistance)))
+                {
+                    topology.edges.emplace_back(u, v);
+                }
+            }
+        }
+        connect(topology, points);
+        return topology;
+    }
+
+    Topology readEdgeList(const std::string &filename)
+    {
+        std::ifstream file(filename);
+        if (!file.is_open())
+        {
+            throw std::runtime_error("Could not open file: " + filename);
+        }
+
+        Topology topology;
+        topology.name = filename.substr(filename.find_last_of('/') + 1);
+
+        std::string line;
+        bool header = true;
+        while (std::getline(file, line))
+        {
+            if (line.empty() || line[0] == '#')
+            {
+                continue;
+            }
+            std::istringstream iss(line);
+            if (header)
+            {
+                size_t numEdges = 0;
+                iss >> topology.numNodes >> numEdges;
+                topology.edges.reserve(numEdges);
+                header = false;
+                continue;
+            }
+            NodeID u, v;
+            if (iss >> u >> v)
+            {
+                topology.edges.emplace_back(u, v);
+            }
+        }
+        return topology;
+    }
+
+    Adjacency adjacency(const Topology &topology)
+    {
+        Adjacency adj(topology.numNodes + 1);
+        for (const auto &[u, v] : topology.edges)
+        {
+            adj[u].push_back(v);
+            adj[v].push_back(u);
+        }
+        for (auto &neighbors : adj)
+        {
+            std::sort(neighbors.begin(), neighbors.end());
+            neighbors.erase(std::unique(neighbors.begin(), neighbors.end()), neighbors.end());
+        }
+        return adj;
+    }
+
+    std::pair<NodeID, NodeID> farthestPair(const Topology &topology)
+    {
+        Adjacency adj = adjacency(topology);
+        std::vector<int> hops(topology.numNodes + 1, -1);
+        std::queue<NodeID> queue;
+        queue.push(1);
+        hops[1] = 0;
+
+        NodeID farthest = 1;
+        while (!queue.empty())
+        {
+            NodeID node = queue.front();
+            queue.pop();
+            if (hops[node] > hops[farthest])
+            {
+                farthest = node;
+            }
+            for (NodeID next : adj[node])
+            {
+                if (hops[next] < 0)
+                {
+                    hops[next] = hops[node] + 1;
+                    queue.push(next);
+                }
+            }
+        }
+        return {1, farthest};
+    }
+
+} // namespace pyrbdpp::bench
\ No newline at end of file
@@ -0,0 +1,62 @@
+#pragma once
+#include <pyrbd_plusplus/common.hpp>
+#include <cstdint>
+#include <string>
+
+namespace pyrbdpp::bench
+{
+    // Declaration of the short types for the benchmarks
+    using Adjacency = std::vector<std::vector<NodeID>>;
+
+    /**
+     * @brief Undirected topology with the node IDs 1..numNodes, the same labels as after relabel_graph_A_dict().
+     */
+    struct Topology
+    {
+        std::string name;
+        int numNodes = 0;
+        std::vector<std::pair<NodeID, NodeID>> edges;
+    };
+
+    /**
+     * @brief Ring of n nodes
+     */
+    Topology ring(int n);
+
+    /**
+     * @brief Grid of rows x cols nodes, optionally with wrap-around edges (torus)
+     */
+    Topology grid(int rows, int cols, bool torus = false);
+
+    /**
+     * @brief Random geometric graph: n nodes uniform in the unit square, connected if their distance is below radius.
+     * Disconnected components are joined by the shortest edge between them, so the result is always connected.
+     */
+    Topology randomGeometric(int n, double radius, uint64_t seed);
+
+    /**
+     * @brief Waxman graph: n nodes uniform in the unit square, an edge (u, v) exists with probability
+     * beta * exp(-d(u, v) / (alpha * L)), where L is the largest distance. Joined like randomGeometric().
+     */
+    Topology waxman(int n, double alpha, double beta, uint64_t seed);
+
+    /**
+     * @brief Read a topology from an edge list file written by export_topology.py
+     * Format: lines starting with # are comments, the first line is "numNodes numEdges",
+     * every other line is "u v [weight]" with 1-based node IDs.
+     * @param filename Path of the edge list file
+     * @return The topology, throws std::runtime_error if the file can not be read
+     */
+    Topology readEdgeList(const std::string &filename);
+
+    /**
+     * @brief Build the sorted adjacency lists of a topology, index 0 is unused
+     */
+    Adjacency adjacency(const Topology &topology);
+
+    /**
+     * @brief Pick the benchmark pair: node 1 and the node with the largest hop distance from it
+     */
+    std::pair<NodeID, NodeID> farthestPair(const Topology &topology);
+
+} // namespace pyrbdpp::bench
\ No newline at end of file
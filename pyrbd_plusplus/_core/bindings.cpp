@@ -1,14 +1,99 @@
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
+#include <pybind11/numpy.h>
+#include <pyrbd_plusplus/allpairs.hpp>
+#include <pyrbd_plusplus/bdd.hpp>
+#include <pyrbd_plusplus/blockcut.hpp>
+#include <pyrbd_plusplus/bounded.hpp>
+#include <pyrbd_plusplus/demand.hpp>
+#include <pyrbd_plusplus/enumeration.hpp>
+#include <pyrbd_plusplus/exhaustive.hpp>
+#include <pyrbd_plusplus/factoring.hpp>
+#include <pyrbd_plusplus/incremental.hpp>
+#include <pyrbd_plusplus/kterminal.hpp>
+#include <pyrbd_plusplus/links.hpp>
 #include <pyrbd_plusplus/mcs.hpp>
+#include <pyrbd_plusplus/modules.hpp>
+#include <pyrbd_plusplus/montecarlo.hpp>
 #include <pyrbd_plusplus/pathset.hpp>
+#include <pyrbd_plusplus/perf.hpp>
+#include <pyrbd_plusplus/pipeline.hpp>
+#include <pyrbd_plusplus/reduction.hpp>
 #include <pyrbd_plusplus/sdp.hpp>
+#include <pyrbd_plusplus/selector.hpp>
+#include <pyrbd_plusplus/symmetry.hpp>
+#include <pyrbd_plusplus/truncated.hpp>
+#include <numeric>
 
 namespace py = pybind11;
 using namespace pyrbdpp;
 using namespace pyrbdpp::mcs;
 using namespace pyrbdpp::pathset;
 using namespace pyrbdpp::sdp;
+using namespace pyrbdpp::selector;
+
+// Return the result alone, or the tuple (result, stats) if the stats were requested
+template <typename Result, typename Stats>
+py::object withStats(Result &&result, const Stats &stats, bool collect_stats)
+{
+    if (collect_stats)
+    {
+        return py::make_tuple(py::cast(std::forward<Result>(result)), py::cast(stats));
+    }
+    return py::cast(std::forward<Result>(result));
+}
+
+// Convert the counters of all stages to a dict keyed by the stage name
+py::dict stagesToDict(const std::array<perf::Counters, perf::NUM_STAGES> &stages)
+{
+    py::dict d;
+    for (size_t s = 0; s < perf::NUM_STAGES; ++s)
+    {
+        d[perf::stageName(static_cast<perf::Stage>(s))] = stages[s];
+    }
+    return d;
+}
+
+// Wrap an optional Python callable as bounds callback, it acquires the GIL and a None return continues the evaluation
+BoundsCallback toBoundsCallback(const py::object &callback)
+{
+    if (callback.is_none())
+    {
+        return {};
+    }
+    return [callback](const AvailBounds &bounds) {
+        py::gil_scoped_acquire acquire;
+        py::object result = callback(bounds);
+        return result.is_none() || result.cast<bool>();
+    };
+}
+
+// Bind the bounded topology evaluation of an engine as eval_avail_topo_bounded and eval_avail_topo_bounded_parallel
+void defBounded(py::module_ &mod, Engine engine, const std::string &name)
+{
+    for (bool parallel : {false, true})
+    {
+        mod.def(parallel ? "eval_avail_topo_bounded_parallel" : "eval_avail_topo_bounded",
+                [engine, parallel](const Graph& graph,
+                                   const std::vector<std::pair<NodeID, NodeID>>& node_pairs,
+                                   const std::map<int, double>& probabilities,
+                                   size_t max_hops, double max_length, size_t order,
+                                   bool collect_stats) {
+                    ProbabilityMap probMap(probabilities);
+                    std::vector<stats::PairStats> statsList;
+                    auto result = [&] {
+                        py::gil_scoped_release release;
+                        return bounded::evalAvailTopo(graph, node_pairs, probMap, engine, {max_hops, max_length}, order, parallel,
+                                                      collect_stats ? &statsList : nullptr);
+                    }();
+                    return withStats(std::move(result), statsList, collect_stats);
+                },
+                ("Evaluate the hop-bounded or length-bounded availability for each node pairs in topology using " + name +
+                 (parallel ? " (parallel)" : " (serial)")).c_str(),
+                py::arg("graph"), py::arg("node_pairs"), py::arg("probabilities"), py::arg("max_hops") = 0,
+                py::arg("max_length") = 0.0, py::arg("order") = 0, py::arg("stats") = false);
+    }
+}
 
 PYBIND11_MODULE(pyrbd_plusplus_cpp, m)
 {
@@ -17,6 +102,8 @@ PYBIND11_MODULE(pyrbd_plusplus_cpp, m)
     // Bind Classes
     py::class_<ProbabilityMap>(m, "ProbabilityMap")
         .def(py::init<const std::map<int, double>&>())
+        .def(py::init<const std::map<int, double>&, const std::vector<double>&>(), py::arg("nodes"), py::arg("edges"))
+        .def("size", &ProbabilityMap::size)
         .def("print", &ProbabilityMap::print)
         .def("__getitem__", &ProbabilityMap::operator[]);
 
@@ -25,6 +112,69 @@ PYBIND11_MODULE(pyrbd_plusplus_cpp, m)
         .def("isComplementary", &SDP::isComplementary)
         .def("getSet", &SDP::getSet, py::return_value_policy::reference_internal);
 
+    py::class_<stats::PairStats>(m, "PairStats")
+        .def_readonly("src", &stats::PairStats::src)
+        .def_readonly("dst", &stats::PairStats::dst)
+        .def_readonly("total_time", &stats::PairStats::totalTime)
+        .def_readonly("sort_time", &stats::PairStats::sortTime)
+        .def_readonly("rc_time", &stats::PairStats::rcTime)
+        .def_readonly("absorb_time", &stats::PairStats::absorbTime)
+        .def_readonly("eliminate_time", &stats::PairStats::eliminateTime)
+        .def_readonly("decompose_time", &stats::PairStats::decomposeTime)
+        .def_readonly("eval_time", &stats::PairStats::evalTime)
+        .def_readonly("queue_high_water", &stats::PairStats::queueHighWater)
+        .def_readonly("decompositions", &stats::PairStats::decompositions)
+        .def_readonly("terms", &stats::PairStats::terms)
+        .def_readonly("bytes_allocated", &stats::PairStats::bytesAllocated)
+        .def("to_dict", [](const stats::PairStats &s) {
+            py::dict d;
+            d["src"] = s.src;
+            d["dst"] = s.dst;
+            d["total_time"] = s.totalTime;
+            d["sort_time"] = s.sortTime;
+            d["rc_time"] = s.rcTime;
+            d["absorb_time"] = s.absorbTime;
+            d["eliminate_time"] = s.eliminateTime;
+            d["decompose_time"] = s.decomposeTime;
+            d["eval_time"] = s.evalTime;
+            d["queue_high_water"] = s.queueHighWater;
+            d["decompositions"] = s.decompositions;
+            d["terms"] = s.terms;
+            d["bytes_allocated"] = s.bytesAllocated;
+            return d;
+        })
+        .def("__repr__", [](const stats::PairStats &s) {
+            return "<PairStats src=" + std::to_string(s.src) + " dst=" + std::to_string(s.dst) +
+                   " total_time=" + std::to_string(s.totalTime) + " terms=" + std::to_string(s.terms) + ">";
+        });
+
+    py::class_<AvailBounds>(m, "AvailBounds")
+        .def_readonly("src", &AvailBounds::src)
+        .def_readonly("dst", &AvailBounds::dst)
+        .def_readonly("lower", &AvailBounds::lower)
+        .def_readonly("upper", &AvailBounds::upper)
+        .def_readonly("processed", &AvailBounds::processed)
+        .def_readonly("total", &AvailBounds::total)
+        .def_readonly("elapsed", &AvailBounds::elapsed)
+        .def_readonly("converged", &AvailBounds::converged)
+        .def("to_dict", [](const AvailBounds &b) {
+            py::dict d;
+            d["src"] = b.src;
+            d["dst"] = b.dst;
+            d["lower"] = b.lower;
+            d["upper"] = b.upper;
+            d["processed"] = b.processed;
+            d["total"] = b.total;
+            d["elapsed"] = b.elapsed;
+            d["converged"] = b.converged;
+            return d;
+        })
+        .def("__repr__", [](const AvailBounds &b) {
+            return "<AvailBounds src=" + std::to_string(b.src) + " dst=" + std::to_string(b.dst) +
+                   " lower=" + std::to_string(b.lower) + " upper=" + std::to_string(b.upper) +
+                   " converged=" + std::string(b.converged ? "True" : "False") + ">";
+        });
+
     // MCS Algorithm
     auto mcs_mod = m.def_submodule("mcs", "Module for MCS algorithm");
     mcs_mod.doc() = "Module for MCS algorithm";
@@ -37,34 +187,109 @@ PYBIND11_MODULE(pyrbd_plusplus_cpp, m)
                 "Debug Version: Convert minimal cut sets to probability sets",
                 py::arg("src"), py::arg("dst"), py::arg("min_cut_sets"));
 
+    mcs_mod.def("cut_order", &enumeration::cutOrder,
+                "Get the default order limit of the minimal cut sets, ceil(num_elements / 2) like minimalcuts()",
+                py::arg("num_elements"));
+
+    mcs_mod.def("minimal_cuts", &enumeration::minimalCuts,
+                "Enumerate the minimal cut sets from the path sets of a pair (serial)",
+                py::arg("path_sets"), py::arg("src"), py::arg("dst"), py::arg("order") = 0,
+                py::call_guard<py::gil_scoped_release>());
+
+    mcs_mod.def("minimal_cuts_parallel", &enumeration::minimalCutsParallel,
+                "Enumerate the minimal cut sets from the path sets of a pair (parallel)",
+                py::arg("path_sets"), py::arg("src"), py::arg("dst"), py::arg("order") = 0,
+                py::call_guard<py::gil_scoped_release>());
+
+    mcs_mod.def("minimal_cuts_topo", &enumeration::minimalCutsTopo,
+                "Enumerate the minimal cut sets for each node pairs of a graph (serial)",
+                py::arg("graph"), py::arg("node_pairs"), py::arg("order") = 0,
+                py::call_guard<py::gil_scoped_release>());
+
+    mcs_mod.def("minimal_cuts_topo_parallel", &enumeration::minimalCutsTopoParallel,
+                "Enumerate the minimal cut sets for each node pairs of a graph (parallel)",
+                py::arg("graph"), py::arg("node_pairs"), py::arg("order") = 0,
+                py::call_guard<py::gil_scoped_release>());
+
     mcs_mod.def("eval_avail", 
-                [](NodeID src, NodeID dst, const std::map<int, double>& probabilities, const MinCutSets& min_cut_sets) {
+                [](NodeID src, NodeID dst, const std::map<int, double>& probabilities, const MinCutSets& min_cut_sets,
+                   bool collect_stats) {
                     ProbabilityMap probMap(probabilities); 
-                    return mcs::evalAvail(src, dst, probMap, min_cut_sets);
+                    stats::PairStats pairStats;
+                    auto result = mcs::evalAvail(src, dst, probMap, min_cut_sets, collect_stats ? &pairStats : nullptr);
+                    return withStats(std::move(result), pairStats, collect_stats);
                 },
                 "Evaluate availability for single source destination pair using MCS approach",
-                py::arg("src"), py::arg("dst"), py::arg("probabilities"), py::arg("min_cut_sets"));
+                py::arg("src"), py::arg("dst"), py::arg("probabilities"), py::arg("min_cut_sets"), py::arg("stats") = false);
 
     mcs_mod.def("eval_avail_topo", 
                 [](const std::vector<std::pair<NodeID, NodeID>>& node_pairs, 
                    const std::map<int, double>& probabilities, 
-                   const std::vector<MinCutSets>& min_cut_sets_list) {
+                   const std::vector<MinCutSets>& min_cut_sets_list,
+                   bool collect_stats) {
                     ProbabilityMap probMap(probabilities); 
-                    return mcs::evalAvailTopo(node_pairs, probMap, min_cut_sets_list);
+                    std::vector<stats::PairStats> statsList;
+                    auto result = mcs::evalAvailTopo(node_pairs, probMap, min_cut_sets_list, collect_stats ? &statsList : nullptr);
+                    return withStats(std::move(result), statsList, collect_stats);
                 },
                 "Evaluate availability for each node pairs in topology using MCS (serial)",
-                py::arg("node_pairs"), py::arg("probabilities"), py::arg("min_cut_sets_list"));
+                py::arg("node_pairs"), py::arg("probabilities"), py::arg("min_cut_sets_list"), py::arg("stats") = false);
     
     mcs_mod.def("eval_avail_topo_parallel", 
                 [](const std::vector<std::pair<NodeID, NodeID>>& node_pairs, 
                    const std::map<int, double>& probabilities, 
-                   const std::vector<MinCutSets>& min_cut_sets_list) {
+                   const std::vector<MinCutSets>& min_cut_sets_list,
+                   bool collect_stats) {
                     ProbabilityMap probMap(probabilities); 
-                    return mcs::evalAvailTopoParallel(node_pairs, probMap, min_cut_sets_list);
+                    std::vector<stats::PairStats> statsList;
+                    auto result = [&] {
+                        py::gil_scoped_release release;
+                        return mcs::evalAvailTopoParallel(node_pairs, probMap, min_cut_sets_list, collect_stats ? &statsList : nullptr);
+                    }();
+                    return withStats(std::move(result), statsList, collect_stats);
                 },
                 "Evaluate availability for each node pairs in topology using MCS (parallel)",
-                py::arg("node_pairs"), py::arg("probabilities"), py::arg("min_cut_sets_list"),
-                py::call_guard<py::gil_scoped_release>());
+                py::arg("node_pairs"), py::arg("probabilities"), py::arg("min_cut_sets_list"), py::arg("stats") = false);
+
+    mcs_mod.def("eval_avail_topo_graph", 
+                [](const Graph& graph,
+                   const std::vector<std::pair<NodeID, NodeID>>& node_pairs, 
+                   const std::map<int, double>& probabilities, 
+                   size_t order,
+                   bool collect_stats) {
+                    ProbabilityMap probMap(probabilities); 
+                    std::vector<stats::PairStats> statsList;
+                    auto result = [&] {
+                        py::gil_scoped_release release;
+                        // The path sets and cut sets stay in C++, one DFS per source for all destinations
+                        std::vector<MinCutSets> minCutSetsList = enumeration::minimalCutsTopo(graph, node_pairs, order);
+                        return mcs::evalAvailTopo(node_pairs, probMap, minCutSetsList, collect_stats ? &statsList : nullptr);
+                    }();
+                    return withStats(std::move(result), statsList, collect_stats);
+                },
+                "Enumerate the minimal cut sets and evaluate availability for each node pairs in topology using MCS (serial)",
+                py::arg("graph"), py::arg("node_pairs"), py::arg("probabilities"), py::arg("order") = 0, py::arg("stats") = false);
+
+    mcs_mod.def("eval_avail_topo_graph_parallel", 
+                [](const Graph& graph,
+                   const std::vector<std::pair<NodeID, NodeID>>& node_pairs, 
+                   const std::map<int, double>& probabilities, 
+                   size_t order,
+                   bool collect_stats) {
+                    ProbabilityMap probMap(probabilities); 
+                    std::vector<stats::PairStats> statsList;
+                    auto result = [&] {
+                        py::gil_scoped_release release;
+                        // The path sets and cut sets stay in C++, one DFS per source for all destinations
+                        std::vector<MinCutSets> minCutSetsList = enumeration::minimalCutsTopoParallel(graph, node_pairs, order);
+                        return mcs::evalAvailTopoParallel(node_pairs, probMap, minCutSetsList, collect_stats ? &statsList : nullptr);
+                    }();
+                    return withStats(std::move(result), statsList, collect_stats);
+                },
+                "Enumerate the minimal cut sets and evaluate availability for each node pairs in topology using MCS (parallel)",
+                py::arg("graph"), py::arg("node_pairs"), py::arg("probabilities"), py::arg("order") = 0, py::arg("stats") = false);
+
+    defBounded(mcs_mod, Engine::MCS, "MCS");
 
     // PathSet Algorithm
     auto pathset_mod = m.def_submodule("pathset", "Module for PathSet algorithm");
@@ -79,34 +304,124 @@ PYBIND11_MODULE(pyrbd_plusplus_cpp, m)
                 py::arg("src"), py::arg("dst"), py::arg("path_sets"));
 
     pathset_mod.def("eval_avail", 
-                [](NodeID src, NodeID dst, const std::map<int, double>& probabilities, const PathSets& path_sets) {
+                [](NodeID src, NodeID dst, const std::map<int, double>& probabilities, const PathSets& path_sets,
+                   bool collect_stats) {
                     ProbabilityMap probMap(probabilities); 
-                    return pathset::evalAvail(src, dst, probMap, path_sets);
+                    stats::PairStats pairStats;
+                    auto result = pathset::evalAvail(src, dst, probMap, path_sets, collect_stats ? &pairStats : nullptr);
+                    return withStats(std::move(result), pairStats, collect_stats);
                 },
                 "Evaluate availability for single source destination pair using PathSet approach",
-                py::arg("src"), py::arg("dst"), py::arg("probabilities"), py::arg("path_sets"));
+                py::arg("src"), py::arg("dst"), py::arg("probabilities"), py::arg("path_sets"), py::arg("stats") = false);
     
     pathset_mod.def("eval_avail_topo", 
                 [](const std::vector<std::pair<NodeID, NodeID>>& node_pairs, 
                    const std::map<int, double>& probabilities, 
-                   const std::vector<PathSets>& pathsets_list) {
+                   const std::vector<PathSets>& pathsets_list,
+                   bool collect_stats) {
                     ProbabilityMap probMap(probabilities); 
-                    return pathset::evalAvailTopo(node_pairs, probMap, pathsets_list);
+                    std::vector<stats::PairStats> statsList;
+                    auto result = pathset::evalAvailTopo(node_pairs, probMap, pathsets_list, collect_stats ? &statsList : nullptr);
+                    return withStats(std::move(result), statsList, collect_stats);
                 },
                 "Evaluate availability for each node pairs in topology using PathSet (serial)",
-                py::arg("node_pairs"), py::arg("probabilities"), py::arg("pathsets_list"));
+                py::arg("node_pairs"), py::arg("probabilities"), py::arg("pathsets_list"), py::arg("stats") = false);
     
     pathset_mod.def("eval_avail_topo_parallel", 
                 [](const std::vector<std::pair<NodeID, NodeID>>& node_pairs, 
                    const std::map<int, double>& probabilities, 
-                   const std::vector<PathSets>& pathsets_list) {
+                   const std::vector<PathSets>& pathsets_list,
+                   bool collect_stats) {
                     ProbabilityMap probMap(probabilities); 
-                    return pathset::evalAvailTopoParallel(node_pairs, probMap, pathsets_list);
+                    std::vector<stats::PairStats> statsList;
+                    auto result = [&] {
+                        py::gil_scoped_release release;
+                        return pathset::evalAvailTopoParallel(node_pairs, probMap, pathsets_list, collect_stats ? &statsList : nullptr);
+                    }();
+                    return withStats(std::move(result), statsList, collect_stats);
                 },
                 "Evaluate availability for each node pairs in topology using PathSet (parallel)",
+                py::arg("node_pairs"), py::arg("probabilities"), py::arg("pathsets_list"), py::arg("stats") = false);
+    
+    pathset_mod.def("eval_avail_topo_graph", 
+                [](const Graph& graph,
+                   const std::vector<std::pair<NodeID, NodeID>>& node_pairs, 
+                   const std::map<int, double>& probabilities, 
+                   bool collect_stats) {
+                    ProbabilityMap probMap(probabilities); 
+                    std::vector<stats::PairStats> statsList;
+                    auto result = [&] {
+                        py::gil_scoped_release release;
+                        // The path sets stay in C++, one DFS per source for all destinations
+                        std::vector<PathSets> pathsetsList = enumeration::minimalPathsTopoFromSources(graph, node_pairs);
+                        return pathset::evalAvailTopo(node_pairs, probMap, pathsetsList, collect_stats ? &statsList : nullptr);
+                    }();
+                    return withStats(std::move(result), statsList, collect_stats);
+                },
+                "Enumerate the path sets and evaluate availability for each node pairs in topology using PathSet (serial)",
+                py::arg("graph"), py::arg("node_pairs"), py::arg("probabilities"), py::arg("stats") = false);
+
+    pathset_mod.def("eval_avail_topo_graph_parallel", 
+                [](const Graph& graph,
+                   const std::vector<std::pair<NodeID, NodeID>>& node_pairs, 
+                   const std::map<int, double>& probabilities, 
+                   bool collect_stats) {
+                    ProbabilityMap probMap(probabilities); 
+                    std::vector<stats::PairStats> statsList;
+                    auto result = [&] {
+                        py::gil_scoped_release release;
+                        // The path sets stay in C++, one DFS per source for all destinations
+                        std::vector<PathSets> pathsetsList = enumeration::minimalPathsTopoFromSourcesParallel(graph, node_pairs);
+                        return pathset::evalAvailTopoParallel(node_pairs, probMap, pathsetsList, collect_stats ? &statsList : nullptr);
+                    }();
+                    return withStats(std::move(result), statsList, collect_stats);
+                },
+                "Enumerate the path sets and evaluate availability for each node pairs in topology using PathSet (parallel)",
+                py::arg("graph"), py::arg("node_pairs"), py::arg("probabilities"), py::arg("stats") = false);
+    
+    pathset_mod.def("eval_avail_bounds", 
+                [](NodeID src, NodeID dst, const std::map<int, double>& probabilities, const PathSets& path_sets,
+                   double epsilon, double deadline, const py::object& callback, double report_interval) {
+                    ProbabilityMap probMap(probabilities); 
+                    BoundsOptions options{epsilon, deadline, report_interval};
+                    BoundsCallback boundsCallback = toBoundsCallback(callback);
+                    py::gil_scoped_release release;
+                    return pathset::evalAvailBounds(src, dst, probMap, path_sets, options, boundsCallback);
+                },
+                "Anytime evaluation of the availability bounds for single source destination pair using PathSet approach",
+                py::arg("src"), py::arg("dst"), py::arg("probabilities"), py::arg("path_sets"),
+                py::arg("epsilon") = 1e-9, py::arg("deadline") = 0.0, py::arg("callback") = py::none(), py::arg("report_interval") = 0.0);
+
+    pathset_mod.def("eval_avail_bounds_topo", 
+                [](const std::vector<std::pair<NodeID, NodeID>>& node_pairs, 
+                   const std::map<int, double>& probabilities, 
+                   const std::vector<PathSets>& pathsets_list,
+                   double epsilon, double deadline) {
+                    ProbabilityMap probMap(probabilities); 
+                    BoundsOptions options{epsilon, deadline, 0.0};
+                    return pathset::evalAvailBoundsTopo(node_pairs, probMap, pathsets_list, options);
+                },
+                "Anytime evaluation of the availability bounds for each node pairs in topology using PathSet (serial)",
+                py::arg("node_pairs"), py::arg("probabilities"), py::arg("pathsets_list"),
+                py::arg("epsilon") = 1e-9, py::arg("deadline") = 0.0,
+                py::call_guard<py::gil_scoped_release>());
+
+    pathset_mod.def("eval_avail_bounds_topo_parallel", 
+                [](const std::vector<std::pair<NodeID, NodeID>>& node_pairs, 
+                   const std::map<int, double>& probabilities, 
+                   const std::vector<PathSets>& pathsets_list,
+                   double epsilon, double deadline) {
+                    ProbabilityMap probMap(probabilities); 
+                    BoundsOptions options{epsilon, deadline, 0.0};
+                    return pathset::evalAvailBoundsTopoParallel(node_pairs, probMap, pathsets_list, options);
+                },
+                "Anytime evaluation of the availability bounds for each node pairs in topology using PathSet (parallel)",
                 py::arg("node_pairs"), py::arg("probabilities"), py::arg("pathsets_list"),
+                py::arg("epsilon") = 1e-9, py::arg("deadline") = 0.0,
                 py::call_guard<py::gil_scoped_release>());
     
+    defBounded(pathset_mod, Engine::PathSet, "PathSet");
+
     // SDP Algorithm
     auto sdp_mod = m.def_submodule("sdp", "Module for SDP algorithm");
     sdp_mod.doc() = "Module for SDP algorithm";
@@ -115,9 +430,20 @@ PYBIND11_MODULE(pyrbd_plusplus_cpp, m)
                 "Convert path sets to SDP sets (serial)",
                 py::arg("src"), py::arg("dst"), py::arg("path_sets"));
     
-    // sdp_mod.def("to_sdp_set_debug", &sdp::toSDPSetDebug,
-    //             "Debug Version: Convert path sets to SDP sets",
-    //             py::arg("src"), py::arg("dst"), py::arg("path_sets"));
+    sdp_mod.def("to_sdp_set_stats", 
+                [](NodeID src, NodeID dst, PathSets path_sets) {
+                    stats::PairStats pairStats;
+                    pairStats.src = src;
+                    pairStats.dst = dst;
+                    std::vector<SDPSets> sdpSets;
+                    {
+                        stats::Scope scope(&pairStats);
+                        sdpSets = sdp::toSDPSet(src, dst, std::move(path_sets));
+                    }
+                    return std::make_pair(std::move(sdpSets), pairStats);
+                },
+                "Stats Version: Convert path sets to SDP sets and return (sdp_sets, stats)",
+                py::arg("src"), py::arg("dst"), py::arg("path_sets"));
 
     sdp_mod.def("to_sdp_set_parallel", &sdp::toSDPSetParallel,
                 "Convert path sets to SDP sets (parallel)",
@@ -125,40 +451,1293 @@ PYBIND11_MODULE(pyrbd_plusplus_cpp, m)
                 py::call_guard<py::gil_scoped_release>());
 
     sdp_mod.def("eval_avail", 
-                [](NodeID src, NodeID dst, const std::map<int, double>& probabilities, PathSets& path_sets) {
+                [](NodeID src, NodeID dst, const std::map<int, double>& probabilities, PathSets& path_sets,
+                   bool collect_stats) {
                     ProbabilityMap probMap(probabilities); 
-                    return sdp::evalAvail(src, dst, probMap, path_sets);
+                    stats::PairStats pairStats;
+                    auto result = sdp::evalAvail(src, dst, probMap, path_sets, collect_stats ? &pairStats : nullptr);
+                    return withStats(std::move(result), pairStats, collect_stats);
                 },
                 "Evaluate availability for single source destination pair using SDP approach",
-                py::arg("src"), py::arg("dst"), py::arg("probabilities"), py::arg("path_sets"));
+                py::arg("src"), py::arg("dst"), py::arg("probabilities"), py::arg("path_sets"), py::arg("stats") = false);
 
     sdp_mod.def("eval_avail_parallel", 
-                [](NodeID src, NodeID dst, const std::map<int, double>& probabilities, PathSets& path_sets) {
+                [](NodeID src, NodeID dst, const std::map<int, double>& probabilities, PathSets& path_sets,
+                   bool collect_stats) {
                     ProbabilityMap probMap(probabilities); 
-                    return sdp::evalAvailParallel(src, dst, probMap, path_sets);
+                    stats::PairStats pairStats;
+                    auto result = [&] {
+                        py::gil_scoped_release release;
+                        return sdp::evalAvailParallel(src, dst, probMap, path_sets, collect_stats ? &pairStats : nullptr);
+                    }();
+                    return withStats(std::move(result), pairStats, collect_stats);
                 },
                 "Evaluate availability for single source destination pair using SDP approach (parallel)",
-                py::arg("src"), py::arg("dst"), py::arg("probabilities"), py::arg("path_sets"),
-                py::call_guard<py::gil_scoped_release>());
+                py::arg("src"), py::arg("dst"), py::arg("probabilities"), py::arg("path_sets"), py::arg("stats") = false);
     
     sdp_mod.def("eval_avail_topo", 
                 [](const std::vector<std::pair<NodeID, NodeID>>& node_pairs, 
                    const std::map<int, double>& probabilities, 
-                   std::vector<PathSets>& pathsets_list) {
+                   std::vector<PathSets>& pathsets_list,
+                   bool collect_stats) {
                     ProbabilityMap probMap(probabilities); 
-                    return sdp::evalAvailTopo(node_pairs, probMap, pathsets_list);
+                    std::vector<stats::PairStats> statsList;
+                    auto result = sdp::evalAvailTopo(node_pairs, probMap, pathsets_list, collect_stats ? &statsList : nullptr);
+                    return withStats(std::move(result), statsList, collect_stats);
                 },
                 "Evaluate availability for each node pairs in topology using SDP (serial)",
-                py::arg("node_pairs"), py::arg("probabilities"), py::arg("pathsets_list"));
+                py::arg("node_pairs"), py::arg("probabilities"), py::arg("pathsets_list"), py::arg("stats") = false);
 
     sdp_mod.def("eval_avail_topo_parallel", 
                 [](const std::vector<std::pair<NodeID, NodeID>>& node_pairs, 
                    const std::map<int, double>& probabilities, 
-                   std::vector<PathSets>& pathsets_list) {
+                   std::vector<PathSets>& pathsets_list,
+                   bool collect_stats) {
                     ProbabilityMap probMap(probabilities); 
-                    return sdp::evalAvailTopoParallel(node_pairs, probMap, pathsets_list);
+                    std::vector<stats::PairStats> statsList;
+                    auto result = [&] {
+                        py::gil_scoped_release release;
+                        return sdp::evalAvailTopoParallel(node_pairs, probMap, pathsets_list, collect_stats ? &statsList : nullptr);
+                    }();
+                    return withStats(std::move(result), statsList, collect_stats);
                 },
                 "Evaluate availability for each node pairs in topology using SDP (parallel)",
+                py::arg("node_pairs"), py::arg("probabilities"), py::arg("pathsets_list"), py::arg("stats") = false);
+
+    sdp_mod.def("eval_avail_topo_graph", 
+                [](const Graph& graph,
+                   const std::vector<std::pair<NodeID, NodeID>>& node_pairs, 
+                   const std::map<int, double>& probabilities, 
+                   bool collect_stats) {
+                    ProbabilityMap probMap(probabilities); 
+                    std::vector<stats::PairStats> statsList;
+                    auto result = [&] {
+                        py::gil_scoped_release release;
+                        // The path sets stay in C++, one DFS per source for all destinations
+                        std::vector<PathSets> pathsetsList = enumeration::minimalPathsTopoFromSources(graph, node_pairs);
+                        return sdp::evalAvailTopo(node_pairs, probMap, pathsetsList, collect_stats ? &statsList : nullptr);
+                    }();
+                    return withStats(std::move(result), statsList, collect_stats);
+                },
+                "Enumerate the path sets and evaluate availability for each node pairs in topology using SDP (serial)",
+                py::arg("graph"), py::arg("node_pairs"), py::arg("probabilities"), py::arg("stats") = false);
+
+    sdp_mod.def("eval_avail_topo_graph_parallel", 
+                [](const Graph& graph,
+                   const std::vector<std::pair<NodeID, NodeID>>& node_pairs, 
+                   const std::map<int, double>& probabilities, 
+                   bool collect_stats) {
+                    ProbabilityMap probMap(probabilities); 
+                    std::vector<stats::PairStats> statsList;
+                    auto result = [&] {
+                        py::gil_scoped_release release;
+                        // The path sets stay in C++, one DFS per source for all destinations
+                        std::vector<PathSets> pathsetsList = enumeration::minimalPathsTopoFromSourcesParallel(graph, node_pairs);
+                        return sdp::evalAvailTopoParallel(node_pairs, probMap, pathsetsList, collect_stats ? &statsList : nullptr);
+                    }();
+                    return withStats(std::move(result), statsList, collect_stats);
+                },
+                "Enumerate the path sets and evaluate availability for each node pairs in topology using SDP (parallel)",
+                py::arg("graph"), py::arg("node_pairs"), py::arg("probabilities"), py::arg("stats") = false);
+
+    sdp_mod.def("eval_avail_bounds", 
+                [](NodeID src, NodeID dst, const std::map<int, double>& probabilities, const PathSets& path_sets,
+                   double epsilon, double deadline, const py::object& callback, double report_interval) {
+                    ProbabilityMap probMap(probabilities); 
+                    BoundsOptions options{epsilon, deadline, report_interval};
+                    BoundsCallback boundsCallback = toBoundsCallback(callback);
+                    py::gil_scoped_release release;
+                    return sdp::evalAvailBounds(src, dst, probMap, path_sets, options, boundsCallback);
+                },
+                "Anytime evaluation of the availability bounds for single source destination pair using SDP approach",
+                py::arg("src"), py::arg("dst"), py::arg("probabilities"), py::arg("path_sets"),
+                py::arg("epsilon") = 1e-9, py::arg("deadline") = 0.0, py::arg("callback") = py::none(), py::arg("report_interval") = 0.0);
+
+    sdp_mod.def("eval_avail_bounds_parallel", 
+                [](NodeID src, NodeID dst, const std::map<int, double>& probabilities, const PathSets& path_sets,
+                   double epsilon, double deadline, const py::object& callback, double report_interval) {
+                    ProbabilityMap probMap(probabilities); 
+                    BoundsOptions options{epsilon, deadline, report_interval};
+                    BoundsCallback boundsCallback = toBoundsCallback(callback);
+                    py::gil_scoped_release release;
+                    return sdp::evalAvailBoundsParallel(src, dst, probMap, path_sets, options, boundsCallback);
+                },
+                "Anytime evaluation of the availability bounds for single source destination pair using SDP approach (parallel)",
+                py::arg("src"), py::arg("dst"), py::arg("probabilities"), py::arg("path_sets"),
+                py::arg("epsilon") = 1e-9, py::arg("deadline") = 0.0, py::arg("callback") = py::none(), py::arg("report_interval") = 0.0);
+
+    sdp_mod.def("eval_avail_bounds_topo", 
+                [](const std::vector<std::pair<NodeID, NodeID>>& node_pairs, 
+                   const std::map<int, double>& probabilities, 
+                   const std::vector<PathSets>& pathsets_list,
+                   double epsilon, double deadline) {
+                    ProbabilityMap probMap(probabilities); 
+                    BoundsOptions options{epsilon, deadline, 0.0};
+                    return sdp::evalAvailBoundsTopo(node_pairs, probMap, pathsets_list, options);
+                },
+                "Anytime evaluation of the availability bounds for each node pairs in topology using SDP (serial)",
+                py::arg("node_pairs"), py::arg("probabilities"), py::arg("pathsets_list"),
+                py::arg("epsilon") = 1e-9, py::arg("deadline") = 0.0,
+                py::call_guard<py::gil_scoped_release>());
+
+    sdp_mod.def("eval_avail_bounds_topo_parallel", 
+                [](const std::vector<std::pair<NodeID, NodeID>>& node_pairs, 
+                   const std::map<int, double>& probabilities, 
+                   const std::vector<PathSets>& pathsets_list,
+                   double epsilon, double deadline) {
+                    ProbabilityMap probMap(probabilities); 
+                    BoundsOptions options{epsilon, deadline, 0.0};
+                    return sdp::evalAvailBoundsTopoParallel(node_pairs, probMap, pathsets_list, options);
+                },
+                "Anytime evaluation of the availability bounds for each node pairs in topology using SDP (parallel)",
+                py::arg("node_pairs"), py::arg("probabilities"), py::arg("pathsets_list"),
+                py::arg("epsilon") = 1e-9, py::arg("deadline") = 0.0,
+                py::call_guard<py::gil_scoped_release>());
+
+    defBounded(sdp_mod, Engine::SDP, "SDP");
+
+    // BDD Algorithm
+    auto bdd_mod = m.def_submodule("bdd", "Module for BDD algorithm");
+    bdd_mod.doc() = "Module for BDD algorithm";
+
+    py::enum_<bdd::Ordering>(bdd_mod, "Ordering")
+        .value("bfs", bdd::Ordering::BFS)
+        .value("frequency", bdd::Ordering::Frequency);
+
+    py::class_<bdd::Diagram>(bdd_mod, "Diagram")
+        .def_readonly("src", &bdd::Diagram::src)
+        .def_readonly("dst", &bdd::Diagram::dst)
+        .def_readonly("order", &bdd::Diagram::order)
+        .def_readonly("max_width", &bdd::Diagram::maxWidth)
+        .def("size", &bdd::Diagram::size)
+        .def("availability",
+             [](const bdd::Diagram &d, const std::map<int, double>& probabilities) {
+                 ProbabilityMap probMap(probabilities);
+                 return d.availability(probMap);
+             },
+             "Compute the availability with a single bottom-up pass over the compiled diagram",
+             py::arg("probabilities"))
+        .def("__repr__", [](const bdd::Diagram &d) {
+            return "<Diagram src=" + std::to_string(d.src) + " dst=" + std::to_string(d.dst) +
+                   " size=" + std::to_string(d.size()) + " max_width=" + std::to_string(d.maxWidth) + ">";
+        });
+
+    bdd_mod.def("from_path_sets", &bdd::fromPathSets,
+                "Compile the BDD of a pair from its path sets",
+                py::arg("path_sets"), py::arg("src"), py::arg("dst"), py::arg("ordering") = bdd::Ordering::BFS);
+
+    bdd_mod.def("from_graph", &bdd::fromGraph,
+                "Compile the BDD of a pair directly from the graph by frontier-based construction",
+                py::arg("graph"), py::arg("src"), py::arg("dst"), py::arg("ordering") = bdd::Ordering::BFS,
+                py::call_guard<py::gil_scoped_release>());
+
+    bdd_mod.def("eval_avail", 
+                [](NodeID src, NodeID dst, const std::map<int, double>& probabilities, const PathSets& path_sets,
+                   bool collect_stats) {
+                    ProbabilityMap probMap(probabilities); 
+                    stats::PairStats pairStats;
+                    auto result = bdd::evalAvail(src, dst, probMap, path_sets, collect_stats ? &pairStats : nullptr);
+                    return withStats(std::move(result), pairStats, collect_stats);
+                },
+                "Evaluate availability for single source destination pair using the BDD of the path sets",
+                py::arg("src"), py::arg("dst"), py::arg("probabilities"), py::arg("path_sets"), py::arg("stats") = false);
+    
+    bdd_mod.def("eval_avail_topo", 
+                [](const std::vector<std::pair<NodeID, NodeID>>& node_pairs, 
+                   const std::map<int, double>& probabilities, 
+                   const std::vector<PathSets>& pathsets_list,
+                   bool collect_stats) {
+                    ProbabilityMap probMap(probabilities); 
+                    std::vector<stats::PairStats> statsList;
+                    auto result = bdd::evalAvailTopo(node_pairs, probMap, pathsets_list, collect_stats ? &statsList : nullptr);
+                    return withStats(std::move(result), statsList, collect_stats);
+                },
+                "Evaluate availability for each node pairs in topology using the BDD of the path sets (serial)",
+                py::arg("node_pairs"), py::arg("probabilities"), py::arg("pathsets_list"), py::arg("stats") = false);
+    
+    bdd_mod.def("eval_avail_topo_parallel", 
+                [](const std::vector<std::pair<NodeID, NodeID>>& node_pairs, 
+                   const std::map<int, double>& probabilities, 
+                   const std::vector<PathSets>& pathsets_list,
+                   bool collect_stats) {
+                    ProbabilityMap probMap(probabilities); 
+                    std::vector<stats::PairStats> statsList;
+                    auto result = [&] {
+                        py::gil_scoped_release release;
+                        return bdd::evalAvailTopoParallel(node_pairs, probMap, pathsets_list, collect_stats ? &statsList : nullptr);
+                    }();
+                    return withStats(std::move(result), statsList, collect_stats);
+                },
+                "Evaluate availability for each node pairs in topology using the BDD of the path sets (parallel)",
+                py::arg("node_pairs"), py::arg("probabilities"), py::arg("pathsets_list"), py::arg("stats") = false);
+
+    bdd_mod.def("eval_avail_topo_graph", 
+                [](const Graph& graph,
+                   const std::vector<std::pair<NodeID, NodeID>>& node_pairs, 
+                   const std::map<int, double>& probabilities, 
+                   bool collect_stats, bdd::Ordering ordering) {
+                    ProbabilityMap probMap(probabilities); 
+                    std::vector<stats::PairStats> statsList;
+                    auto result = [&] {
+                        py::gil_scoped_release release;
+                        // The diagrams are compiled from the graph, no path set is enumerated
+                        return bdd::evalAvailTopoGraph(graph, node_pairs, probMap, ordering, false, collect_stats ? &statsList : nullptr);
+                    }();
+                    return withStats(std::move(result), statsList, collect_stats);
+                },
+                "Compile the BDD from the graph and evaluate availability for each node pairs in topology (serial)",
+                py::arg("graph"), py::arg("node_pairs"), py::arg("probabilities"), py::arg("stats") = false,
+                py::arg("ordering") = bdd::Ordering::BFS);
+
+    bdd_mod.def("eval_avail_topo_graph_parallel", 
+                [](const Graph& graph,
+                   const std::vector<std::pair<NodeID, NodeID>>& node_pairs, 
+                   const std::map<int, double>& probabilities, 
+                   bool collect_stats, bdd::Ordering ordering) {
+                    ProbabilityMap probMap(probabilities); 
+                    std::vector<stats::PairStats> statsList;
+                    auto result = [&] {
+                        py::gil_scoped_release release;
+                        // The diagrams are compiled from the graph, no path set is enumerated
+                        return bdd::evalAvailTopoGraph(graph, node_pairs, probMap, ordering, true, collect_stats ? &statsList : nullptr);
+                    }();
+                    return withStats(std::move(result), statsList, collect_stats);
+                },
+                "Compile the BDD from the graph and evaluate availability for each node pairs in topology (parallel)",
+                py::arg("graph"), py::arg("node_pairs"), py::arg("probabilities"), py::arg("stats") = false,
+                py::arg("ordering") = bdd::Ordering::BFS);
+
+    bdd_mod.def("compile_topo", &bdd::compileTopo,
+                "Compile the BDD of each node pair from the graph, the diagrams can be evaluated for any probabilities",
+                py::arg("graph"), py::arg("node_pairs"), py::arg("ordering") = bdd::Ordering::BFS, py::arg("parallel") = true,
+                py::call_guard<py::gil_scoped_release>());
+
+    bdd_mod.def("eval_diagrams",
+                [](const std::vector<bdd::Diagram>& diagrams, const std::map<int, double>& probabilities, bool parallel) {
+                    ProbabilityMap probMap(probabilities);
+                    py::gil_scoped_release release;
+                    return bdd::evalDiagrams(diagrams, probMap, parallel);
+                },
+                "Evaluate compiled diagrams with new probabilities",
+                py::arg("diagrams"), py::arg("probabilities"), py::arg("parallel") = true);
+
+    // Factoring Algorithm
+    auto factoring_mod = m.def_submodule("factoring", "Module for the pivotal decomposition (factoring) algorithm");
+    factoring_mod.doc() = "Module for the pivotal decomposition (factoring) algorithm";
+
+    factoring_mod.def("eval_avail",
+                [](const Graph& graph, NodeID src, NodeID dst, const std::map<int, double>& probabilities,
+                   bool parallel, bool collect_stats) {
+                    ProbabilityMap probMap(probabilities);
+                    stats::PairStats pairStats;
+                    auto result = [&] {
+                        py::gil_scoped_release release;
+                        return factoring::evalAvail(graph, src, dst, probMap, parallel, collect_stats ? &pairStats : nullptr);
+                    }();
+                    return withStats(std::move(result), pairStats, collect_stats);
+                },
+                "Evaluate availability for single source destination pair by factoring on the nodes",
+                py::arg("graph"), py::arg("src"), py::arg("dst"), py::arg("probabilities"), py::arg("parallel") = false,
+                py::arg("stats") = false);
+
+    factoring_mod.def("eval_avail_topo",
+                [](const Graph& graph,
+                   const std::vector<std::pair<NodeID, NodeID>>& node_pairs,
+                   const std::map<int, double>& probabilities,
+                   bool parallel, bool collect_stats) {
+                    ProbabilityMap probMap(probabilities);
+                    std::vector<stats::PairStats> statsList;
+                    auto result = [&] {
+                        py::gil_scoped_release release;
+                        return factoring::evalAvailTopo(graph, node_pairs, probMap, parallel, collect_stats ? &statsList : nullptr);
+                    }();
+                    return withStats(std::move(result), statsList, collect_stats);
+                },
+                "Evaluate availability for each node pairs in topology by factoring on the nodes",
+                py::arg("graph"), py::arg("node_pairs"), py::arg("probabilities"), py::arg("parallel") = true,
+                py::arg("stats") = false);
+
+    // Monte Carlo estimation
+    auto montecarlo_mod = m.def_submodule("montecarlo", "Module for the bit-parallel Monte Carlo estimation");
+    montecarlo_mod.doc() = "Module for the bit-parallel Monte Carlo estimation";
+
+    py::class_<montecarlo::Estimate>(montecarlo_mod, "Estimate")
+        .def_readonly("src", &montecarlo::Estimate::src)
+        .def_readonly("dst", &montecarlo::Estimate::dst)
+        .def_readonly("availability", &montecarlo::Estimate::availability)
+        .def_readonly("lower", &montecarlo::Estimate::lower)
+        .def_readonly("upper", &montecarlo::Estimate::upper)
+        .def_readonly("samples", &montecarlo::Estimate::samples)
+        .def_readonly("converged", &montecarlo::Estimate::converged)
+        .def("to_dict", [](const montecarlo::Estimate &e) {
+            py::dict d;
+            d["src"] = e.src;
+            d["dst"] = e.dst;
+            d["availability"] = e.availability;
+            d["lower"] = e.lower;
+            d["upper"] = e.upper;
+            d["samples"] = e.samples;
+            d["converged"] = e.converged;
+            return d;
+        })
+        .def("__repr__", [](const montecarlo::Estimate &e) {
+            return "<Estimate src=" + std::to_string(e.src) + " dst=" + std::to_string(e.dst) +
+                   " availability=" + std::to_string(e.availability) + " lower=" + std::to_string(e.lower) +
+                   " upper=" + std::to_string(e.upper) + " samples=" + std::to_string(e.samples) + ">";
+        });
+
+    montecarlo_mod.def("estimate_avail",
+                [](const Graph& graph, NodeID src, NodeID dst, const std::map<int, double>& probabilities,
+                   size_t samples, double target_width, double z, uint64_t seed, bool parallel) {
+                    ProbabilityMap probMap(probabilities);
+                    montecarlo::Options options{samples, target_width, z, seed};
+                    py::gil_scoped_release release;
+                    return montecarlo::estimateAvail(graph, src, dst, probMap, options, parallel);
+                },
+                "Estimate availability for single source destination pair by bit-parallel Monte Carlo sampling",
+                py::arg("graph"), py::arg("src"), py::arg("dst"), py::arg("probabilities"),
+                py::arg("samples") = size_t(1) << 20, py::arg("target_width") = 0.0, py::arg("z") = 1.96,
+                py::arg("seed") = 0, py::arg("parallel") = false);
+
+    montecarlo_mod.def("estimate_avail_topo",
+                [](const Graph& graph,
+                   const std::vector<std::pair<NodeID, NodeID>>& node_pairs,
+                   const std::map<int, double>& probabilities,
+                   size_t samples, double target_width, double z, uint64_t seed, bool parallel) {
+                    ProbabilityMap probMap(probabilities);
+                    montecarlo::Options options{samples, target_width, z, seed};
+                    py::gil_scoped_release release;
+                    return montecarlo::estimateAvailTopo(graph, node_pairs, probMap, options, parallel);
+                },
+                "Estimate availability for each node pairs in topology from the same sampled node states",
+                py::arg("graph"), py::arg("node_pairs"), py::arg("probabilities"),
+                py::arg("samples") = size_t(1) << 20, py::arg("target_width") = 0.0, py::arg("z") = 1.96,
+                py::arg("seed") = 0, py::arg("parallel") = true);
+
+    py::class_<montecarlo::RareEstimate>(montecarlo_mod, "RareEstimate")
+        .def_readonly("src", &montecarlo::RareEstimate::src)
+        .def_readonly("dst", &montecarlo::RareEstimate::dst)
+        .def_readonly("unavailability", &montecarlo::RareEstimate::unavailability)
+        .def_readonly("lower", &montecarlo::RareEstimate::lower)
+        .def_readonly("upper", &montecarlo::RareEstimate::upper)
+        .def_readonly("rel_error", &montecarlo::RareEstimate::relError)
+        .def_readonly("samples", &montecarlo::RareEstimate::samples)
+        .def_readonly("converged", &montecarlo::RareEstimate::converged)
+        .def("to_dict", [](const montecarlo::RareEstimate &e) {
+            py::dict d;
+            d["src"] = e.src;
+            d["dst"] = e.dst;
+            d["unavailability"] = e.unavailability;
+            d["lower"] = e.lower;
+            d["upper"] = e.upper;
+            d["rel_error"] = e.relError;
+            d["samples"] = e.samples;
+            d["converged"] = e.converged;
+            return d;
+        })
+        .def("__repr__", [](const montecarlo::RareEstimate &e) {
+            return "<RareEstimate src=" + std::to_string(e.src) + " dst=" + std::to_string(e.dst) +
+                   " unavailability=" + std::to_string(e.unavailability) + " rel_error=" + std::to_string(e.relError) +
+                   " samples=" + std::to_string(e.samples) + ">";
+        });
+
+    montecarlo_mod.def("estimate_unavail",
+                [](NodeID src, NodeID dst, const std::map<int, double>& probabilities, const montecarlo::MinCutSets& min_cut_sets,
+                   size_t samples, double relative_error, double z, uint64_t seed, bool parallel) {
+                    ProbabilityMap probMap(probabilities);
+                    montecarlo::Options options{samples, 0.0, z, seed, relative_error};
+                    py::gil_scoped_release release;
+                    return montecarlo::estimateUnavail(src, dst, probMap, min_cut_sets, options, parallel);
+                },
+                "Estimate unavailability for single source destination pair by importance sampling on the minimal cut sets",
+                py::arg("src"), py::arg("dst"), py::arg("probabilities"), py::arg("min_cut_sets"),
+                py::arg("samples") = size_t(1) << 24, py::arg("relative_error") = 0.01, py::arg("z") = 1.96,
+                py::arg("seed") = 0, py::arg("parallel") = false);
+
+    montecarlo_mod.def("estimate_unavail_topo",
+                [](const std::vector<std::pair<NodeID, NodeID>>& node_pairs,
+                   const std::map<int, double>& probabilities,
+                   const std::vector<montecarlo::MinCutSets>& min_cut_sets_list,
+                   size_t samples, double relative_error, double z, uint64_t seed, bool parallel) {
+                    ProbabilityMap probMap(probabilities);
+                    montecarlo::Options options{samples, 0.0, z, seed, relative_error};
+                    py::gil_scoped_release release;
+                    return montecarlo::estimateUnavailTopo(node_pairs, probMap, min_cut_sets_list, options, parallel);
+                },
+                "Estimate unavailability for each node pairs in topology by importance sampling on the minimal cut sets",
+                py::arg("node_pairs"), py::arg("probabilities"), py::arg("min_cut_sets_list"),
+                py::arg("samples") = size_t(1) << 24, py::arg("relative_error") = 0.01, py::arg("z") = 1.96,
+                py::arg("seed") = 0, py::arg("parallel") = true);
+
+    // K-terminal reliability
+    auto kterminal_mod = m.def_submodule("kterminal", "Module for the k-terminal and all-terminal reliability");
+    kterminal_mod.doc() = "Module for the k-terminal and all-terminal reliability";
+
+    py::class_<kterminal::FrontierInfo>(kterminal_mod, "FrontierInfo")
+        .def(py::init<>())
+        .def_readonly("levels", &kterminal::FrontierInfo::levels)
+        .def_readonly("max_frontier", &kterminal::FrontierInfo::maxFrontier)
+        .def_readonly("max_states", &kterminal::FrontierInfo::maxStates)
+        .def_readonly("states", &kterminal::FrontierInfo::states)
+        .def("__repr__", [](const kterminal::FrontierInfo &i) {
+            return "<FrontierInfo levels=" + std::to_string(i.levels) + " max_frontier=" + std::to_string(i.maxFrontier) +
+                   " max_states=" + std::to_string(i.maxStates) + " states=" + std::to_string(i.states) + ">";
+        });
+
+    kterminal_mod.def("eval_reliability",
+                [](const Graph& graph, const kterminal::Terminals& terminals, const std::map<int, double>& probabilities,
+                   bool parallel, kterminal::FrontierInfo* info) {
+                    ProbabilityMap probMap(probabilities);
+                    py::gil_scoped_release release;
+                    return kterminal::evalReliability(graph, terminals, probMap, parallel, info);
+                },
+                "Evaluate the probability that all terminals work and are connected",
+                py::arg("graph"), py::arg("terminals"), py::arg("probabilities"), py::arg("parallel") = false,
+                py::arg("info") = nullptr);
+
+    kterminal_mod.def("eval_reliability_topo",
+                [](const Graph& graph, const std::vector<kterminal::Terminals>& terminal_sets,
+                   const std::map<int, double>& probabilities, bool parallel) {
+                    ProbabilityMap probMap(probabilities);
+                    py::gil_scoped_release release;
+                    return kterminal::evalReliabilityTopo(graph, terminal_sets, probMap, parallel);
+                },
+                "Evaluate the probability that all terminals work and are connected for each terminal set",
+                py::arg("graph"), py::arg("terminal_sets"), py::arg("probabilities"), py::arg("parallel") = true);
+
+    // Automatic algorithm selection
+    auto selector_mod = m.def_submodule("selector", "Module for the automatic algorithm selection");
+    selector_mod.doc() = "Module for the automatic algorithm selection";
+
+    py::enum_<Engine>(selector_mod, "Engine")
+        .value("mcs", Engine::MCS)
+        .value("pathset", Engine::PathSet)
+        .value("sdp", Engine::SDP);
+
+    py::class_<CostModel>(selector_mod, "CostModel")
+        .def(py::init<>())
+        .def_readwrite("sdp_coeff", &CostModel::sdpCoeff)
+        .def_readwrite("pathset_coeff", &CostModel::pathsetCoeff)
+        .def_readwrite("mcs_coeff", &CostModel::mcsCoeff)
+        .def_readwrite("sdp_overhead", &CostModel::sdpOverhead)
+        .def_readwrite("pathset_overhead", &CostModel::pathsetOverhead)
+        .def_readwrite("mcs_overhead", &CostModel::mcsOverhead);
+
+    py::class_<CostEstimate>(selector_mod, "CostEstimate")
+        .def_readonly("mcs", &CostEstimate::mcs)
+        .def_readonly("pathset", &CostEstimate::pathset)
+        .def_readonly("sdp", &CostEstimate::sdp);
+
+    selector_mod.def("estimate_cost", &selector::estimateCost,
+                "Estimate the cost of each engine for a single pair",
+                py::arg("model"), py::arg("path_sets"), py::arg("min_cut_sets") = MinCutSets{});
+
+    selector_mod.def("mcs_candidate", &selector::mcsCandidate,
+                "Check whether MCS can be the fastest engine of a pair before its cut sets are enumerated",
+                py::arg("model"), py::arg("src"), py::arg("dst"), py::arg("path_sets"));
+
+    selector_mod.def("select_engine", &selector::selectEngine,
+                "Select the predicted fastest engine for a single pair",
+                py::arg("model"), py::arg("path_sets"), py::arg("min_cut_sets") = MinCutSets{});
+
+    selector_mod.def("calibrate", 
+                [](const std::vector<std::pair<NodeID, NodeID>>& node_pairs, 
+                   const std::map<int, double>& probabilities, 
+                   const std::vector<PathSets>& pathsets_list,
+                   const std::vector<MinCutSets>& min_cut_sets_list,
+                   size_t samples, double budget) {
+                    ProbabilityMap probMap(probabilities); 
+                    return selector::calibrate(node_pairs, probMap, pathsets_list, min_cut_sets_list, samples, budget);
+                },
+                "Calibrate the cost model with a small run on the given pairs",
                 py::arg("node_pairs"), py::arg("probabilities"), py::arg("pathsets_list"),
+                py::arg("min_cut_sets_list") = std::vector<MinCutSets>{}, py::arg("samples") = 8, py::arg("budget") = 0.05,
+                py::call_guard<py::gil_scoped_release>());
+
+    selector_mod.def("calibrate_from_paths",
+                [](const std::vector<std::pair<NodeID, NodeID>>& node_pairs,
+                   const std::map<int, double>& probabilities,
+                   const std::vector<PathSets>& pathsets_list,
+                   size_t order, size_t samples, double budget) {
+                    ProbabilityMap probMap(probabilities);
+                    return selector::calibrateFromPaths(node_pairs, probMap, pathsets_list, order, samples, budget);
+                },
+                "Calibrate the cost model on the path sets, only the cut sets of the sampled pairs are enumerated",
+                py::arg("node_pairs"), py::arg("probabilities"), py::arg("pathsets_list"), py::arg("order") = 0,
+                py::arg("samples") = 8, py::arg("budget") = 0.05,
                 py::call_guard<py::gil_scoped_release>());
+
+    selector_mod.def("eval_avail", 
+                [](NodeID src, NodeID dst, const std::map<int, double>& probabilities, 
+                   const PathSets& path_sets, const MinCutSets& min_cut_sets, const CostModel& model,
+                   bool collect_stats) {
+                    ProbabilityMap probMap(probabilities); 
+                    stats::PairStats pairStats;
+                    auto result = selector::evalAvail(src, dst, probMap, path_sets, min_cut_sets, model, collect_stats ? &pairStats : nullptr);
+                    return withStats(std::move(result), pairStats, collect_stats);
+                },
+                "Evaluate availability for single source destination pair with the predicted fastest engine",
+                py::arg("src"), py::arg("dst"), py::arg("probabilities"), py::arg("path_sets"),
+                py::arg("min_cut_sets") = MinCutSets{}, py::arg("model") = CostModel{}, py::arg("stats") = false);
+
+    selector_mod.def("eval_avail_topo", 
+                [](const std::vector<std::pair<NodeID, NodeID>>& node_pairs, 
+                   const std::map<int, double>& probabilities, 
+                   const std::vector<PathSets>& pathsets_list,
+                   const std::vector<MinCutSets>& min_cut_sets_list,
+                   const CostModel& model,
+                   bool collect_stats) {
+                    ProbabilityMap probMap(probabilities); 
+                    std::vector<stats::PairStats> statsList;
+                    auto result = selector::evalAvailTopo(node_pairs, probMap, pathsets_list, min_cut_sets_list, model, collect_stats ? &statsList : nullptr);
+                    return withStats(std::move(result), statsList, collect_stats);
+                },
+                "Evaluate availability for each node pairs in topology with the predicted fastest engine per pair (serial)",
+                py::arg("node_pairs"), py::arg("probabilities"), py::arg("pathsets_list"),
+                py::arg("min_cut_sets_list") = std::vector<MinCutSets>{}, py::arg("model") = CostModel{}, py::arg("stats") = false);
+
+    selector_mod.def("eval_avail_topo_parallel", 
+                [](const std::vector<std::pair<NodeID, NodeID>>& node_pairs, 
+                   const std::map<int, double>& probabilities, 
+                   const std::vector<PathSets>& pathsets_list,
+                   const std::vector<MinCutSets>& min_cut_sets_list,
+                   const CostModel& model,
+                   bool collect_stats) {
+                    ProbabilityMap probMap(probabilities); 
+                    std::vector<stats::PairStats> statsList;
+                    auto result = [&] {
+                        py::gil_scoped_release release;
+                        return selector::evalAvailTopoParallel(node_pairs, probMap, pathsets_list, min_cut_sets_list, model, collect_stats ? &statsList : nullptr);
+                    }();
+                    return withStats(std::move(result), statsList, collect_stats);
+                },
+                "Evaluate availability for each node pairs in topology with the predicted fastest engine per pair (parallel)",
+                py::arg("node_pairs"), py::arg("probabilities"), py::arg("pathsets_list"),
+                py::arg("min_cut_sets_list") = std::vector<MinCutSets>{}, py::arg("model") = CostModel{}, py::arg("stats") = false);
+
+    // Path set enumeration
+    auto enumeration_mod = m.def_submodule("enumeration", "Module for the minimal path set enumeration");
+    enumeration_mod.doc() = "Module for the minimal path set enumeration";
+
+    py::class_<Graph>(enumeration_mod, "Graph")
+        .def(py::init<const std::vector<std::vector<NodeID>>&, const std::vector<std::vector<double>>&>(),
+             py::arg("adjacency"), py::arg("lengths") = std::vector<std::vector<double>>{})
+        .def_static("from_edges", &Graph::fromEdges, py::arg("num_nodes"), py::arg("edges"))
+        .def("size", &Graph::size)
+        .def("degree", &Graph::degree, py::arg("node"))
+        .def("is_weighted", &Graph::isWeighted)
+        .def("num_edges", &Graph::numEdges)
+        .def("edge_id", [](const Graph &g, NodeID u, NodeID v) { return g.edgeID(u, v); }, py::arg("u"), py::arg("v"))
+        .def("edge_ends", &Graph::edgeEnds, py::arg("edge"));
+
+    py::class_<enumeration::PathBound>(enumeration_mod, "PathBound")
+        .def(py::init([](size_t max_hops, double max_length) { return enumeration::PathBound{max_hops, max_length}; }),
+             py::arg("max_hops") = 0, py::arg("max_length") = 0.0)
+        .def_readwrite("max_hops", &enumeration::PathBound::maxHops)
+        .def_readwrite("max_length", &enumeration::PathBound::maxLength);
+
+    enumeration_mod.def("minimal_paths", &enumeration::minimalPaths,
+                "Enumerate the minimal path sets between source and destination (serial)",
+                py::arg("graph"), py::arg("src"), py::arg("dst"),
+                py::call_guard<py::gil_scoped_release>());
+
+    enumeration_mod.def("minimal_paths_parallel", &enumeration::minimalPathsParallel,
+                "Enumerate the minimal path sets between source and destination (parallel)",
+                py::arg("graph"), py::arg("src"), py::arg("dst"),
+                py::call_guard<py::gil_scoped_release>());
+
+    enumeration_mod.def("minimal_paths_topo", &enumeration::minimalPathsTopo,
+                "Enumerate the minimal path sets for each node pairs (serial)",
+                py::arg("graph"), py::arg("node_pairs"),
+                py::call_guard<py::gil_scoped_release>());
+
+    enumeration_mod.def("minimal_paths_topo_parallel", &enumeration::minimalPathsTopoParallel,
+                "Enumerate the minimal path sets for each node pairs (parallel)",
+                py::arg("graph"), py::arg("node_pairs"),
+                py::call_guard<py::gil_scoped_release>());
+
+    enumeration_mod.def("minimal_paths_from_source", &enumeration::minimalPathsFromSource,
+                "Enumerate the minimal path sets from a source to several destinations with a single DFS",
+                py::arg("graph"), py::arg("src"), py::arg("targets"),
+                py::call_guard<py::gil_scoped_release>());
+
+    enumeration_mod.def("minimal_paths_topo_from_sources", &enumeration::minimalPathsTopoFromSources,
+                "Enumerate the minimal path sets for each node pairs with one DFS per source (serial)",
+                py::arg("graph"), py::arg("node_pairs"),
+                py::call_guard<py::gil_scoped_release>());
+
+    enumeration_mod.def("minimal_paths_topo_from_sources_parallel", &enumeration::minimalPathsTopoFromSourcesParallel,
+                "Enumerate the minimal path sets for each node pairs with one DFS per source (parallel)",
+                py::arg("graph"), py::arg("node_pairs"),
+                py::call_guard<py::gil_scoped_release>());
+
+    enumeration_mod.def("bounded_paths", &enumeration::boundedPaths,
+                "Enumerate the minimal path sets within the hop or length bound between source and destination",
+                py::arg("graph"), py::arg("src"), py::arg("dst"), py::arg("bound"),
+                py::call_guard<py::gil_scoped_release>());
+
+    enumeration_mod.def("bounded_paths_topo", &enumeration::boundedPathsTopo,
+                "Enumerate the minimal path sets within the hop or length bound for each node pairs (serial)",
+                py::arg("graph"), py::arg("node_pairs"), py::arg("bound"),
+                py::call_guard<py::gil_scoped_release>());
+
+    enumeration_mod.def("bounded_paths_topo_parallel", &enumeration::boundedPathsTopoParallel,
+                "Enumerate the minimal path sets within the hop or length bound for each node pairs (parallel)",
+                py::arg("graph"), py::arg("node_pairs"), py::arg("bound"),
+                py::call_guard<py::gil_scoped_release>());
+
+    py::class_<enumeration::ProbablePaths>(enumeration_mod, "ProbablePaths")
+        .def_readonly("path_sets", &enumeration::ProbablePaths::pathSets)
+        .def_readonly("remaining", &enumeration::ProbablePaths::remaining)
+        .def_readonly("open", &enumeration::ProbablePaths::open)
+        .def_readonly("complete", &enumeration::ProbablePaths::complete)
+        .def("__repr__", [](const enumeration::ProbablePaths &p) {
+            return "<ProbablePaths path_sets=" + std::to_string(p.pathSets.size()) + " remaining=" + std::to_string(p.remaining) +
+                   " open=" + std::to_string(p.open) + " complete=" + std::string(p.complete ? "True" : "False") + ">";
+        });
+
+    enumeration_mod.def("probable_paths",
+                [](const Graph& graph, NodeID src, NodeID dst, const std::map<int, double>& probabilities,
+                   double epsilon, size_t max_paths) {
+                    ProbabilityMap probMap(probabilities);
+                    py::gil_scoped_release release;
+                    return enumeration::probablePaths(graph, src, dst, probMap, epsilon, max_paths);
+                },
+                "Enumerate the minimal path sets in decreasing order of probability until the paths left out are below epsilon",
+                py::arg("graph"), py::arg("src"), py::arg("dst"), py::arg("probabilities"), py::arg("epsilon") = 1e-9,
+                py::arg("max_paths") = 0);
+
+    enumeration_mod.def("link_paths",
+                [](const Graph& graph, NodeID src, NodeID dst, const std::map<int, double>& probabilities,
+                   const std::vector<double>& edge_probabilities) {
+                    ProbabilityMap probMap(probabilities, edge_probabilities);
+                    py::gil_scoped_release release;
+                    return enumeration::linkPaths(graph, src, dst, probMap);
+                },
+                "Enumerate the minimal path sets with the literals of the failing edges between their nodes",
+                py::arg("graph"), py::arg("src"), py::arg("dst"), py::arg("probabilities"), py::arg("edge_probabilities"));
+
+    enumeration_mod.def("link_paths_topo",
+                [](const Graph& graph, const std::vector<std::pair<NodeID, NodeID>>& node_pairs,
+                   const std::map<int, double>& probabilities, const std::vector<double>& edge_probabilities, bool parallel) {
+                    ProbabilityMap probMap(probabilities, edge_probabilities);
+                    py::gil_scoped_release release;
+                    return enumeration::linkPathsTopo(graph, node_pairs, probMap, parallel);
+                },
+                "Enumerate the minimal path sets with the literals of the failing edges for each node pair",
+                py::arg("graph"), py::arg("node_pairs"), py::arg("probabilities"), py::arg("edge_probabilities"),
+                py::arg("parallel") = true);
+
+    // Truncated evaluation on the most probable path sets
+    auto truncated_mod = m.def_submodule("truncated", "Module for the evaluation of the most probable path sets");
+    truncated_mod.doc() = "Module for the evaluation of the most probable path sets";
+
+    truncated_mod.def("eval_avail",
+                [](const Graph& graph, NodeID src, NodeID dst, const std::map<int, double>& probabilities,
+                   Engine engine, double epsilon, size_t max_paths, size_t order, bool collect_stats) {
+                    ProbabilityMap probMap(probabilities);
+                    stats::PairStats pairStats;
+                    auto result = [&] {
+                        py::gil_scoped_release release;
+                        return truncated::evalAvail(graph, src, dst, probMap, engine, epsilon, max_paths, order,
+                                                    collect_stats ? &pairStats : nullptr);
+                    }();
+                    return withStats(std::move(result), pairStats, collect_stats);
+                },
+                "Evaluate the availability bounds for single source destination pair from its most probable path sets",
+                py::arg("graph"), py::arg("src"), py::arg("dst"), py::arg("probabilities"), py::arg("engine") = Engine::SDP,
+                py::arg("epsilon") = 1e-9, py::arg("max_paths") = 0, py::arg("order") = 0, py::arg("stats") = false);
+
+    truncated_mod.def("eval_avail_topo",
+                [](const Graph& graph,
+                   const std::vector<std::pair<NodeID, NodeID>>& node_pairs,
+                   const std::map<int, double>& probabilities,
+                   Engine engine, double epsilon, size_t max_paths, size_t order, bool parallel, bool collect_stats) {
+                    ProbabilityMap probMap(probabilities);
+                    std::vector<stats::PairStats> statsList;
+                    auto result = [&] {
+                        py::gil_scoped_release release;
+                        return truncated::evalAvailTopo(graph, node_pairs, probMap, engine, epsilon, max_paths, order, parallel,
+                                                        collect_stats ? &statsList : nullptr);
+                    }();
+                    return withStats(std::move(result), statsList, collect_stats);
+                },
+                "Evaluate the availability bounds for each node pairs in topology from their most probable path sets",
+                py::arg("graph"), py::arg("node_pairs"), py::arg("probabilities"), py::arg("engine") = Engine::SDP,
+                py::arg("epsilon") = 1e-9, py::arg("max_paths") = 0, py::arg("order") = 0, py::arg("parallel") = true,
+                py::arg("stats") = false);
+
+    // Node and link failures
+    auto links_mod = m.def_submodule("links", "Module for the availability with node and link failures");
+    links_mod.doc() = "Module for the availability with node and link failures";
+
+    links_mod.def("eval_avail",
+                [](const Graph& graph, NodeID src, NodeID dst, const std::map<int, double>& probabilities,
+                   const std::vector<double>& edge_probabilities, Engine engine, size_t order, bool collect_stats) {
+                    ProbabilityMap probMap(probabilities, edge_probabilities);
+                    stats::PairStats pairStats;
+                    auto result = [&] {
+                        py::gil_scoped_release release;
+                        return links::evalAvail(graph, src, dst, probMap, engine, order, collect_stats ? &pairStats : nullptr);
+                    }();
+                    return withStats(std::move(result), pairStats, collect_stats);
+                },
+                "Evaluate availability for single source destination pair with node and link failures",
+                py::arg("graph"), py::arg("src"), py::arg("dst"), py::arg("probabilities"), py::arg("edge_probabilities"),
+                py::arg("engine") = Engine::SDP, py::arg("order") = 0, py::arg("stats") = false);
+
+    links_mod.def("eval_avail_topo",
+                [](const Graph& graph,
+                   const std::vector<std::pair<NodeID, NodeID>>& node_pairs,
+                   const std::map<int, double>& probabilities, const std::vector<double>& edge_probabilities,
+                   Engine engine, size_t order, bool parallel, bool collect_stats) {
+                    ProbabilityMap probMap(probabilities, edge_probabilities);
+                    std::vector<stats::PairStats> statsList;
+                    auto result = [&] {
+                        py::gil_scoped_release release;
+                        return links::evalAvailTopo(graph, node_pairs, probMap, engine, order, parallel,
+                                                    collect_stats ? &statsList : nullptr);
+                    }();
+                    return withStats(std::move(result), statsList, collect_stats);
+                },
+                "Evaluate availability for each node pairs in topology with node and link failures",
+                py::arg("graph"), py::arg("node_pairs"), py::arg("probabilities"), py::arg("edge_probabilities"),
+                py::arg("engine") = Engine::SDP, py::arg("order") = 0, py::arg("parallel") = true,
+                py::arg("stats") = false);
+
+    // End-to-end all-pairs evaluation
+    auto allpairs_mod = m.def_submodule("allpairs", "Module for the end-to-end all-pairs evaluation");
+    allpairs_mod.doc() = "Module for the end-to-end all-pairs evaluation";
+
+    allpairs_mod.def("eval_avail_matrix",
+                [](py::array_t<int64_t, py::array::c_style | py::array::forcecast> edges,
+                   py::array_t<double, py::array::c_style | py::array::forcecast> probabilities,
+                   const std::optional<std::vector<allpairs::Label>>& nodes,
+                   Engine engine, bool parallel) {
+                    if (edges.ndim() != 2 || edges.shape(1) != 2)
+                    {
+                        throw py::value_error("edges must have the shape (m, 2)");
+                    }
+
+                    // Copy the inputs before the GIL is released, the node labels default to 0..n-1
+                    allpairs::LabelEdges edgeList(edges.shape(0));
+                    const int64_t *edgeData = edges.data();
+                    for (size_t i = 0; i < edgeList.size(); ++i)
+                    {
+                        edgeList[i] = {edgeData[2 * i], edgeData[2 * i + 1]};
+                    }
+                    std::vector<double> probaList(probabilities.data(), probabilities.data() + probabilities.size());
+                    std::vector<allpairs::Label> nodeList;
+                    if (nodes)
+                    {
+                        nodeList = *nodes;
+                    }
+                    else
+                    {
+                        nodeList.resize(probaList.size());
+                        std::iota(nodeList.begin(), nodeList.end(), 0);
+                    }
+
+                    allpairs::AvailMatrix matrix;
+                    {
+                        py::gil_scoped_release release;
+                        matrix = allpairs::evalAvailMatrix(nodeList, edgeList, probaList, engine, parallel);
+                    }
+
+                    py::ssize_t n = static_cast<py::ssize_t>(matrix.numNodes);
+                    py::array_t<double> result(std::vector<py::ssize_t>{n, n});
+                    std::copy(matrix.values.begin(), matrix.values.end(), result.mutable_data());
+                    return result;
+                },
+                "Evaluate the availability of all pairs in C++ and return the dense (n, n) matrix",
+                py::arg("edges"), py::arg("probabilities"), py::arg("nodes") = py::none(),
+                py::arg("engine") = Engine::SDP, py::arg("parallel") = true);
+
+    // Demand-weighted reductions
+    auto demand_mod = m.def_submodule("demand", "Module for the demand-weighted network availability");
+    demand_mod.doc() = "Module for the demand-weighted network availability";
+
+    py::class_<demand::DemandSummary>(demand_mod, "DemandSummary")
+        .def(py::init<>())
+        .def_readonly("demands", &demand::DemandSummary::demands)
+        .def_readonly("pairs", &demand::DemandSummary::pairs)
+        .def_readonly("total_demand", &demand::DemandSummary::totalDemand)
+        .def_readonly("weighted_mean", &demand::DemandSummary::weightedMean)
+        .def_readonly("minimum", &demand::DemandSummary::minimum)
+        .def_readonly("worst", &demand::DemandSummary::worst)
+        .def_readonly("per_source", &demand::DemandSummary::perSource)
+        .def("to_dict", [](const demand::DemandSummary &s) {
+            py::dict d;
+            d["demands"] = s.demands;
+            d["pairs"] = s.pairs;
+            d["total_demand"] = s.totalDemand;
+            d["weighted_mean"] = s.weightedMean;
+            d["minimum"] = s.minimum;
+            d["worst"] = s.worst;
+            d["per_source"] = s.perSource;
+            return d;
+        })
+        .def("__repr__", [](const demand::DemandSummary &s) {
+            return "<DemandSummary demands=" + std::to_string(s.demands) + " pairs=" + std::to_string(s.pairs) +
+                   " weighted_mean=" + std::to_string(s.weightedMean) + ">";
+        });
+
+    // The demands are passed as (src, dst, weight) tuples
+    using DemandTriples = std::vector<std::tuple<NodeID, NodeID, double>>;
+    auto toDemands = [](const DemandTriples &triples) {
+        demand::Demands demands;
+        demands.reserve(triples.size());
+        for (const auto &[src, dst, weight] : triples)
+        {
+            demands.push_back({src, dst, weight});
+        }
+        return demands;
+    };
+
+    demand_mod.def("demands_from_matrix",
+                [](py::array_t<double, py::array::c_style | py::array::forcecast> matrix) {
+                    if (matrix.ndim() != 2 || matrix.shape(0) != matrix.shape(1))
+                    {
+                        throw py::value_error("matrix must have the shape (n, n)");
+                    }
+                    std::vector<double> values(matrix.data(), matrix.data() + matrix.size());
+                    DemandTriples triples;
+                    for (const auto &d : demand::fromMatrix(values, matrix.shape(0)))
+                    {
+                        triples.emplace_back(d.src, d.dst, d.weight);
+                    }
+                    return triples;
+                },
+                "Read the (src, dst, weight) demands of a dense (n, n) matrix, row and column i is the node ID i + 1",
+                py::arg("matrix"));
+
+    demand_mod.def("reduce",
+                [toDemands](const std::vector<AvailTriple>& avail_list, const DemandTriples& demands,
+                            bool mean, bool minimum, size_t worst, bool per_source, bool parallel) {
+                    demand::Reductions reductions{mean, minimum, worst, per_source};
+                    demand::Demands demandList = toDemands(demands);
+                    py::gil_scoped_release release;
+                    return demand::reduce(avail_list, demandList, reductions, parallel);
+                },
+                "Reduce the availability of evaluated pairs over the demands",
+                py::arg("avail_list"), py::arg("demands"), py::arg("mean") = true, py::arg("minimum") = true,
+                py::arg("worst") = 0, py::arg("per_source") = false, py::arg("parallel") = true);
+
+    demand_mod.def("eval_avail_topo",
+                [toDemands](const Graph& graph, const DemandTriples& demands, const std::map<int, double>& probabilities,
+                            bool mean, bool minimum, size_t worst, bool per_source, Engine engine, size_t order, bool parallel) {
+                    ProbabilityMap probMap(probabilities);
+                    demand::Reductions reductions{mean, minimum, worst, per_source};
+                    demand::Demands demandList = toDemands(demands);
+                    py::gil_scoped_release release;
+                    return demand::evalAvailTopo(graph, demandList, probMap, reductions, engine, order, parallel);
+                },
+                "Evaluate the pairs with a positive demand and reduce their availability over the demands",
+                py::arg("graph"), py::arg("demands"), py::arg("probabilities"), py::arg("mean") = true,
+                py::arg("minimum") = true, py::arg("worst") = 0, py::arg("per_source") = false,
+                py::arg("engine") = Engine::SDP, py::arg("order") = 0, py::arg("parallel") = true);
+
+    // Pipelined enumeration and evaluation
+    auto pipeline_mod = m.def_submodule("pipeline", "Module for the pipelined enumeration and evaluation");
+    pipeline_mod.doc() = "Module for the pipelined enumeration and evaluation";
+
+    py::class_<pipeline::PipelineInfo>(pipeline_mod, "PipelineInfo")
+        .def(py::init<>())
+        .def_readonly("capacity", &pipeline::PipelineInfo::capacity)
+        .def_readonly("peak_pending", &pipeline::PipelineInfo::peakPending)
+        .def_readonly("full_waits", &pipeline::PipelineInfo::fullWaits)
+        .def("__repr__", [](const pipeline::PipelineInfo &i) {
+            return "<PipelineInfo capacity=" + std::to_string(i.capacity) + " peak_pending=" + std::to_string(i.peakPending) +
+                   " full_waits=" + std::to_string(i.fullWaits) + ">";
+        });
+
+    pipeline_mod.def("eval_avail_topo",
+                [](const Graph& graph,
+                   const std::vector<std::pair<NodeID, NodeID>>& node_pairs,
+                   const std::map<int, double>& probabilities,
+                   Engine engine, size_t capacity, size_t order, bool parallel,
+                   pipeline::PipelineInfo* info,
+                   bool collect_stats) {
+                    ProbabilityMap probMap(probabilities);
+                    std::vector<stats::PairStats> statsList;
+                    auto result = [&] {
+                        py::gil_scoped_release release;
+                        // Only the sets of the queued pairs and the pairs in progress are held at the same time
+                        return pipeline::evalAvailTopo(graph, node_pairs, probMap, engine, capacity, order, parallel,
+                                                       collect_stats ? &statsList : nullptr, info);
+                    }();
+                    return withStats(std::move(result), statsList, collect_stats);
+                },
+                "Enumerate and evaluate availability for each node pairs in topology with a bounded queue between the stages",
+                py::arg("graph"), py::arg("node_pairs"), py::arg("probabilities"), py::arg("engine") = Engine::SDP,
+                py::arg("capacity") = 64, py::arg("order") = 0, py::arg("parallel") = true,
+                py::arg("info") = nullptr, py::arg("stats") = false);
+
+    // Block-cut tree decomposition
+    auto blockcut_mod = m.def_submodule("blockcut", "Module for the block-cut tree decomposition");
+    blockcut_mod.doc() = "Module for the block-cut tree decomposition";
+
+    py::class_<blockcut::BlockCutTree>(blockcut_mod, "BlockCutTree")
+        .def_readonly("blocks", &blockcut::BlockCutTree::blocks)
+        .def_property_readonly("cut_vertices", [](const blockcut::BlockCutTree &tree) {
+            std::vector<NodeID> cutVertices;
+            for (NodeID node = 1; node < static_cast<NodeID>(tree.blocksOf.size()); ++node)
+            {
+                if (tree.isCut(node))
+                {
+                    cutVertices.push_back(node);
+                }
+            }
+            return cutVertices;
+        });
+
+    py::class_<blockcut::DecompositionInfo>(blockcut_mod, "DecompositionInfo")
+        .def(py::init<>())
+        .def_readonly("num_blocks", &blockcut::DecompositionInfo::numBlocks)
+        .def_readonly("num_cut_vertices", &blockcut::DecompositionInfo::numCutVertices)
+        .def_readonly("block_evaluations", &blockcut::DecompositionInfo::blockEvaluations)
+        .def_readonly("path_sets", &blockcut::DecompositionInfo::pathSets)
+        .def("__repr__", [](const blockcut::DecompositionInfo &i) {
+            return "<DecompositionInfo num_blocks=" + std::to_string(i.numBlocks) + " num_cut_vertices=" + std::to_string(i.numCutVertices) +
+                   " block_evaluations=" + std::to_string(i.blockEvaluations) + " path_sets=" + std::to_string(i.pathSets) + ">";
+        });
+
+    blockcut_mod.def("biconnected_components", &blockcut::biconnectedComponents,
+                "Compute the biconnected blocks and the cut vertices of the graph",
+                py::arg("graph"));
+
+    blockcut_mod.def("eval_avail_topo",
+                [](const Graph& graph,
+                   const std::vector<std::pair<NodeID, NodeID>>& node_pairs,
+                   const std::map<int, double>& probabilities,
+                   Engine engine, bool parallel,
+                   blockcut::DecompositionInfo* info) {
+                    ProbabilityMap probMap(probabilities);
+                    py::gil_scoped_release release;
+                    return blockcut::evalAvailTopo(graph, node_pairs, probMap, engine, parallel, info);
+                },
+                "Evaluate availability for each node pairs in topology as product over the blocks of the block-cut tree",
+                py::arg("graph"), py::arg("node_pairs"), py::arg("probabilities"), py::arg("engine") = Engine::SDP,
+                py::arg("parallel") = true, py::arg("info") = nullptr);
+
+    // Series-parallel reduction
+    auto reduction_mod = m.def_submodule("reduction", "Module for the series-parallel graph reduction");
+    reduction_mod.doc() = "Module for the series-parallel graph reduction";
+
+    py::class_<reduction::ReducedPair>(reduction_mod, "ReducedPair")
+        .def_readonly("graph", &reduction::ReducedPair::graph)
+        .def_readonly("availability", &reduction::ReducedPair::availability)
+        .def_readonly("members", &reduction::ReducedPair::members)
+        .def_readonly("src", &reduction::ReducedPair::src)
+        .def_readonly("dst", &reduction::ReducedPair::dst);
+
+    py::class_<reduction::ReductionInfo>(reduction_mod, "ReductionInfo")
+        .def(py::init<>())
+        .def_readonly("original_nodes", &reduction::ReductionInfo::originalNodes)
+        .def_readonly("reduced_nodes", &reduction::ReductionInfo::reducedNodes)
+        .def_readonly("path_sets", &reduction::ReductionInfo::pathSets)
+        .def_property_readonly("ratio", &reduction::ReductionInfo::ratio)
+        .def("__repr__", [](const reduction::ReductionInfo &i) {
+            return "<ReductionInfo original_nodes=" + std::to_string(i.originalNodes) + " reduced_nodes=" + std::to_string(i.reducedNodes) +
+                   " ratio=" + std::to_string(i.ratio()) + " path_sets=" + std::to_string(i.pathSets) + ">";
+        });
+
+    reduction_mod.def("reduce_pair",
+                [](const Graph& graph, NodeID src, NodeID dst, const std::map<int, double>& probabilities) {
+                    ProbabilityMap probMap(probabilities);
+                    return reduction::reducePair(graph, src, dst, probMap);
+                },
+                "Reduce the graph of a single source destination pair with the series-parallel rules",
+                py::arg("graph"), py::arg("src"), py::arg("dst"), py::arg("probabilities"));
+
+    reduction_mod.def("eval_avail_topo",
+                [](const Graph& graph,
+                   const std::vector<std::pair<NodeID, NodeID>>& node_pairs,
+                   const std::map<int, double>& probabilities,
+                   Engine engine, bool parallel,
+                   reduction::ReductionInfo* info) {
+                    ProbabilityMap probMap(probabilities);
+                    py::gil_scoped_release release;
+                    return reduction::evalAvailTopo(graph, node_pairs, probMap, engine, parallel, info);
+                },
+                "Evaluate availability for each node pairs in topology on the series-parallel reduced graph of every pair",
+                py::arg("graph"), py::arg("node_pairs"), py::arg("probabilities"), py::arg("engine") = Engine::SDP,
+                py::arg("parallel") = true, py::arg("info") = nullptr);
+
+    // Module detection on the sets
+    auto modules_mod = m.def_submodule("modules", "Module for the module detection on the path sets and cut sets");
+    modules_mod.doc() = "Module for the module detection on the path sets and cut sets";
+
+    py::class_<modules::ModularSets>(modules_mod, "ModularSets")
+        .def_readonly("sets", &modules::ModularSets::sets)
+        .def_readonly("availability", &modules::ModularSets::availability)
+        .def_readonly("members", &modules::ModularSets::members)
+        .def_readonly("multiplier", &modules::ModularSets::multiplier)
+        .def_readonly("mandatory", &modules::ModularSets::mandatory);
+
+    py::class_<modules::ModuleInfo>(modules_mod, "ModuleInfo")
+        .def(py::init<>())
+        .def_readonly("nodes", &modules::ModuleInfo::nodes)
+        .def_readonly("literals", &modules::ModuleInfo::literals)
+        .def_readonly("mandatory", &modules::ModuleInfo::mandatory)
+        .def_readonly("path_sets", &modules::ModuleInfo::pathSets)
+        .def("__repr__", [](const modules::ModuleInfo &i) {
+            return "<ModuleInfo nodes=" + std::to_string(i.nodes) + " literals=" + std::to_string(i.literals) +
+                   " mandatory=" + std::to_string(i.mandatory) + " path_sets=" + std::to_string(i.pathSets) + ">";
+        });
+
+    modules_mod.def("collapse_path_sets",
+                [](const PathSets& path_sets, NodeID src, NodeID dst, const std::map<int, double>& probabilities) {
+                    ProbabilityMap probMap(probabilities);
+                    return modules::collapsePathSets(path_sets, src, dst, probMap);
+                },
+                "Collapse the modules of the path sets of a pair into synthetic literals",
+                py::arg("path_sets"), py::arg("src"), py::arg("dst"), py::arg("probabilities"));
+
+    modules_mod.def("collapse_cut_sets",
+                [](const MinCutSets& min_cut_sets, NodeID src, NodeID dst, const std::map<int, double>& probabilities) {
+                    ProbabilityMap probMap(probabilities);
+                    return modules::collapseCutSets(min_cut_sets, src, dst, probMap);
+                },
+                "Collapse the modules of the minimal cut sets of a pair into synthetic literals",
+                py::arg("min_cut_sets"), py::arg("src"), py::arg("dst"), py::arg("probabilities"));
+
+    modules_mod.def("eval_avail",
+                [](Engine engine, NodeID src, NodeID dst, const std::map<int, double>& probabilities,
+                   const PathSets& path_sets, const MinCutSets& min_cut_sets, bool collect_stats) {
+                    ProbabilityMap probMap(probabilities);
+                    stats::PairStats pairStats;
+                    auto result = modules::evalAvailWith(engine, src, dst, probMap, path_sets, min_cut_sets, collect_stats ? &pairStats : nullptr);
+                    return withStats(std::move(result), pairStats, collect_stats);
+                },
+                "Evaluate availability for single source destination pair with the engine on the collapsed sets",
+                py::arg("engine"), py::arg("src"), py::arg("dst"), py::arg("probabilities"),
+                py::arg("path_sets") = PathSets{}, py::arg("min_cut_sets") = MinCutSets{}, py::arg("stats") = false);
+
+    modules_mod.def("eval_avail_topo",
+                [](const Graph& graph,
+                   const std::vector<std::pair<NodeID, NodeID>>& node_pairs,
+                   const std::map<int, double>& probabilities,
+                   Engine engine, size_t order, bool parallel,
+                   modules::ModuleInfo* info,
+                   bool collect_stats) {
+                    ProbabilityMap probMap(probabilities);
+                    std::vector<stats::PairStats> statsList;
+                    auto result = [&] {
+                        py::gil_scoped_release release;
+                        return modules::evalAvailTopo(graph, node_pairs, probMap, engine, order, parallel,
+                                                      collect_stats ? &statsList : nullptr, info);
+                    }();
+                    return withStats(std::move(result), statsList, collect_stats);
+                },
+                "Enumerate the sets and evaluate availability for each node pairs in topology on the collapsed sets",
+                py::arg("graph"), py::arg("node_pairs"), py::arg("probabilities"), py::arg("engine") = Engine::SDP,
+                py::arg("order") = 0, py::arg("parallel") = true, py::arg("info") = nullptr, py::arg("stats") = false);
+
+    // Automorphism-aware reuse across equivalent pairs
+    auto symmetry_mod = m.def_submodule("symmetry", "Module for the automorphism orbits of the node pairs");
+    symmetry_mod.doc() = "Module for the automorphism orbits of the node pairs";
+
+    py::class_<symmetry::Automorphisms>(symmetry_mod, "Automorphisms")
+        .def_readonly("generators", &symmetry::Automorphisms::generators)
+        .def_readonly("orbit_of", &symmetry::Automorphisms::orbitOf)
+        .def_readonly("complete", &symmetry::Automorphisms::complete);
+
+    py::class_<symmetry::SymmetryInfo>(symmetry_mod, "SymmetryInfo")
+        .def(py::init<>())
+        .def_readonly("generators", &symmetry::SymmetryInfo::generators)
+        .def_readonly("orbits", &symmetry::SymmetryInfo::orbits)
+        .def_readonly("complete", &symmetry::SymmetryInfo::complete)
+        .def("__repr__", [](const symmetry::SymmetryInfo &i) {
+            return "<SymmetryInfo generators=" + std::to_string(i.generators) + " orbits=" + std::to_string(i.orbits) +
+                   " complete=" + std::string(i.complete ? "True" : "False") + ">";
+        });
+
+    symmetry_mod.def("automorphisms",
+                [](const Graph& graph, const std::map<int, double>& probabilities, size_t budget) {
+                    ProbabilityMap probMap(probabilities);
+                    return symmetry::automorphisms(graph, probMap, budget);
+                },
+                "Compute generators of the automorphism group that preserve the node availabilities",
+                py::arg("graph"), py::arg("probabilities"), py::arg("budget") = symmetry::DEFAULT_SEARCH_BUDGET);
+
+    symmetry_mod.def("pair_orbits", &symmetry::pairOrbits,
+                "Index of the representative pair of every pair under the automorphisms",
+                py::arg("node_pairs"), py::arg("automorphisms"));
+
+    symmetry_mod.def("eval_avail_topo",
+                [](const Graph& graph,
+                   const std::vector<std::pair<NodeID, NodeID>>& node_pairs,
+                   const std::map<int, double>& probabilities,
+                   Engine engine, size_t order, bool parallel, size_t budget,
+                   symmetry::SymmetryInfo* info) {
+                    ProbabilityMap probMap(probabilities);
+                    py::gil_scoped_release release;
+                    return symmetry::evalAvailTopo(graph, node_pairs, probMap, engine, order, parallel, budget, info);
+                },
+                "Evaluate availability of one representative pair per automorphism orbit and copy it to the orbit",
+                py::arg("graph"), py::arg("node_pairs"), py::arg("probabilities"), py::arg("engine") = Engine::SDP,
+                py::arg("order") = 0, py::arg("parallel") = true, py::arg("budget") = symmetry::DEFAULT_SEARCH_BUDGET,
+                py::arg("info") = nullptr);
+
+    // Exhaustive state enumeration
+    auto exhaustive_mod = m.def_submodule("exhaustive", "Module for the exhaustive Gray-code state enumeration");
+    exhaustive_mod.doc() = "Module for the exhaustive Gray-code state enumeration";
+
+    py::class_<exhaustive::ExhaustiveInfo>(exhaustive_mod, "ExhaustiveInfo")
+        .def(py::init<>())
+        .def_readonly("exhaustive_pairs", &exhaustive::ExhaustiveInfo::exhaustivePairs)
+        .def_readonly("engine_pairs", &exhaustive::ExhaustiveInfo::enginePairs)
+        .def_readonly("states", &exhaustive::ExhaustiveInfo::states)
+        .def("__repr__", [](const exhaustive::ExhaustiveInfo &i) {
+            return "<ExhaustiveInfo exhaustive_pairs=" + std::to_string(i.exhaustivePairs) + " engine_pairs=" + std::to_string(i.enginePairs) +
+                   " states=" + std::to_string(i.states) + ">";
+        });
+
+    exhaustive_mod.def("components", &exhaustive::components,
+                "Nodes whose state can change the connectivity of the pair",
+                py::arg("graph"), py::arg("src"), py::arg("dst"));
+
+    exhaustive_mod.def("eval_avail",
+                [](const Graph& graph, NodeID src, NodeID dst, const std::map<int, double>& probabilities,
+                   bool parallel, bool collect_stats) {
+                    ProbabilityMap probMap(probabilities);
+                    stats::PairStats pairStats;
+                    auto result = [&] {
+                        py::gil_scoped_release release;
+                        return exhaustive::evalAvail(graph, src, dst, probMap, parallel, collect_stats ? &pairStats : nullptr);
+                    }();
+                    return withStats(std::move(result), pairStats, collect_stats);
+                },
+                "Evaluate availability for single source destination pair by enumerating all states of its components",
+                py::arg("graph"), py::arg("src"), py::arg("dst"), py::arg("probabilities"), py::arg("parallel") = false,
+                py::arg("stats") = false);
+
+    exhaustive_mod.def("eval_avail_topo",
+                [](const Graph& graph,
+                   const std::vector<std::pair<NodeID, NodeID>>& node_pairs,
+                   const std::map<int, double>& probabilities,
+                   bool parallel, bool collect_stats) {
+                    ProbabilityMap probMap(probabilities);
+                    std::vector<stats::PairStats> statsList;
+                    auto result = [&] {
+                        py::gil_scoped_release release;
+                        return exhaustive::evalAvailTopo(graph, node_pairs, probMap, parallel, collect_stats ? &statsList : nullptr);
+                    }();
+                    return withStats(std::move(result), statsList, collect_stats);
+                },
+                "Evaluate availability for each node pairs in topology by enumerating all states of their components",
+                py::arg("graph"), py::arg("node_pairs"), py::arg("probabilities"), py::arg("parallel") = true,
+                py::arg("stats") = false);
+
+    exhaustive_mod.def("eval_avail_topo_graph",
+                [](const Graph& graph,
+                   const std::vector<std::pair<NodeID, NodeID>>& node_pairs,
+                   const std::map<int, double>& probabilities,
+                   Engine engine, size_t threshold, size_t order, bool parallel,
+                   exhaustive::ExhaustiveInfo* info) {
+                    ProbabilityMap probMap(probabilities);
+                    py::gil_scoped_release release;
+                    return exhaustive::evalAvailTopoGraph(graph, node_pairs, probMap, engine, threshold, order, parallel, info);
+                },
+                "Evaluate availability for each node pairs in topology, the small pairs by exhaustive enumeration and the others with the engine",
+                py::arg("graph"), py::arg("node_pairs"), py::arg("probabilities"), py::arg("engine") = Engine::SDP,
+                py::arg("threshold") = exhaustive::DEFAULT_THRESHOLD, py::arg("order") = 0, py::arg("parallel") = true,
+                py::arg("info") = nullptr);
+
+    // Incremental re-evaluation
+    auto incremental_mod = m.def_submodule("incremental", "Module for the incremental re-evaluation on topology edits");
+    incremental_mod.doc() = "Module for the incremental re-evaluation on topology edits";
+
+    py::class_<incremental::IncrementalInfo>(incremental_mod, "IncrementalInfo")
+        .def(py::init<>())
+        .def_readonly("edits", &incremental::IncrementalInfo::edits)
+        .def_readonly("enumerations", &incremental::IncrementalInfo::enumerations)
+        .def_readonly("evaluations", &incremental::IncrementalInfo::evaluations)
+        .def_readonly("last_dirty", &incremental::IncrementalInfo::lastDirty)
+        .def("__repr__", [](const incremental::IncrementalInfo &i) {
+            return "<IncrementalInfo edits=" + std::to_string(i.edits) + " enumerations=" + std::to_string(i.enumerations) +
+                   " evaluations=" + std::to_string(i.evaluations) + " last_dirty=" + std::to_string(i.lastDirty) + ">";
+        });
+
+    py::class_<incremental::IncrementalTopology>(incremental_mod, "IncrementalTopology")
+        .def(py::init<int, const std::vector<incremental::Edge>&, const std::map<int, double>&, const NodePairs&, Engine, size_t, bool>(),
+             py::arg("num_nodes"), py::arg("edges"), py::arg("probabilities"), py::arg("node_pairs"),
+             py::arg("engine") = Engine::SDP, py::arg("order") = 0, py::arg("parallel") = true)
+        .def("add_edge", &incremental::IncrementalTopology::addEdge,
+             "Add an edge and mark the pairs with a simple path through it dirty, return the number of new dirty pairs",
+             py::arg("u"), py::arg("v"))
+        .def("remove_edge", &incremental::IncrementalTopology::removeEdge,
+             "Remove an edge and mark the pairs with a path set using it dirty, return the number of new dirty pairs",
+             py::arg("u"), py::arg("v"))
+        .def("set_availability", &incremental::IncrementalTopology::setAvailability,
+             "Change the availability of a node and mark the pairs with a path set containing it dirty",
+             py::arg("node"), py::arg("availability"))
+        .def("evaluate", &incremental::IncrementalTopology::evaluate,
+             "Refresh the dirty pairs and return the availability of every pair",
+             py::call_guard<py::gil_scoped_release>())
+        .def("dirty_pairs", &incremental::IncrementalTopology::dirtyPairs,
+             "Indices of the pairs refreshed by the next evaluate()")
+        .def("pairs_of_node", &incremental::IncrementalTopology::pairsOfNode,
+             "Indices of the pairs with a path set containing the node", py::arg("node"))
+        .def("pairs_of_edge", &incremental::IncrementalTopology::pairsOfEdge,
+             "Indices of the pairs with a path set using the edge", py::arg("u"), py::arg("v"))
+        .def("graph", &incremental::IncrementalTopology::currentGraph, "The current topology",
+             py::return_value_policy::reference_internal)
+        .def("info", &incremental::IncrementalTopology::info, "Counters of the edits and evaluations",
+             py::return_value_policy::reference_internal);
+
+    // Hardware performance counters
+    auto perf_mod = m.def_submodule("perf", "Module for the hardware performance counters");
+    perf_mod.doc() = "Module for the hardware performance counters";
+
+    py::class_<perf::Counters>(perf_mod, "Counters")
+        .def_readonly("cycles", &perf::Counters::cycles)
+        .def_readonly("instructions", &perf::Counters::instructions)
+        .def_readonly("llc_misses", &perf::Counters::llcMisses)
+        .def_readonly("branch_misses", &perf::Counters::branchMisses)
+        .def_readonly("calls", &perf::Counters::calls)
+        .def("to_dict", [](const perf::Counters &c) {
+            py::dict d;
+            d["cycles"] = c.cycles;
+            d["instructions"] = c.instructions;
+            d["llc_misses"] = c.llcMisses;
+            d["branch_misses"] = c.branchMisses;
+            d["calls"] = c.calls;
+            return d;
+        })
+        .def("__repr__", [](const perf::Counters &c) {
+            return "<Counters cycles=" + std::to_string(c.cycles) + " instructions=" + std::to_string(c.instructions) +
+                   " llc_misses=" + std::to_string(c.llcMisses) + " branch_misses=" + std::to_string(c.branchMisses) +
+                   " calls=" + std::to_string(c.calls) + ">";
+        });
+
+    py::class_<perf::ThreadReport>(perf_mod, "ThreadReport")
+        .def_readonly("thread_index", &perf::ThreadReport::threadIndex)
+        .def_readonly("tid", &perf::ThreadReport::tid)
+        .def_property_readonly("stages", [](const perf::ThreadReport &r) { return stagesToDict(r.stages); });
+
+    perf_mod.def("is_available", &perf::isAvailable,
+                 "Check if the hardware counters can be opened (perf_event_open)");
+
+    perf_mod.def("unavailable_reason", &perf::unavailableReason,
+                 "Get the reason why the hardware counters are not available, empty if they are available");
+
+    perf_mod.def("enable", &perf::enable,
+                 "Enable the hardware counters of the pipeline stages, returns False if they are not available");
+
+    perf_mod.def("disable", &perf::disable,
+                 "Disable the hardware counters, the collected values are kept");
+
+    perf_mod.def("is_enabled", &perf::isEnabled,
+                 "Check if the hardware counters are enabled");
+
+    perf_mod.def("reset", &perf::reset,
+                 "Reset the collected counters of all threads");
+
+    perf_mod.def("report", &perf::report,
+                 "Get the collected counters per thread and stage");
+
+    perf_mod.def("summary", []() { return stagesToDict(perf::summary()); },
+                 "Get the collected counters per stage summed over all threads");
 }
\ No newline at end of file
@@ -0,0 +1,355 @@
+#include <pyrbd_plusplus/blockcut.hpp>
+#include <pyrbd_plusplus/enumeration.hpp>
+#include <queue>
+#include <tuple>
+#include <omp.h>
+
+namespace pyrbdpp::blockcut
+{
+    BlockCutTree biconnectedComponents(const Graph &graph)
+    {
+        int numNodes = graph.size();
+        BlockCutTree tree;
+        tree.blocksOf.resize(numNodes + 1);
+
+        auto addBlock = [&tree](Set block)
+        {
+            std::sort(block.begin(), block.end());
+            for (NodeID node : block)
+            {
+                tree.blocksOf[node].push_back(static_cast<int>(tree.blocks.size()));
+            }
+            tree.blocks.push_back(std::move(block));
+        };
+
+        std::vector<int> disc(numNodes + 1, 0);
+        std::vector<int> low(numNodes + 1, 0);
+        std::vector<char> inBlock(numNodes + 1, 0);
+        std::vector<std::pair<NodeID, NodeID>> edgeStack;
+        int timer = 0;
+
+        // Pop the edges of the block closed by the tree edge (parent, child)
+        auto closeBlock = [&](NodeID parent, NodeID child)
+        {
+            Set block;
+            std::pair<NodeID, NodeID> edge;
+            do
+            {
+                edge = edgeStack.back();
+                edgeStack.pop_back();
+                for (NodeID node : {edge.first, edge.second})
+                {
+                    if (!inBlock[node])
+                    {
+                        inBlock[node] = 1;
+                        block.push_back(node);
+                    }
+                }
+            } while (edge != std::make_pair(parent, child));
+
+            for (NodeID node : block)
+            {
+                inBlock[node] = 0;
+            }
+            addBlock(std::move(block));
+        };
+
+        // Iterative DFS, every frame keeps the next neighbor to visit
+        struct Frame
+        {
+            NodeID node;
+            NodeID parent;
+            const NodeID *next;
+        };
+        std::vector<Frame> frames;
+
+        for (NodeID root = 1; root <= numNodes; ++root)
+        {
+            if (disc[root])
+            {
+                continue;
+            }
+            disc[root] = low[root] = ++timer;
+
+            // An isolated node is a block on its own
+            if (graph.degree(root) == 0)
+            {
+                addBlock({root});
+                continue;
+            }
+
+            frames.push_back({root, 0, graph.begin(root)});
+            while (!frames.empty())
+            {
+                Frame &frame = frames.back();
+                NodeID node = frame.node;
+                if (frame.next != graph.end(node))
+                {
+                    NodeID next = *frame.next++;
+                    if (!disc[next])
+                    {
+                        // Tree edge
+                        edgeStack.emplace_back(node, next);
+                        disc[next] = low[next] = ++timer;
+                        frames.push_back({next, node, graph.begin(next)});
+                    }
+                    else if (next != frame.parent && disc[next] < disc[node])
+                    {
+                        // Back edge to an ancestor
+                        edgeStack.emplace_back(node, next);
+                        low[node] = std::min(low[node], disc[next]);
+                    }
+                }
+                else
+                {
+                    NodeID parent = frame.parent;
+                    frames.pop_back();
+                    if (parent)
+                    {
+                        low[parent] = std::min(low[parent], low[node]);
+                        if (low[node] >= disc[parent])
+                        {
+                            closeBlock(parent, node);
+                        }
+                    }
+                }
+            }
+        }
+
+        return tree;
+    }
+
+    // A block evaluation, entry < exit since the availability is symmetric
+    using BlockKey = std::tuple<int, NodeID, NodeID>;
+
+    // Build the subgraph of a block with the local node IDs 1..k in the order of the block
+    static Graph blockGraph(const Graph &graph, const Set &block)
+    {
+        std::vector<std::pair<NodeID, NodeID>> edges;
+        for (size_t i = 0; i < block.size(); ++i)
+        {
+            for (const NodeID *it = graph.begin(block[i]); it != graph.end(block[i]); ++it)
+            {
+                // An edge between two nodes of the block always belongs to the block
+                auto pos = std::lower_bound(block.begin(), block.end(), *it);
+                if (*it > block[i] && pos != block.end() && *pos == *it)
+                {
+                    edges.emplace_back(static_cast<NodeID>(i + 1), static_cast<NodeID>(pos - block.begin() + 1));
+                }
+            }
+        }
+        return Graph::fromEdges(static_cast<int>(block.size()), edges);
+    }
+
+    // Evaluate the availability between entry and exit inside the block, given that both are working
+    static double evalBlock(const Graph &localGraph, const Set &block, NodeID entry, NodeID exit, const ProbabilityMap &probaMap,
+                            Engine engine, size_t &numPathSets)
+    {
+        auto localID = [&block](NodeID node)
+        { return static_cast<NodeID>(std::lower_bound(block.begin(), block.end(), node) - block.begin() + 1); };
+        NodeID src = localID(entry);
+        NodeID dst = localID(exit);
+
+        std::map<int, double> localAvail;
+        for (size_t i = 0; i < block.size(); ++i)
+        {
+            localAvail[static_cast<int>(i + 1)] = probaMap[block[i]];
+        }
+        localAvail[src] = 1.0;
+        localAvail[dst] = 1.0;
+        ProbabilityMap localMap(localAvail);
+
+        enumeration::PathSets pathSets = enumeration::minimalPaths(localGraph, src, dst);
+        numPathSets = pathSets.size();
+
+        enumeration::MinCutSets minCutSets;
+        if (engine == Engine::MCS)
+        {
+            minCutSets = enumeration::minimalCuts(pathSets, src, dst, enumeration::cutOrder(block.size()));
+        }
+        return selector::evalAvailWith(engine, src, dst, localMap, pathSets, minCutSets);
+    }
+
+    std::vector<AvailTriple> evalAvailTopo(const Graph &graph, const NodePairs &nodePairs, const ProbabilityMap &probaMap,
+                                           Engine engine, bool parallel, DecompositionInfo *info)
+    {
+        BlockCutTree tree = biconnectedComponents(graph);
+        int numBlocks = static_cast<int>(tree.blocks.size());
+
+        // Tree nodes: the blocks are 0..numBlocks-1, the cut vertex v is numBlocks + v
+        auto treeNodeOf = [&](NodeID node)
+        { return tree.isCut(node) ? numBlocks + node : tree.blocksOf[node][0]; };
+        auto forEachTreeNeighbor = [&](int treeNode, auto &&visit)
+        {
+            if (treeNode < numBlocks)
+            {
+                for (NodeID node : tree.blocks[treeNode])
+                {
+                    if (tree.isCut(node))
+                    {
+                        visit(numBlocks + node);
+                    }
+                }
+            }
+            else
+            {
+                for (int block : tree.blocksOf[treeNode - numBlocks])
+                {
+                    visit(block);
+                }
+            }
+        };
+
+        // Root every tree of the block-cut forest with a BFS
+        size_t numTreeNodes = numBlocks + graph.size() + 1;
+        std::vector<int> parent(numTreeNodes, -1);
+        std::vector<int> depth(numTreeNodes, 0);
+        std::vector<int> component(numTreeNodes, -1);
+        for (int root = 0; root < numBlocks; ++root)
+        {
+            if (component[root] >= 0)
+            {
+                continue;
+            }
+            std::queue<int> queue;
+            queue.push(root);
+            component[root] = root;
+            while (!queue.empty())
+            {
+                int treeNode = queue.front();
+                queue.pop();
+                forEachTreeNeighbor(treeNode, [&](int next)
+                {
+                    if (component[next] < 0)
+                    {
+                        component[next] = root;
+                        parent[next] = treeNode;
+                        depth[next] = depth[treeNode] + 1;
+                        queue.push(next);
+                    }
+                });
+            }
+        }
+
+        // Walk the tree path of every pair and collect its distinct block evaluations
+        std::map<BlockKey, size_t> keyIndex;
+        std::vector<BlockKey> keys;
+        std::vector<double> pairFactor(nodePairs.size(), 0.0);
+        std::vector<std::vector<size_t>> pairKeys(nodePairs.size());
+        std::vector<int> up, down;
+        for (size_t k = 0; k < nodePairs.size(); ++k)
+        {
+            const auto &[src, dst] = nodePairs[k];
+            int a = treeNodeOf(src);
+            int b = treeNodeOf(dst);
+
+            // Disconnected pairs are never available
+            if (component[a] != component[b])
+            {
+                continue;
+            }
+
+            // Climb from both ends to the lowest common ancestor
+            up.clear();
+            down.clear();
+            while (a != b)
+            {
+                if (depth[a] >= depth[b])
+                {
+                    up.push_back(a);
+                    a = parent[a];
+                }
+                else
+                {
+                    down.push_back(b);
+                    b = parent[b];
+                }
+            }
+            up.push_back(a);
+            up.insert(up.end(), down.rbegin(), down.rend());
+
+            double factor = probaMap[src] * probaMap[dst];
+            for (size_t i = 0; i < up.size(); ++i)
+            {
+                if (up[i] >= numBlocks)
+                {
+                    // Cut vertex between two blocks, src and dst are already counted
+                    NodeID cut = up[i] - numBlocks;
+                    if (cut != src && cut != dst)
+                    {
+                        factor *= probaMap[cut];
+                    }
+                    continue;
+                }
+
+                // Bridges and single nodes need no evaluation
+                if (tree.blocks[up[i]].size() <= 2)
+                {
+                    continue;
+                }
+                NodeID entry = i == 0 ? src : up[i - 1] - numBlocks;
+                NodeID exit = i + 1 == up.size() ? dst : up[i + 1] - numBlocks;
+                BlockKey key(up[i], std::min(entry, exit), std::max(entry, exit));
+                auto [it, inserted] = keyIndex.emplace(key, keys.size());
+                if (inserted)
+                {
+                    keys.push_back(key);
+                }
+                pairKeys[k].push_back(it->second);
+            }
+            pairFactor[k] = factor;
+        }
+
+        // Build the subgraphs of the blocks that are evaluated
+        std::vector<Graph> localGraphs(numBlocks);
+        std::vector<char> built(numBlocks, 0);
+        for (const auto &[block, entry, exit] : keys)
+        {
+            if (!built[block])
+            {
+                localGraphs[block] = blockGraph(graph, tree.blocks[block]);
+                built[block] = 1;
+            }
+        }
+
+        // Evaluate every block once, the sizes of the blocks vary, the dynamic schedule balances them
+        std::vector<double> values(keys.size());
+        size_t numPathSets = 0;
+        #pragma omp parallel for schedule(dynamic) reduction(+ : numPathSets) if (parallel)
+        for (size_t i = 0; i < keys.size(); ++i)
+        {
+            const auto &[block, entry, exit] = keys[i];
+            size_t count = 0;
+            values[i] = evalBlock(localGraphs[block], tree.blocks[block], entry, exit, probaMap, engine, count);
+            numPathSets += count;
+        }
+
+        // Multiply the cached values along the tree path of every pair
+        std::vector<AvailTriple> availList;
+        availList.reserve(nodePairs.size());
+        for (size_t k = 0; k < nodePairs.size(); ++k)
+        {
+            double availability = pairFactor[k];
+            for (size_t i : pairKeys[k])
+            {
+                availability *= values[i];
+            }
+            availList.emplace_back(nodePairs[k].first, nodePairs[k].second, availability);
+        }
+
+        if (info)
+        {
+            info->numBlocks = tree.blocks.size();
+            info->numCutVertices = 0;
+            for (NodeID node = 1; node <= graph.size(); ++node)
+            {
+                info->numCutVertices += tree.isCut(node);
+            }
+            info->blockEvaluations = keys.size();
+            info->pathSets = numPathSets;
+        }
+
+        return availList;
+    }
+
+} // namespace pyrbdpp::blockcut
\ No newline at end of file
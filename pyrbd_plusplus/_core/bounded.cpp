@@ -0,0 +1,40 @@
+#include <pyrbd_plusplus/bounded.hpp>
+#include <omp.h>
+
+namespace pyrbdpp::bounded
+{
+    std::vector<AvailTriple> evalAvailTopo(const Graph &graph, const NodePairs &nodePairs, const ProbabilityMap &probaMap,
+                                           Engine engine, const PathBound &bound, size_t order, bool parallel,
+                                           std::vector<stats::PairStats> *statsList)
+    {
+        std::vector<AvailTriple> availList(nodePairs.size());
+        if (statsList)
+        {
+            statsList->assign(nodePairs.size(), {});
+        }
+
+        #pragma omp parallel for schedule(dynamic) if (parallel)
+        for (size_t i = 0; i < nodePairs.size(); ++i)
+        {
+            const auto &[src, dst] = nodePairs[i];
+            enumeration::PathSets pathSets = enumeration::boundedPaths(graph, src, dst, bound);
+
+            // No path within the bound, the pair is never available
+            double availability = 0.0;
+            if (!pathSets.empty())
+            {
+                enumeration::MinCutSets minCutSets;
+                if (engine == Engine::MCS)
+                {
+                    minCutSets = enumeration::minimalCuts(pathSets, src, dst, order);
+                }
+                availability = selector::evalAvailWith(engine, src, dst, probaMap, pathSets, minCutSets,
+                                                       statsList ? &(*statsList)[i] : nullptr);
+            }
+            availList[i] = std::make_tuple(src, dst, availability);
+        }
+
+        return availList;
+    }
+
+} // namespace pyrbdpp::bounded
\ No newline at end of file
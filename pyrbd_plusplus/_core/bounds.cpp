@@ -0,0 +1,65 @@
+#include <pyrbd_plusplus/bounds.hpp>
+
+namespace pyrbdpp
+{
+    BoundsTracker::BoundsTracker(NodeID src, NodeID dst, const BoundsOptions &options, const BoundsCallback &callback,
+                                 Clock::time_point deadline)
+        : options(options), callback(callback), start(Clock::now()), deadline(deadline), lastReport(start)
+    {
+        bounds.src = src;
+        bounds.dst = dst;
+    }
+
+    BoundsTracker::Clock::time_point BoundsTracker::deadlineOf(const BoundsOptions &options)
+    {
+        if (options.deadline <= 0.0)
+        {
+            return Clock::time_point::max();
+        }
+        return Clock::now() + std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(options.deadline));
+    }
+
+    bool BoundsTracker::update(double lower, double remaining, size_t processed, size_t total)
+    {
+        Clock::time_point now = Clock::now();
+
+        // Rounding may push the partial sums slightly out of [0, 1]
+        bounds.lower = std::clamp(lower, 0.0, 1.0);
+        bounds.upper = std::clamp(lower + remaining, bounds.lower, 1.0);
+        bounds.processed = processed;
+        bounds.total = total;
+        bounds.elapsed = std::chrono::duration<double>(now - start).count();
+        bounds.converged = bounds.upper - bounds.lower < options.epsilon;
+
+        // Stream the bounds at most once per report interval
+        if (callback && std::chrono::duration<double>(now - lastReport).count() >= options.reportInterval)
+        {
+            lastReport = now;
+            if (!callback(bounds))
+            {
+                stopped = true;
+            }
+        }
+
+        return !stopped && !bounds.converged && now < deadline;
+    }
+
+    AvailBounds BoundsTracker::finish(bool complete)
+    {
+        if (complete)
+        {
+            bounds.upper = bounds.lower;
+            bounds.processed = bounds.total;
+            bounds.converged = true;
+        }
+        bounds.elapsed = std::chrono::duration<double>(Clock::now() - start).count();
+
+        // Report the final bounds unless the callback asked to stop
+        if (callback && !stopped)
+        {
+            callback(bounds);
+        }
+        return bounds;
+    }
+
+} // namespace pyrbdpp
\ No newline at end of file
@@ -0,0 +1,262 @@
+#include <pyrbd_plusplus/demand.hpp>
+#include <pyrbd_plusplus/enumeration.hpp>
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <omp.h>
+
+namespace pyrbdpp::demand
+{
+    using Pair = std::pair<NodeID, NodeID>;
+
+    // Demands sorted by source with the distinct pairs they refer to
+    struct Prepared
+    {
+        Demands demands;
+        std::vector<Pair> pairs;    // distinct pairs, smaller node first, sorted
+        std::vector<size_t> pairOf; // index of the pair of every demand
+        std::vector<size_t> groups; // first demand of every source, followed by the number of demands
+    };
+
+    // Key of a pair, smaller node first
+    static Pair pairKey(NodeID src, NodeID dst)
+    {
+        return src < dst ? Pair{src, dst} : Pair{dst, src};
+    }
+
+    // Keep the demands with a positive weight between two nodes, sort them by source and collect their pairs
+    static Prepared prepare(const Demands &demands)
+    {
+        Prepared prepared;
+        for (const Demand &demand : demands)
+        {
+            if (!(demand.weight >= 0.0))
+            {
+                throw std::invalid_argument("Demand (" + std::to_string(demand.src) + ", " + std::to_string(demand.dst) +
+                                            ") has the invalid weight " + std::to_string(demand.weight));
+            }
+            if (demand.weight > 0.0 && demand.src != demand.dst)
+            {
+                prepared.demands.push_back(demand);
+                prepared.pairs.push_back(pairKey(demand.src, demand.dst));
+            }
+        }
+        std::stable_sort(prepared.demands.begin(), prepared.demands.end(),
+                         [](const Demand &a, const Demand &b) { return a.src < b.src; });
+        std::sort(prepared.pairs.begin(), prepared.pairs.end());
+        prepared.pairs.erase(std::unique(prepared.pairs.begin(), prepared.pairs.end()), prepared.pairs.end());
+
+        for (size_t i = 0; i < prepared.demands.size(); ++i)
+        {
+            const Demand &demand = prepared.demands[i];
+            Pair key = pairKey(demand.src, demand.dst);
+            prepared.pairOf.push_back(std::lower_bound(prepared.pairs.begin(), prepared.pairs.end(), key) - prepared.pairs.begin());
+            if (i == 0 || demand.src != prepared.demands[i - 1].src)
+            {
+                prepared.groups.push_back(i);
+            }
+        }
+        prepared.groups.push_back(prepared.demands.size());
+
+        return prepared;
+    }
+
+    // Number of chunks of a parallel reduction over count items
+    static size_t numChunks(size_t count, bool parallel)
+    {
+        size_t chunks = parallel ? static_cast<size_t>(omp_get_max_threads()) : 1;
+        return std::max<size_t>(1, std::min(chunks, count));
+    }
+
+    // Reduce the availability of every distinct pair over the demands
+    static DemandSummary summarize(const Prepared &prepared, const std::vector<double> &availabilities,
+                                   const Reductions &reductions, bool parallel)
+    {
+        DemandSummary summary;
+        summary.demands = prepared.demands.size();
+        summary.pairs = prepared.pairs.size();
+
+        // Step 1: Sum the weights and the weighted availabilities of the sources in chunks of sources
+        struct SourcePartial
+        {
+            double weighted = 0.0;
+            double total = 0.0;
+            std::vector<std::pair<NodeID, double>> perSource;
+        };
+        size_t numGroups = prepared.groups.size() - 1;
+        size_t sourceChunks = numChunks(numGroups, parallel);
+        std::vector<SourcePartial> sourcePartials(sourceChunks);
+
+        #pragma omp parallel for schedule(static) if (sourceChunks > 1)
+        for (size_t chunk = 0; chunk < sourceChunks; ++chunk)
+        {
+            SourcePartial &partial = sourcePartials[chunk];
+            for (size_t group = chunk * numGroups / sourceChunks; group < (chunk + 1) * numGroups / sourceChunks; ++group)
+            {
+                double weighted = 0.0;
+                double total = 0.0;
+                for (size_t i = prepared.groups[group]; i < prepared.groups[group + 1]; ++i)
+                {
+                    weighted += prepared.demands[i].weight * availabilities[prepared.pairOf[i]];
+                    total += prepared.demands[i].weight;
+                }
+                partial.weighted += weighted;
+                partial.total += total;
+                if (reductions.perSource)
+                {
+                    partial.perSource.emplace_back(prepared.demands[prepared.groups[group]].src, weighted / total);
+                }
+            }
+        }
+
+        double weighted = 0.0;
+        for (const SourcePartial &partial : sourcePartials)
+        {
+            weighted += partial.weighted;
+            summary.totalDemand += partial.total;
+            summary.perSource.insert(summary.perSource.end(), partial.perSource.begin(), partial.perSource.end());
+        }
+        if (reductions.mean && summary.totalDemand > 0.0)
+        {
+            summary.weightedMean = weighted / summary.totalDemand;
+        }
+
+        // Step 2: Keep the least available pairs of every chunk of pairs, then of the merged candidates
+        size_t keep = std::max<size_t>(reductions.worst, reductions.minimum ? 1 : 0);
+        if (keep == 0 || prepared.pairs.empty())
+        {
+            return summary;
+        }
+        auto lessAvailable = [&](size_t a, size_t b)
+        {
+            return availabilities[a] < availabilities[b] || (availabilities[a] == availabilities[b] && a < b);
+        };
+        auto keepLeast = [&](std::vector<size_t> &indices)
+        {
+            size_t kept = std::min(keep, indices.size());
+            std::partial_sort(indices.begin(), indices.begin() + kept, indices.end(), lessAvailable);
+            indices.resize(kept);
+        };
+
+        size_t numPairs = prepared.pairs.size();
+        size_t pairChunks = numChunks(numPairs, parallel);
+        std::vector<std::vector<size_t>> candidates(pairChunks);
+
+        #pragma omp parallel for schedule(static) if (pairChunks > 1)
+        for (size_t chunk = 0; chunk < pairChunks; ++chunk)
+        {
+            for (size_t i = chunk * numPairs / pairChunks; i < (chunk + 1) * numPairs / pairChunks; ++i)
+            {
+                candidates[chunk].push_back(i);
+            }
+            keepLeast(candidates[chunk]);
+        }
+
+        std::vector<size_t> least;
+        for (const auto &chunkCandidates : candidates)
+        {
+            least.insert(least.end(), chunkCandidates.begin(), chunkCandidates.end());
+        }
+        keepLeast(least);
+
+        auto tripleOf = [&](size_t i) { return std::make_tuple(prepared.pairs[i].first, prepared.pairs[i].second, availabilities[i]); };
+        if (reductions.minimum)
+        {
+            summary.minimum = tripleOf(least.front());
+        }
+        for (size_t k = 0; k < std::min(reductions.worst, least.size()); ++k)
+        {
+            summary.worst.push_back(tripleOf(least[k]));
+        }
+
+        return summary;
+    }
+
+    Demands fromMatrix(const std::vector<double> &matrix, size_t numNodes)
+    {
+        if (matrix.size() != numNodes * numNodes)
+        {
+            throw std::invalid_argument("Expected " + std::to_string(numNodes * numNodes) + " demand entries, got " + std::to_string(matrix.size()));
+        }
+
+        Demands demands;
+        for (size_t i = 0; i < numNodes; ++i)
+        {
+            for (size_t j = 0; j < numNodes; ++j)
+            {
+                if (i != j && matrix[i * numNodes + j] != 0.0)
+                {
+                    demands.push_back({static_cast<NodeID>(i + 1), static_cast<NodeID>(j + 1), matrix[i * numNodes + j]});
+                }
+            }
+        }
+        return demands;
+    }
+
+    DemandSummary reduce(const std::vector<AvailTriple> &availList, const Demands &demands, const Reductions &reductions,
+                         bool parallel)
+    {
+        Prepared prepared = prepare(demands);
+
+        // Look up the availability of every pair of the demands in either direction
+        std::map<Pair, double> availOf;
+        for (const auto &[src, dst, availability] : availList)
+        {
+            availOf[pairKey(src, dst)] = availability;
+        }
+        std::vector<double> availabilities(prepared.pairs.size());
+        for (size_t i = 0; i < prepared.pairs.size(); ++i)
+        {
+            auto it = availOf.find(prepared.pairs[i]);
+            if (it == availOf.end())
+            {
+                throw std::invalid_argument("No availability for the demand pair (" + std::to_string(prepared.pairs[i].first) + ", " +
+                                            std::to_string(prepared.pairs[i].second) + ")");
+            }
+            availabilities[i] = it->second;
+        }
+
+        return summarize(prepared, availabilities, reductions, parallel);
+    }
+
+    DemandSummary evalAvailTopo(const Graph &graph, const Demands &demands, const ProbabilityMap &probaMap,
+                                const Reductions &reductions, Engine engine, size_t order, bool parallel)
+    {
+        // Step 1: Skip the pairs without demand
+        Prepared prepared = prepare(demands);
+        for (const auto &[src, dst] : prepared.pairs)
+        {
+            if (src < 1 || dst > graph.size())
+            {
+                throw std::invalid_argument("Demand pair (" + std::to_string(src) + ", " + std::to_string(dst) + ") is not in the graph");
+            }
+        }
+
+        // Step 2: Evaluate the distinct pairs in parallel
+        std::vector<double> availabilities(prepared.pairs.size(), 0.0);
+
+        #pragma omp parallel for schedule(dynamic) if (parallel)
+        for (size_t i = 0; i < prepared.pairs.size(); ++i)
+        {
+            const auto &[src, dst] = prepared.pairs[i];
+            PathSets pathSets = enumeration::minimalPaths(graph, src, dst);
+
+            // Disconnected pairs are never available
+            if (!pathSets.empty())
+            {
+                MinCutSets minCutSets;
+                if (engine == Engine::MCS)
+                {
+                    minCutSets = enumeration::minimalCuts(pathSets, src, dst, order);
+                }
+                availabilities[i] = selector::evalAvailWith(engine, src, dst, probaMap, pathSets, minCutSets);
+            }
+        }
+
+        // Step 3: Reduce over the demands
+        return summarize(prepared, availabilities, reductions, parallel);
+    }
+
+} // namespace pyrbdpp::demand
\ No newline at end of file
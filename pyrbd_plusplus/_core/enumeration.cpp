@@ -0,0 +1,1086 @@
+#include <pyrbd_plusplus/enumeration.hpp>
+#include <omp.h>
+#include <limits>
+#include <numeric>
+#include <queue>
+#include <stdexcept>
+
+namespace pyrbdpp::enumeration
+{
+    // Number of prefixes per thread for the parallel split, more prefixes balance the uneven subtrees
+    static constexpr size_t PREFIXES_PER_THREAD = 8;
+
+    // Maximal number of levels expanded before the parallel DFS
+    static constexpr size_t MAX_SPLIT_DEPTH = 16;
+
+    // A path prefix of the DFS, complete if it already ends at the destination
+    struct Prefix
+    {
+        Set path;
+        bool complete;
+    };
+
+    // Neighbors of a node that make a shortcut: all neighbors, or the chord masks of the link failure model
+    static const NodeMask &chordsOf(const Graph &graph, const std::vector<NodeMask> *chordMasks, NodeID node)
+    {
+        return chordMasks ? (*chordMasks)[node] : graph.neighborMask(node);
+    }
+
+    // Compute the forbidden mask of a path: the neighbors of all nodes except the last one
+    static NodeMask forbiddenOf(const Graph &graph, const Set &path, const std::vector<NodeMask> *chordMasks = nullptr)
+    {
+        NodeMask forbidden = graph.makeMask();
+        for (size_t i = 0; i + 1 < path.size(); ++i)
+        {
+            forbidden |= chordsOf(graph, chordMasks, path[i]);
+        }
+        return forbidden;
+    }
+
+    // Depth first search from a prefix with the minimality rule.
+    // onChild(path, child) is called for every child that is neither forbidden nor visited, in DFS order,
+    // and returns true to descend into the child. With chord masks, only these neighbors of earlier nodes are forbidden.
+    template <typename OnChild>
+    static void depthFirst(const Graph &graph, const Set &prefix, OnChild &&onChild, const std::vector<NodeMask> *chordMasks = nullptr)
+    {
+        Set path = prefix;
+
+        // Mark the visited nodes of the prefix
+        NodeMask visited = graph.makeMask();
+        for (NodeID node : path)
+        {
+            visited.set(node);
+        }
+
+        // forbidden[d] is the forbidden mask of a path with d + 1 nodes, only the last one is needed for the prefix
+        std::vector<NodeMask> forbidden(path.size(), graph.makeMask());
+        forbidden.back() = forbiddenOf(graph, path, chordMasks);
+
+        // Position in the adjacency list of the last node of the path
+        std::vector<const NodeID *> cursors{graph.begin(path.back())};
+
+        while (!cursors.empty())
+        {
+            size_t depth = path.size() - 1;
+            NodeID current = path.back();
+            const NodeID *&cursor = cursors.back();
+
+            // All neighbors visited, backtrack
+            if (cursor == graph.end(current))
+            {
+                cursors.pop_back();
+                visited.reset(current);
+                path.pop_back();
+                continue;
+            }
+
+            NodeID child = *cursor++;
+
+            // Skip the neighbors of earlier nodes, the path would have a shortcut
+            if (forbidden[depth].test(child) || visited.test(child))
+            {
+                continue;
+            }
+
+            if (onChild(path, child))
+            {
+                // Descend, the new forbidden mask adds the neighbors of the current node
+                if (forbidden.size() < depth + 2)
+                {
+                    forbidden.push_back(graph.makeMask());
+                }
+                forbidden[depth + 1].assignUnion(forbidden[depth], chordsOf(graph, chordMasks, current));
+
+                path.push_back(child);
+                visited.set(child);
+                cursors.push_back(graph.begin(child));
+            }
+        }
+    }
+
+    // Finish the DFS from a prefix and append the minimal paths to dst in DFS order
+    static void extendPrefix(const Graph &graph, NodeID dst, const Set &prefix, PathSets &pathSets)
+    {
+        depthFirst(graph, prefix, [dst, &pathSets](const Set &path, NodeID child)
+                   {
+                       // The destination ends the path
+                       if (child != dst)
+                       {
+                           return true;
+                       }
+                       pathSets.push_back(path);
+                       pathSets.back().push_back(dst);
+                       return false; });
+    }
+
+    // Expand the open prefixes by one level, keeping the DFS order
+    static std::vector<Prefix> expandPrefixes(const Graph &graph, NodeID dst, const std::vector<Prefix> &prefixes)
+    {
+        std::vector<Prefix> expanded;
+        expanded.reserve(prefixes.size() * 2);
+
+        for (const auto &prefix : prefixes)
+        {
+            if (prefix.complete)
+            {
+                expanded.push_back(prefix);
+                continue;
+            }
+
+            NodeMask forbidden = forbiddenOf(graph, prefix.path);
+            NodeID current = prefix.path.back();
+            for (const NodeID *it = graph.begin(current); it != graph.end(current); ++it)
+            {
+                NodeID child = *it;
+                if (forbidden.test(child))
+                {
+                    continue;
+                }
+
+                if (child == dst)
+                {
+                    expanded.push_back({prefix.path, true});
+                    expanded.back().path.push_back(dst);
+                }
+                else if (std::find(prefix.path.begin(), prefix.path.end(), child) == prefix.path.end())
+                {
+                    expanded.push_back({prefix.path, false});
+                    expanded.back().path.push_back(child);
+                }
+            }
+        }
+
+        return expanded;
+    }
+
+    PathSets minimalPaths(const Graph &graph, NodeID src, NodeID dst)
+    {
+        PathSets pathSets;
+        extendPrefix(graph, dst, {src}, pathSets);
+        return pathSets;
+    }
+
+    PathSets minimalPathsParallel(const Graph &graph, NodeID src, NodeID dst)
+    {
+        // Split the DFS at the first branching levels until there are enough prefixes for all threads
+        size_t target = PREFIXES_PER_THREAD * static_cast<size_t>(omp_get_max_threads());
+        std::vector<Prefix> prefixes{{{src}, false}};
+        for (size_t depth = 0; depth < MAX_SPLIT_DEPTH; ++depth)
+        {
+            size_t open = std::count_if(prefixes.begin(), prefixes.end(), [](const Prefix &prefix)
+                                        { return !prefix.complete; });
+            if (open == 0 || open >= target)
+            {
+                break;
+            }
+            prefixes = expandPrefixes(graph, dst, prefixes);
+        }
+
+        // Finish every prefix in parallel
+        std::vector<PathSets> threadResults(prefixes.size());
+        #pragma omp parallel for schedule(dynamic)
+        for (size_t i = 0; i < prefixes.size(); ++i)
+        {
+            if (prefixes[i].complete)
+            {
+                threadResults[i].push_back(prefixes[i].path);
+            }
+            else
+            {
+                extendPrefix(graph, dst, prefixes[i].path, threadResults[i]);
+            }
+        }
+
+        // Concatenate in the prefix order, which is the DFS order
+        PathSets pathSets;
+        for (auto &result : threadResults)
+        {
+            pathSets.insert(pathSets.end(), std::make_move_iterator(result.begin()), std::make_move_iterator(result.end()));
+        }
+
+        return pathSets;
+    }
+
+    std::vector<PathSets> minimalPathsTopo(const Graph &graph, const NodePairs &nodePairs)
+    {
+        std::vector<PathSets> pathsetsList;
+        pathsetsList.reserve(nodePairs.size());
+
+        for (const auto &[src, dst] : nodePairs)
+        {
+            pathsetsList.push_back(minimalPaths(graph, src, dst));
+        }
+
+        return pathsetsList;
+    }
+
+    std::vector<PathSets> minimalPathsTopoParallel(const Graph &graph, const NodePairs &nodePairs)
+    {
+        std::vector<PathSets> pathsetsList(nodePairs.size());
+
+        #pragma omp parallel for schedule(dynamic)
+        for (size_t i = 0; i < nodePairs.size(); ++i)
+        {
+            const auto &[src, dst] = nodePairs[i];
+            pathsetsList[i] = minimalPaths(graph, src, dst);
+        }
+
+        return pathsetsList;
+    }
+
+    std::vector<PathSets> minimalPathsFromSource(const Graph &graph, NodeID src, const std::vector<NodeID> &targets)
+    {
+        // Map every target node to its bucket
+        std::vector<int> bucketOf(graph.size() + 1, -1);
+        for (size_t i = 0; i < targets.size(); ++i)
+        {
+            bucketOf[targets[i]] = static_cast<int>(i);
+        }
+
+        // A single DFS reaches all targets, a path to a target continues to the targets behind it
+        std::vector<PathSets> buckets(targets.size());
+        depthFirst(graph, {src}, [&bucketOf, &buckets](const Set &path, NodeID child)
+                   {
+                       if (bucketOf[child] >= 0)
+                       {
+                           PathSets &bucket = buckets[bucketOf[child]];
+                           bucket.push_back(path);
+                           bucket.back().push_back(child);
+                       }
+                       return true; });
+
+        return buckets;
+    }
+
+    // Group the pairs by source, sources keep the order of their first pair
+    static std::vector<std::pair<NodeID, std::vector<size_t>>> groupBySource(const NodePairs &nodePairs)
+    {
+        std::vector<std::pair<NodeID, std::vector<size_t>>> groups;
+        std::map<NodeID, size_t> groupOf;
+        for (size_t i = 0; i < nodePairs.size(); ++i)
+        {
+            auto [it, inserted] = groupOf.try_emplace(nodePairs[i].first, groups.size());
+            if (inserted)
+            {
+                groups.push_back({nodePairs[i].first, {}});
+            }
+            groups[it->second].second.push_back(i);
+        }
+        return groups;
+    }
+
+    // Enumerate the path sets of all pairs of a source group and store them at the pair indices
+    static void enumerateGroup(const Graph &graph, const NodePairs &nodePairs, const std::pair<NodeID, std::vector<size_t>> &group,
+                               std::vector<PathSets> &pathsetsList)
+    {
+        const auto &[src, pairIndices] = group;
+
+        // Duplicate destinations share a bucket
+        std::vector<NodeID> targets;
+        for (size_t i : pairIndices)
+        {
+            targets.push_back(nodePairs[i].second);
+        }
+        std::sort(targets.begin(), targets.end());
+        targets.erase(std::unique(targets.begin(), targets.end()), targets.end());
+
+        std::vector<PathSets> buckets = minimalPathsFromSource(graph, src, targets);
+        std::vector<size_t> bucketOf;
+        std::vector<size_t> uses(targets.size(), 0);
+        for (size_t i : pairIndices)
+        {
+            bucketOf.push_back(std::lower_bound(targets.begin(), targets.end(), nodePairs[i].second) - targets.begin());
+            ++uses[bucketOf.back()];
+        }
+
+        // The last pair of a bucket takes it, the duplicates before it get a copy
+        for (size_t k = 0; k < pairIndices.size(); ++k)
+        {
+            size_t bucket = bucketOf[k];
+            if (--uses[bucket] == 0)
+            {
+                pathsetsList[pairIndices[k]] = std::move(buckets[bucket]);
+            }
+            else
+            {
+                pathsetsList[pairIndices[k]] = buckets[bucket];
+            }
+        }
+    }
+
+    std::vector<PathSets> minimalPathsTopoFromSources(const Graph &graph, const NodePairs &nodePairs)
+    {
+        std::vector<PathSets> pathsetsList(nodePairs.size());
+
+        for (const auto &group : groupBySource(nodePairs))
+        {
+            enumerateGroup(graph, nodePairs, group, pathsetsList);
+        }
+
+        return pathsetsList;
+    }
+
+    std::vector<PathSets> minimalPathsTopoFromSourcesParallel(const Graph &graph, const NodePairs &nodePairs)
+    {
+        std::vector<PathSets> pathsetsList(nodePairs.size());
+        auto groups = groupBySource(nodePairs);
+
+        #pragma omp parallel for schedule(dynamic)
+        for (size_t g = 0; g < groups.size(); ++g)
+        {
+            enumerateGroup(graph, nodePairs, groups[g], pathsetsList);
+        }
+
+        return pathsetsList;
+    }
+
+    // Relative tolerance of the length limit, the sums of the lengths are rounded
+    static constexpr double LENGTH_TOLERANCE = 1e-12;
+
+    // Number of hops from every node to dst with a BFS, the unreachable nodes get graph.size() + 1
+    static std::vector<size_t> hopsTo(const Graph &graph, NodeID dst)
+    {
+        std::vector<size_t> hops(graph.size() + 1, graph.size() + 1);
+        std::vector<NodeID> queue{dst};
+        hops[dst] = 0;
+        for (size_t head = 0; head < queue.size(); ++head)
+        {
+            NodeID node = queue[head];
+            for (const NodeID *it = graph.begin(node); it != graph.end(node); ++it)
+            {
+                if (hops[*it] > hops[node] + 1)
+                {
+                    hops[*it] = hops[node] + 1;
+                    queue.push_back(*it);
+                }
+            }
+        }
+        return hops;
+    }
+
+    // Length of the shortest path from every node to dst with Dijkstra, the unreachable nodes get infinity
+    static std::vector<double> lengthsTo(const Graph &graph, NodeID dst)
+    {
+        std::vector<double> lengths(graph.size() + 1, std::numeric_limits<double>::infinity());
+        std::priority_queue<std::pair<double, NodeID>, std::vector<std::pair<double, NodeID>>, std::greater<>> queue;
+        lengths[dst] = 0.0;
+        queue.emplace(0.0, dst);
+        while (!queue.empty())
+        {
+            auto [length, node] = queue.top();
+            queue.pop();
+            if (length > lengths[node])
+            {
+                continue;
+            }
+            for (const NodeID *it = graph.begin(node); it != graph.end(node); ++it)
+            {
+                double next = length + graph.length(it);
+                if (next < lengths[*it])
+                {
+                    lengths[*it] = next;
+                    queue.emplace(next, *it);
+                }
+            }
+        }
+        return lengths;
+    }
+
+    // Enumerate all simple paths within the bound, the lengths prevent the minimality rule
+    static PathSets simplePathsWithin(const Graph &graph, NodeID src, NodeID dst, size_t maxHops, double maxLength,
+                                      const std::vector<size_t> &hops, const std::vector<double> &lengths)
+    {
+        PathSets candidates;
+        Set path{src};
+        std::vector<double> pathLength{0.0};
+        NodeMask visited = graph.makeMask();
+        visited.set(src);
+        std::vector<const NodeID *> cursors{graph.begin(src)};
+
+        while (!cursors.empty())
+        {
+            NodeID current = path.back();
+            const NodeID *&cursor = cursors.back();
+            if (cursor == graph.end(current))
+            {
+                cursors.pop_back();
+                visited.reset(current);
+                path.pop_back();
+                pathLength.pop_back();
+                continue;
+            }
+
+            const NodeID *edge = cursor++;
+            NodeID child = *edge;
+            if (visited.test(child))
+            {
+                continue;
+            }
+
+            // Prune if the shortest completion exceeds the bound, path.size() is the number of hops to the child
+            double childLength = pathLength.back() + graph.length(edge);
+            if (path.size() + hops[child] > maxHops || childLength + lengths[child] > maxLength)
+            {
+                continue;
+            }
+
+            if (child == dst)
+            {
+                candidates.push_back(path);
+                candidates.back().push_back(dst);
+                continue;
+            }
+
+            path.push_back(child);
+            pathLength.push_back(childLength);
+            visited.set(child);
+            cursors.push_back(graph.begin(child));
+        }
+
+        return candidates;
+    }
+
+    PathSets boundedPaths(const Graph &graph, NodeID src, NodeID dst, const PathBound &bound)
+    {
+        std::vector<size_t> hops = hopsTo(graph, dst);
+        size_t maxHops = bound.maxHops ? bound.maxHops : static_cast<size_t>(graph.size());
+        if (hops[src] > maxHops)
+        {
+            return {};
+        }
+
+        // A hop limit only keeps the minimality rule
+        if (bound.maxLength <= 0.0)
+        {
+            PathSets pathSets;
+            depthFirst(graph, {src}, [&](const Set &path, NodeID child)
+                       {
+                           if (path.size() + hops[child] > maxHops)
+                           {
+                               return false;
+                           }
+                           if (child != dst)
+                           {
+                               return true;
+                           }
+                           pathSets.push_back(path);
+                           pathSets.back().push_back(dst);
+                           return false; });
+            return pathSets;
+        }
+
+        double maxLength = bound.maxLength * (1.0 + LENGTH_TOLERANCE);
+        PathSets candidates = simplePathsWithin(graph, src, dst, maxHops, maxLength, hops, lengthsTo(graph, dst));
+
+        // Keep the node sets without a smaller candidate inside, the smaller candidates are checked first
+        std::vector<NodeMask> masks;
+        masks.reserve(candidates.size());
+        for (const auto &candidate : candidates)
+        {
+            masks.push_back(graph.makeMask());
+            for (NodeID node : candidate)
+            {
+                masks.back().set(node);
+            }
+        }
+
+        std::vector<size_t> bySize(candidates.size());
+        std::iota(bySize.begin(), bySize.end(), 0);
+        std::stable_sort(bySize.begin(), bySize.end(), [&candidates](size_t a, size_t b)
+                         { return candidates[a].size() < candidates[b].size(); });
+
+        std::vector<size_t> kept;
+        for (size_t i : bySize)
+        {
+            bool minimal = std::none_of(kept.begin(), kept.end(), [&](size_t k)
+                                        { return masks[k].isSubsetOf(masks[i]); });
+            if (minimal)
+            {
+                kept.push_back(i);
+            }
+        }
+
+        // Return the minimal sets in the DFS order
+        std::sort(kept.begin(), kept.end());
+        PathSets pathSets;
+        pathSets.reserve(kept.size());
+        for (size_t i : kept)
+        {
+            pathSets.push_back(std::move(candidates[i]));
+        }
+        return pathSets;
+    }
+
+    std::vector<PathSets> boundedPathsTopo(const Graph &graph, const NodePairs &nodePairs, const PathBound &bound)
+    {
+        std::vector<PathSets> pathsetsList;
+        pathsetsList.reserve(nodePairs.size());
+
+        for (const auto &[src, dst] : nodePairs)
+        {
+            pathsetsList.push_back(boundedPaths(graph, src, dst, bound));
+        }
+
+        return pathsetsList;
+    }
+
+    std::vector<PathSets> boundedPathsTopoParallel(const Graph &graph, const NodePairs &nodePairs, const PathBound &bound)
+    {
+        std::vector<PathSets> pathsetsList(nodePairs.size());
+
+        #pragma omp parallel for schedule(dynamic)
+        for (size_t i = 0; i < nodePairs.size(); ++i)
+        {
+            const auto &[src, dst] = nodePairs[i];
+            pathsetsList[i] = boundedPaths(graph, src, dst, bound);
+        }
+
+        return pathsetsList;
+    }
+
+    // Prefix of the best-first search, blocked holds the visited nodes and the neighbors of all nodes but the last
+    struct ProbablePrefix
+    {
+        double priority;     // availability of the prefix times the availability of dst
+        double availability; // product of the availabilities of the nodes of the prefix
+        double bound;        // probability that the prefix and dst work and no kept path set does, at most priority
+        Set path;
+        NodeMask blocked;
+
+        bool operator<(const ProbablePrefix &other) const { return priority < other.priority; }
+    };
+
+    // Check if dst can be reached from a node without passing a blocked node
+    static bool reachable(const Graph &graph, NodeID from, NodeID dst, const NodeMask &blocked)
+    {
+        if (blocked.test(dst))
+        {
+            return false;
+        }
+        NodeMask reached = graph.makeMask();
+        NodeMask frontier = graph.makeMask();
+        reached.set(from);
+        frontier.set(from);
+        while (frontier.any())
+        {
+            NodeMask next = graph.makeMask();
+            frontier.forEach([&](NodeID node)
+                             { next |= graph.neighborMask(node); });
+            next.subtract(blocked);
+            next.subtract(reached);
+            if (next.test(dst))
+            {
+                return true;
+            }
+            reached |= next;
+            frontier = std::move(next);
+        }
+        return false;
+    }
+
+    // Bound the probability that the prefix and dst work and no kept path set does.
+    // Given the prefix and dst, a kept path set works if the rest of its nodes work. The rests of the kept path sets
+    // chosen greedily without a common node fail independently, so the bound is the priority times the product of
+    // their failure probabilities. A kept path set inside the prefix and dst makes the bound 0.
+    static double boundOf(const Graph &graph, const ProbablePrefix &prefix, NodeID dst, const ProbabilityMap &probaMap,
+                          const std::vector<NodeMask> &keptMasks)
+    {
+        NodeMask given = graph.makeMask();
+        for (NodeID node : prefix.path)
+        {
+            given.set(node);
+        }
+        given.set(dst);
+
+        double bound = prefix.priority;
+        NodeMask used = graph.makeMask();
+        NodeMask rest = graph.makeMask();
+        for (const auto &kept : keptMasks)
+        {
+            rest = kept;
+            rest.subtract(given);
+            if (!rest.any())
+            {
+                return 0.0;
+            }
+            NodeMask common = rest;
+            common &= used;
+            if (common.any())
+            {
+                continue;
+            }
+            double restAvail = 1.0;
+            rest.forEach([&](NodeID node)
+                         { restAvail *= probaMap[node]; });
+            bound *= 1.0 - restAvail;
+            used |= rest;
+        }
+        return bound;
+    }
+
+    ProbablePaths probablePaths(const Graph &graph, NodeID src, NodeID dst, const ProbabilityMap &probaMap, double epsilon,
+                                size_t maxPaths)
+    {
+        ProbablePaths result;
+        double dstAvail = probaMap[dst];
+        std::vector<NodeMask> keptMasks;
+
+        // The queue is a max-heap on the priority, queued is the running sum of the bounds of the prefixes
+        std::vector<ProbablePrefix> heap;
+        double queued = 0.0;
+        auto push = [&](ProbablePrefix &&prefix)
+        {
+            prefix.bound = boundOf(graph, prefix, dst, probaMap, keptMasks);
+            if (prefix.bound <= 0.0)
+            {
+                return;
+            }
+            queued += prefix.bound;
+            heap.push_back(std::move(prefix));
+            std::push_heap(heap.begin(), heap.end());
+        };
+
+        // Recompute the bounds with all kept path sets, the prefixes covered by a kept path set are dropped
+        size_t refreshed = 0;
+        auto refresh = [&]
+        {
+            refreshed = keptMasks.size();
+            queued = 0.0;
+            size_t live = 0;
+            for (size_t i = 0; i < heap.size(); ++i)
+            {
+                heap[i].bound = boundOf(graph, heap[i], dst, probaMap, keptMasks);
+                if (heap[i].bound > 0.0)
+                {
+                    queued += heap[i].bound;
+                    if (live != i)
+                    {
+                        heap[live] = std::move(heap[i]);
+                    }
+                    ++live;
+                }
+            }
+            heap.resize(live);
+            std::make_heap(heap.begin(), heap.end());
+        };
+
+        NodeMask start = graph.makeMask();
+        start.set(src);
+        if (reachable(graph, src, dst, start))
+        {
+            push({probaMap[src] * dstAvail, probaMap[src], 0.0, {src}, std::move(start)});
+        }
+
+        while (!heap.empty())
+        {
+            // Stop once the prefixes left can not contribute epsilon, the bounds are refreshed once the kept path sets
+            // grew by a quarter since the last refresh, and before stopping to replace the running sum
+            if (queued >= epsilon && keptMasks.size() >= refreshed + std::max<size_t>(1, refreshed / 4))
+            {
+                refresh();
+            }
+            if (queued < epsilon)
+            {
+                refresh();
+                if (queued < epsilon)
+                {
+                    break;
+                }
+            }
+            if (heap.empty() || (maxPaths && result.pathSets.size() >= maxPaths))
+            {
+                break;
+            }
+
+            std::pop_heap(heap.begin(), heap.end());
+            ProbablePrefix prefix = std::move(heap.back());
+            heap.pop_back();
+            queued -= prefix.bound;
+
+            // The children of the last node: dst completes a path set, the others extend the prefix
+            NodeID current = prefix.path.back();
+            NodeMask childBlocked = prefix.blocked;
+            childBlocked |= graph.neighborMask(current);
+            for (const NodeID *it = graph.begin(current); it != graph.end(current); ++it)
+            {
+                NodeID child = *it;
+                if (prefix.blocked.test(child))
+                {
+                    continue;
+                }
+                if (child == dst)
+                {
+                    result.pathSets.push_back(prefix.path);
+                    result.pathSets.back().push_back(dst);
+                    keptMasks.push_back(graph.makeMask());
+                    for (NodeID node : result.pathSets.back())
+                    {
+                        keptMasks.back().set(node);
+                    }
+                    continue;
+                }
+
+                NodeMask blocked = childBlocked;
+                blocked.set(child);
+                if (!reachable(graph, child, dst, blocked))
+                {
+                    continue;
+                }
+                Set path = prefix.path;
+                path.push_back(child);
+                double availability = prefix.availability * probaMap[child];
+                push({availability * dstAvail, availability, 0.0, std::move(path), std::move(blocked)});
+            }
+        }
+
+        // The final bound uses all kept path sets
+        refresh();
+        result.open = heap.size();
+        result.complete = heap.empty();
+        result.remaining = queued;
+        return result;
+    }
+
+    // Bitset over the path sets of a pair
+    using PathMask = std::vector<uint64_t>;
+
+    // Number of chosen nodes after which the parallel cut search is split
+    static constexpr size_t CUT_SPLIT_DEPTH = 2;
+
+    // Branch of the cut search, saved at the split depth for the parallel search
+    struct CutBranch
+    {
+        std::vector<int> chosen;
+        std::vector<PathMask> critical;
+        PathMask uncovered;
+        std::vector<char> candidates;
+    };
+
+    // Minimal hitting set search over the path sets, the nodes are the indices of the intermediate nodes
+    class CutSearch
+    {
+    private:
+        std::vector<std::vector<int>> pathNodes; // intermediate nodes of each path set
+        std::vector<PathMask> incidence;         // path sets hit by each node
+        std::vector<NodeID> nodeIDs;             // node ID of each index
+        size_t words = 0;
+        size_t order = 0;
+
+        static bool isEmpty(const PathMask &mask)
+        {
+            return std::all_of(mask.begin(), mask.end(), [](uint64_t word)
+                               { return word == 0; });
+        }
+
+    public:
+        CutSearch(const PathSets &pathSets, NodeID src, NodeID dst, size_t maxOrder)
+            : words((pathSets.size() + 63) / 64), order(maxOrder == 0 ? std::numeric_limits<size_t>::max() : maxOrder)
+        {
+            std::map<NodeID, int> indexOf;
+            pathNodes.resize(pathSets.size());
+            for (size_t p = 0; p < pathSets.size(); ++p)
+            {
+                for (NodeID node : pathSets[p])
+                {
+                    if (node == src || node == dst)
+                    {
+                        continue;
+                    }
+                    auto [it, inserted] = indexOf.try_emplace(node, static_cast<int>(nodeIDs.size()));
+                    if (inserted)
+                    {
+                        nodeIDs.push_back(node);
+                        incidence.emplace_back(words, 0);
+                    }
+                    pathNodes[p].push_back(it->second);
+                    incidence[it->second][p / 64] |= uint64_t(1) << (p % 64);
+                }
+            }
+        }
+
+        // The root branch: nothing chosen, all path sets uncovered, all nodes are candidates
+        CutBranch root() const
+        {
+            CutBranch branch;
+            branch.uncovered.assign(words, ~uint64_t(0));
+            if (pathNodes.size() % 64 != 0)
+            {
+                branch.uncovered.back() = (uint64_t(1) << (pathNodes.size() % 64)) - 1;
+            }
+            branch.candidates.assign(nodeIDs.size(), 1);
+            return branch;
+        }
+
+        // Search a branch, the cut sets are appended as node IDs. With a frontier, the branches at the split depth are saved instead.
+        void search(CutBranch &branch, MinCutSets &cutSets, std::vector<CutBranch> *frontier = nullptr) const
+        {
+            // All path sets are hit, the chosen nodes are a minimal cut set
+            if (isEmpty(branch.uncovered))
+            {
+                Set cutSet;
+                for (int v : branch.chosen)
+                {
+                    cutSet.push_back(nodeIDs[v]);
+                }
+                cutSets.push_back(std::move(cutSet));
+                return;
+            }
+
+            if (branch.chosen.size() >= order)
+            {
+                return;
+            }
+
+            if (frontier && branch.chosen.size() == CUT_SPLIT_DEPTH)
+            {
+                frontier->push_back(branch);
+                return;
+            }
+
+            // Select the uncovered path set with the fewest candidates
+            size_t best = 0, bestCount = std::numeric_limits<size_t>::max();
+            for (size_t w = 0; w < words && bestCount > 0; ++w)
+            {
+                for (uint64_t bits = branch.uncovered[w]; bits && bestCount > 0; bits &= bits - 1)
+                {
+                    size_t p = w * 64 + __builtin_ctzll(bits);
+                    size_t count = std::count_if(pathNodes[p].begin(), pathNodes[p].end(), [&branch](int v)
+                                                 { return branch.candidates[v]; });
+                    if (count < bestCount)
+                    {
+                        best = p;
+                        bestCount = count;
+                    }
+                }
+            }
+
+            // Remove the candidates of the path set, each is given back after its branch
+            std::vector<int> branchNodes;
+            for (int v : pathNodes[best])
+            {
+                if (branch.candidates[v])
+                {
+                    branchNodes.push_back(v);
+                    branch.candidates[v] = 0;
+                }
+            }
+
+            for (int u : branchNodes)
+            {
+                CutBranch next;
+                next.chosen = branch.chosen;
+                next.chosen.push_back(u);
+
+                // The chosen nodes lose the path sets hit by u, prune if one becomes redundant
+                bool redundant = false;
+                next.critical.reserve(next.chosen.size());
+                for (const auto &critical : branch.critical)
+                {
+                    next.critical.push_back(critical);
+                    for (size_t w = 0; w < words; ++w)
+                    {
+                        next.critical.back()[w] &= ~incidence[u][w];
+                    }
+                    redundant = redundant || isEmpty(next.critical.back());
+                }
+
+                if (!redundant)
+                {
+                    next.critical.emplace_back(words);
+                    next.uncovered.resize(words);
+                    for (size_t w = 0; w < words; ++w)
+                    {
+                        next.critical.back()[w] = incidence[u][w] & branch.uncovered[w];
+                        next.uncovered[w] = branch.uncovered[w] & ~incidence[u][w];
+                    }
+                    next.candidates = std::move(branch.candidates);
+                    search(next, cutSets, frontier);
+                    branch.candidates = std::move(next.candidates);
+                }
+
+                branch.candidates[u] = 1;
+            }
+        }
+    };
+
+    void checkLinkMap(const Graph &graph, const ProbabilityMap &probaMap)
+    {
+        size_t literals = static_cast<size_t>(graph.size()) + static_cast<size_t>(graph.numEdges());
+        if (probaMap.size() < literals)
+        {
+            throw std::invalid_argument("Expected " + std::to_string(literals) + " node and edge availabilities, got " + std::to_string(probaMap.size()));
+        }
+    }
+
+    // Chord masks of the link failure model: the neighbors over an edge that never fails
+    static std::vector<NodeMask> perfectNeighbors(const Graph &graph, const ProbabilityMap &probaMap)
+    {
+        std::vector<NodeMask> chordMasks(graph.size() + 1, graph.makeMask());
+        for (NodeID node = 1; node <= graph.size(); ++node)
+        {
+            for (const NodeID *it = graph.begin(node); it != graph.end(node); ++it)
+            {
+                if (graph.edgeID(it) != 0 && probaMap[graph.edgeID(it)] == 1.0)
+                {
+                    chordMasks[node].set(*it);
+                }
+            }
+        }
+        return chordMasks;
+    }
+
+    // Enumerate the link path sets of a pair, the literals of the failing edges are inserted between their nodes
+    static PathSets linkPathsWith(const Graph &graph, NodeID src, NodeID dst, const ProbabilityMap &probaMap,
+                                  const std::vector<NodeMask> &chordMasks)
+    {
+        PathSets pathSets;
+        depthFirst(graph, {src}, [&](const Set &path, NodeID child)
+                   {
+                       if (child != dst)
+                       {
+                           return true;
+                       }
+                       Set pathSet;
+                       pathSet.reserve(2 * path.size() + 1);
+                       for (size_t i = 0; i <= path.size(); ++i)
+                       {
+                           NodeID node = i < path.size() ? path[i] : dst;
+                           if (i > 0)
+                           {
+                               NodeID edge = graph.edgeID(path[i - 1], node);
+                               if (probaMap[edge] < 1.0)
+                               {
+                                   pathSet.push_back(edge);
+                               }
+                           }
+                           pathSet.push_back(node);
+                       }
+                       pathSets.push_back(std::move(pathSet));
+                       return false; }, &chordMasks);
+        return pathSets;
+    }
+
+    PathSets linkPaths(const Graph &graph, NodeID src, NodeID dst, const ProbabilityMap &probaMap)
+    {
+        checkLinkMap(graph, probaMap);
+        return linkPathsWith(graph, src, dst, probaMap, perfectNeighbors(graph, probaMap));
+    }
+
+    std::vector<PathSets> linkPathsTopo(const Graph &graph, const NodePairs &nodePairs, const ProbabilityMap &probaMap, bool parallel)
+    {
+        checkLinkMap(graph, probaMap);
+        std::vector<NodeMask> chordMasks = perfectNeighbors(graph, probaMap);
+
+        std::vector<PathSets> pathsetsList(nodePairs.size());
+        #pragma omp parallel for schedule(dynamic) if (parallel)
+        for (size_t i = 0; i < nodePairs.size(); ++i)
+        {
+            pathsetsList[i] = linkPathsWith(graph, nodePairs[i].first, nodePairs[i].second, probaMap, chordMasks);
+        }
+
+        return pathsetsList;
+    }
+
+    // Sort the cut sets and add the source and destination, the layout of minimalcuts_optimized()
+    static MinCutSets finishCuts(MinCutSets cutSets, NodeID src, NodeID dst)
+    {
+        for (auto &cutSet : cutSets)
+        {
+            std::sort(cutSet.begin(), cutSet.end());
+        }
+        std::sort(cutSets.begin(), cutSets.end(), [](const Set &a, const Set &b)
+                  { return a.size() != b.size() ? a.size() < b.size() : a < b; });
+
+        cutSets.insert(cutSets.begin(), {{src}, {dst}});
+        return cutSets;
+    }
+
+    static void checkPathSets(const PathSets &pathSets, NodeID src, NodeID dst)
+    {
+        if (pathSets.empty())
+        {
+            throw std::invalid_argument("No path between " + std::to_string(src) + " and " + std::to_string(dst));
+        }
+    }
+
+    size_t cutOrder(size_t numElements)
+    {
+        return (numElements + 1) / 2;
+    }
+
+    MinCutSets minimalCuts(const PathSets &pathSets, NodeID src, NodeID dst, size_t order)
+    {
+        checkPathSets(pathSets, src, dst);
+
+        CutSearch cutSearch(pathSets, src, dst, order);
+        CutBranch root = cutSearch.root();
+        MinCutSets cutSets;
+        cutSearch.search(root, cutSets);
+
+        return finishCuts(std::move(cutSets), src, dst);
+    }
+
+    MinCutSets minimalCutsParallel(const PathSets &pathSets, NodeID src, NodeID dst, size_t order)
+    {
+        checkPathSets(pathSets, src, dst);
+
+        // Search the first levels serially and save the branches at the split depth
+        CutSearch cutSearch(pathSets, src, dst, order);
+        CutBranch root = cutSearch.root();
+        MinCutSets cutSets;
+        std::vector<CutBranch> frontier;
+        cutSearch.search(root, cutSets, &frontier);
+
+        // Search the saved branches in parallel
+        std::vector<MinCutSets> threadResults(frontier.size());
+        #pragma omp parallel for schedule(dynamic)
+        for (size_t i = 0; i < frontier.size(); ++i)
+        {
+            cutSearch.search(frontier[i], threadResults[i]);
+        }
+
+        for (auto &result : threadResults)
+        {
+            cutSets.insert(cutSets.end(), std::make_move_iterator(result.begin()), std::make_move_iterator(result.end()));
+        }
+
+        return finishCuts(std::move(cutSets), src, dst);
+    }
+
+    std::vector<MinCutSets> minimalCutsTopo(const Graph &graph, const NodePairs &nodePairs, size_t order)
+    {
+        std::vector<PathSets> pathsetsList = minimalPathsTopoFromSources(graph, nodePairs);
+
+        std::vector<MinCutSets> minCutSetsList;
+        minCutSetsList.reserve(nodePairs.size());
+        for (size_t i = 0; i < nodePairs.size(); ++i)
+        {
+            const auto &[src, dst] = nodePairs[i];
+            minCutSetsList.push_back(minimalCuts(pathsetsList[i], src, dst, order));
+        }
+
+        return minCutSetsList;
+    }
+
+    std::vector<MinCutSets> minimalCutsTopoParallel(const Graph &graph, const NodePairs &nodePairs, size_t order)
+    {
+        std::vector<PathSets> pathsetsList = minimalPathsTopoFromSourcesParallel(graph, nodePairs);
+
+        // Check before the parallel region, an exception must not leave it
+        for (size_t i = 0; i < nodePairs.size(); ++i)
+        {
+            checkPathSets(pathsetsList[i], nodePairs[i].first, nodePairs[i].second);
+        }
+
+        std::vector<MinCutSets> minCutSetsList(nodePairs.size());
+        #pragma omp parallel for schedule(dynamic)
+        for (size_t i = 0; i < nodePairs.size(); ++i)
+        {
+            const auto &[src, dst] = nodePairs[i];
+            minCutSetsList[i] = minimalCuts(pathsetsList[i], src, dst, order);
+        }
+
+        return minCutSetsList;
+    }
+
+} // namespace pyrbdpp::enumeration
\ No newline at end of file
@@ -0,0 +1,455 @@
+#include <pyrbd_plusplus/exhaustive.hpp>
+#include <pyrbd_plusplus/enumeration.hpp>
+#include <numeric>
+#include <omp.h>
+
+namespace pyrbdpp::exhaustive
+{
+    // Components of a pair as bits 0..n-1 of a mask, src and dst are the bits n and n + 1
+    struct Subsystem
+    {
+        std::vector<NodeID> nodes;      // node ID of every component bit
+        std::vector<uint64_t> adjacency; // neighbor mask of every bit, src and dst included
+        uint64_t srcBit = 0;
+        uint64_t dstBit = 0;
+    };
+
+    // Split of the components of a pair: the lane components are the lanes of a word, the gray components are
+    // walked in Gray-code order and the remaining components select the block
+    struct BlockLayout
+    {
+        size_t laneBits = 0;
+        size_t grayBits = 0;
+        Word validLanes = 0;
+        std::vector<double> laneTable; // probability of the lane components in the state of every lane
+        std::vector<double> grayTable; // probability of the gray components in every step of the walk
+    };
+
+    // Lane l of pattern k is set if bit k of l is set, so the lanes of a word hold all states of the lane components
+    static constexpr Word LANE_PATTERNS[LANE_BITS] = {
+        0xAAAAAAAAAAAAAAAAULL, 0xCCCCCCCCCCCCCCCCULL, 0xF0F0F0F0F0F0F0F0ULL,
+        0xFF00FF00FF00FF00ULL, 0xFFFF0000FFFF0000ULL, 0xFFFFFFFF00000000ULL};
+
+    // Probabilities of all states of the components first .. first + count - 1, bit k of a state is component first + k
+    static std::vector<double> stateTable(const ProbabilityMap &probaMap, const std::vector<NodeID> &nodes, size_t first, size_t count)
+    {
+        std::vector<double> table(size_t(1) << count, 1.0);
+        for (size_t k = 0; k < count; ++k)
+        {
+            const double p = probaMap[nodes[first + k]];
+            const size_t half = size_t(1) << k;
+            for (size_t s = 0; s < half; ++s)
+            {
+                table[s | half] = table[s] * p;
+                table[s] *= 1.0 - p;
+            }
+        }
+        return table;
+    }
+
+    // Nodes reached from the nodes of seed without passing through the blocked node
+    static std::vector<char> reachable(const Graph &graph, NodeID seed, NodeID blocked)
+    {
+        std::vector<char> reached(graph.size() + 1, 0);
+        std::vector<NodeID> stack{seed};
+        reached[seed] = 1;
+        reached[blocked] = 1;
+        while (!stack.empty())
+        {
+            NodeID node = stack.back();
+            stack.pop_back();
+            for (const NodeID *it = graph.begin(node); it != graph.end(node); ++it)
+            {
+                if (!reached[*it])
+                {
+                    reached[*it] = 1;
+                    stack.push_back(*it);
+                }
+            }
+        }
+        reached[blocked] = 0;
+        return reached;
+    }
+
+    static bool adjacent(const Graph &graph, NodeID src, NodeID dst)
+    {
+        return std::find(graph.begin(src), graph.end(src), dst) != graph.end(src);
+    }
+
+    std::vector<NodeID> components(const Graph &graph, NodeID src, NodeID dst)
+    {
+        if (adjacent(graph, src, dst))
+        {
+            return {};
+        }
+
+        // Step 1: A node on a path is reached from src without dst and from dst without src
+        std::vector<char> fromSrc = reachable(graph, src, dst);
+        bool connected = std::any_of(graph.begin(dst), graph.end(dst), [&](NodeID node)
+                                     { return fromSrc[node]; });
+        if (!connected)
+        {
+            return {};
+        }
+        std::vector<char> fromDst = reachable(graph, dst, src);
+
+        std::vector<char> kept(graph.size() + 1, 0);
+        for (NodeID node = 1; node <= graph.size(); ++node)
+        {
+            kept[node] = fromSrc[node] && fromDst[node] && node != src && node != dst;
+        }
+        kept[src] = kept[dst] = 1;
+
+        // Step 2: Remove the dangling trees, a component with a single kept neighbor is on no path
+        std::vector<size_t> degree(graph.size() + 1, 0);
+        std::vector<NodeID> leaves;
+        for (NodeID node = 1; node <= graph.size(); ++node)
+        {
+            if (!kept[node])
+            {
+                continue;
+            }
+            degree[node] = std::count_if(graph.begin(node), graph.end(node), [&](NodeID neighbor)
+                                         { return kept[neighbor]; });
+            if (degree[node] <= 1 && node != src && node != dst)
+            {
+                leaves.push_back(node);
+            }
+        }
+        while (!leaves.empty())
+        {
+            NodeID leaf = leaves.back();
+            leaves.pop_back();
+            kept[leaf] = 0;
+            for (const NodeID *it = graph.begin(leaf); it != graph.end(leaf); ++it)
+            {
+                NodeID neighbor = *it;
+                if (kept[neighbor] && --degree[neighbor] == 1 && neighbor != src && neighbor != dst)
+                {
+                    leaves.push_back(neighbor);
+                }
+            }
+        }
+
+        std::vector<NodeID> result;
+        for (NodeID node = 1; node <= graph.size(); ++node)
+        {
+            if (kept[node] && node != src && node != dst)
+            {
+                result.push_back(node);
+            }
+        }
+        return result;
+    }
+
+    static Subsystem subsystem(const Graph &graph, NodeID src, NodeID dst, std::vector<NodeID> nodes)
+    {
+        Subsystem sub;
+        const size_t n = nodes.size();
+        sub.nodes = std::move(nodes);
+        sub.srcBit = uint64_t(1) << n;
+        sub.dstBit = uint64_t(1) << (n + 1);
+
+        std::vector<int> bitOf(graph.size() + 1, -1);
+        for (size_t k = 0; k < n; ++k)
+        {
+            bitOf[sub.nodes[k]] = static_cast<int>(k);
+        }
+        bitOf[src] = static_cast<int>(n);
+        bitOf[dst] = static_cast<int>(n + 1);
+
+        sub.adjacency.assign(n + 2, 0);
+        for (size_t k = 0; k < n + 2; ++k)
+        {
+            NodeID node = k < n ? sub.nodes[k] : (k == n ? src : dst);
+            for (const NodeID *it = graph.begin(node); it != graph.end(node); ++it)
+            {
+                if (bitOf[*it] >= 0)
+                {
+                    sub.adjacency[k] |= uint64_t(1) << bitOf[*it];
+                }
+            }
+        }
+        return sub;
+    }
+
+    // Propagate the reached lanes from the pending nodes until no word changes
+    static inline void propagate(const uint64_t *adjacency, const Word *state, Word *reach, uint64_t pending)
+    {
+        while (pending)
+        {
+            const int node = __builtin_ctzll(pending);
+            pending &= pending - 1;
+            for (uint64_t bits = adjacency[node]; bits; bits &= bits - 1)
+            {
+                const int neighbor = __builtin_ctzll(bits);
+                const Word added = reach[node] & state[neighbor] & ~reach[neighbor];
+                if (added)
+                {
+                    reach[neighbor] |= added;
+                    pending |= uint64_t(1) << neighbor;
+                }
+            }
+        }
+    }
+
+    // Sum of the probabilities of the connected states of a block, the word states are walked in Gray-code order
+    static double evalBlock(const Subsystem &sub, const BlockLayout &layout, uint64_t block, std::vector<Word> &state,
+                            std::vector<Word> &reach, std::vector<Word> &connected)
+    {
+        const uint64_t *adjacency = sub.adjacency.data();
+        const size_t n = sub.nodes.size();
+        const int src = static_cast<int>(n);
+        const int dst = static_cast<int>(n + 1);
+
+        // The lane components have fixed patterns, the walk starts with every gray component failed
+        for (size_t k = 0; k < layout.laneBits; ++k)
+        {
+            state[k] = LANE_PATTERNS[k] & layout.validLanes;
+        }
+        for (size_t k = layout.laneBits; k < n; ++k)
+        {
+            const bool works = k >= layout.laneBits + layout.grayBits && ((block >> (k - layout.laneBits - layout.grayBits)) & 1);
+            state[k] = works ? layout.validLanes : 0;
+        }
+        state[src] = state[dst] = layout.validLanes;
+
+        auto restart = [&]
+        {
+            std::fill(reach.begin(), reach.end(), 0);
+            reach[src] = state[src];
+            propagate(adjacency, state.data(), reach.data(), uint64_t(1) << src);
+        };
+        restart();
+        connected[0] = reach[dst];
+
+        // Every step flips one gray component in all lanes, a working component extends the reached lanes from its
+        // neighbors, a failed reached component restarts the propagation from src
+        const size_t numWords = size_t(1) << layout.grayBits;
+        for (size_t i = 1; i < numWords; ++i)
+        {
+            const size_t k = layout.laneBits + __builtin_ctzll(i);
+            if (state[k])
+            {
+                state[k] = 0;
+                if (reach[k])
+                {
+                    restart();
+                }
+            }
+            else
+            {
+                state[k] = layout.validLanes;
+                Word reached = 0;
+                for (uint64_t bits = adjacency[k]; bits; bits &= bits - 1)
+                {
+                    reached |= reach[__builtin_ctzll(bits)];
+                }
+                reach[k] = reached & state[k];
+                if (reach[k])
+                {
+                    propagate(adjacency, state.data(), reach.data(), uint64_t(1) << k);
+                }
+            }
+            connected[i] = reach[dst];
+        }
+
+        // Weight the connected lanes of every word with the probabilities of the lane and gray components
+        double sum = 0.0;
+        for (size_t i = 0; i < numWords; ++i)
+        {
+            const Word word = connected[i];
+            double lanes = 0.0;
+            #pragma omp simd reduction(+ : lanes)
+            for (size_t lane = 0; lane < LANES; ++lane)
+            {
+                lanes += layout.laneTable[lane] * static_cast<double>((word >> lane) & 1);
+            }
+            sum += layout.grayTable[i] * lanes;
+        }
+        return sum;
+    }
+
+    // Throw if a pair has more components than the exhaustive enumeration supports
+    static void checkComponents(NodeID src, NodeID dst, size_t numComponents)
+    {
+        if (numComponents > MAX_COMPONENTS)
+        {
+            throw std::invalid_argument("Pair (" + std::to_string(src) + ", " + std::to_string(dst) + ") has " +
+                                        std::to_string(numComponents) + " components, the exhaustive enumeration supports " +
+                                        std::to_string(MAX_COMPONENTS));
+        }
+    }
+
+    // Evaluate a pair from its components(), at most MAX_COMPONENTS of them
+    static double evalComponents(const Graph &graph, NodeID src, NodeID dst, const ProbabilityMap &probaMap,
+                                 std::vector<NodeID> nodes, bool parallel, stats::PairStats *pairStats)
+    {
+        // Collect the stats of the pair if requested
+        stats::Scope scope(pairStats);
+        if (pairStats)
+        {
+            pairStats->src = src;
+            pairStats->dst = dst;
+        }
+        stats::ScopedTimer timer(&stats::PairStats::evalTime);
+
+        const double endpoints = probaMap[src] * probaMap[dst];
+        if (adjacent(graph, src, dst))
+        {
+            return endpoints;
+        }
+
+        if (nodes.empty())
+        {
+            return 0.0;
+        }
+        Subsystem sub = subsystem(graph, src, dst, std::move(nodes));
+        const size_t n = sub.nodes.size();
+
+        // Step 1: Probabilities of the lane states and of the gray states in Gray-code order
+        BlockLayout layout;
+        layout.laneBits = std::min(n, LANE_BITS);
+        layout.grayBits = std::min(n - layout.laneBits, BLOCK_BITS);
+        layout.validLanes = layout.laneBits == LANE_BITS ? ~Word(0) : (Word(1) << (size_t(1) << layout.laneBits)) - 1;
+        layout.laneTable = stateTable(probaMap, sub.nodes, 0, layout.laneBits);
+        layout.laneTable.resize(LANES, 0.0);
+        std::vector<double> table = stateTable(probaMap, sub.nodes, layout.laneBits, layout.grayBits);
+        layout.grayTable.resize(table.size());
+        for (size_t i = 0; i < table.size(); ++i)
+        {
+            layout.grayTable[i] = table[i ^ (i >> 1)];
+        }
+
+        // Step 2: Evaluate the blocks of the remaining components
+        const size_t blockBits = n - layout.laneBits - layout.grayBits;
+        const size_t numBlocks = size_t(1) << blockBits;
+        std::vector<double> blockSums(numBlocks, 0.0);
+
+        #pragma omp parallel if (parallel)
+        {
+            std::vector<Word> state(n + 2);
+            std::vector<Word> reach(n + 2);
+            std::vector<Word> connected(layout.grayTable.size());
+
+            #pragma omp for schedule(dynamic)
+            for (size_t block = 0; block < numBlocks; ++block)
+            {
+                double blockProba = 1.0;
+                for (size_t k = 0; k < blockBits; ++k)
+                {
+                    const double p = probaMap[sub.nodes[layout.laneBits + layout.grayBits + k]];
+                    blockProba *= ((block >> k) & 1) ? p : 1.0 - p;
+                }
+                if (blockProba > 0.0)
+                {
+                    blockSums[block] = blockProba * evalBlock(sub, layout, block, state, reach, connected);
+                }
+            }
+        }
+
+        // Step 3: Sum the blocks in order, so the result does not depend on the number of threads
+        double availability = 0.0;
+        for (double sum : blockSums)
+        {
+            availability += sum;
+        }
+
+        stats::add(&stats::PairStats::terms, size_t(1) << n);
+
+        return endpoints * availability;
+    }
+
+    double evalAvail(const Graph &graph, NodeID src, NodeID dst, const ProbabilityMap &probaMap, bool parallel,
+                     stats::PairStats *pairStats)
+    {
+        std::vector<NodeID> nodes = components(graph, src, dst);
+        checkComponents(src, dst, nodes.size());
+        return evalComponents(graph, src, dst, probaMap, std::move(nodes), parallel, pairStats);
+    }
+
+    std::vector<AvailTriple> evalAvailTopo(const Graph &graph, const NodePairs &nodePairs, const ProbabilityMap &probaMap,
+                                           bool parallel, std::vector<stats::PairStats> *statsList)
+    {
+        std::vector<AvailTriple> availList(nodePairs.size());
+
+        // Prepare one stats record per pair if requested
+        if (statsList)
+        {
+            statsList->assign(nodePairs.size(), {});
+        }
+
+        // Step 1: Find the components of every pair and check them before the parallel region, an exception must not leave it
+        std::vector<std::vector<NodeID>> componentsList(nodePairs.size());
+
+        #pragma omp parallel for schedule(dynamic) if (parallel)
+        for (size_t i = 0; i < nodePairs.size(); ++i)
+        {
+            componentsList[i] = components(graph, nodePairs[i].first, nodePairs[i].second);
+        }
+        for (size_t i = 0; i < nodePairs.size(); ++i)
+        {
+            checkComponents(nodePairs[i].first, nodePairs[i].second, componentsList[i].size());
+        }
+
+        // Step 2: Evaluate the pairs
+        #pragma omp parallel for schedule(dynamic) if (parallel)
+        for (size_t i = 0; i < nodePairs.size(); ++i)
+        {
+            const auto &[src, dst] = nodePairs[i];
+            double availability = evalComponents(graph, src, dst, probaMap, std::move(componentsList[i]), false,
+                                                 statsList ? &(*statsList)[i] : nullptr);
+            availList[i] = std::make_tuple(src, dst, availability);
+        }
+
+        return availList;
+    }
+
+    std::vector<AvailTriple> evalAvailTopoGraph(const Graph &graph, const NodePairs &nodePairs, const ProbabilityMap &probaMap,
+                                                Engine engine, size_t threshold, size_t order, bool parallel,
+                                                ExhaustiveInfo *info)
+    {
+        threshold = std::min(threshold, MAX_COMPONENTS);
+        std::vector<AvailTriple> availList(nodePairs.size());
+        std::vector<char> exhaustive(nodePairs.size(), 0);
+        std::vector<size_t> states(nodePairs.size(), 0);
+
+        #pragma omp parallel for schedule(dynamic) if (parallel)
+        for (size_t i = 0; i < nodePairs.size(); ++i)
+        {
+            const auto &[src, dst] = nodePairs[i];
+            double availability = 0.0;
+
+            // Small pairs skip the path set enumeration
+            std::vector<NodeID> nodes = components(graph, src, dst);
+            if (nodes.size() <= threshold)
+            {
+                stats::PairStats pairStats;
+                availability = evalComponents(graph, src, dst, probaMap, std::move(nodes), false, &pairStats);
+                exhaustive[i] = 1;
+                states[i] = pairStats.terms;
+            }
+            else
+            {
+                PathSets pathSets = enumeration::minimalPaths(graph, src, dst);
+                MinCutSets minCutSets;
+                if (engine == Engine::MCS)
+                {
+                    minCutSets = enumeration::minimalCuts(pathSets, src, dst, order);
+                }
+                availability = selector::evalAvailWith(engine, src, dst, probaMap, pathSets, minCutSets, nullptr);
+            }
+            availList[i] = std::make_tuple(src, dst, availability);
+        }
+
+        if (info)
+        {
+            info->exhaustivePairs = std::count(exhaustive.begin(), exhaustive.end(), 1);
+            info->enginePairs = nodePairs.size() - info->exhaustivePairs;
+            info->states = std::accumulate(states.begin(), states.end(), size_t(0));
+        }
+
+        return availList;
+    }
+
+} // namespace pyrbdpp::exhaustive
\ No newline at end of file
@@ -0,0 +1,212 @@
+#include <pyrbd_plusplus/factoring.hpp>
+#include <atomic>
+#include <memory>
+#include <omp.h>
+
+namespace pyrbdpp::factoring
+{
+    WorkGraph::WorkGraph(const Graph &graph) : adjacency(graph.size() + 1, graph.makeMask())
+    {
+        for (NodeID node = 1; node <= graph.size(); ++node)
+        {
+            adjacency[node] = graph.neighborMask(node);
+        }
+    }
+
+    WorkGraph WorkGraph::fork() const
+    {
+        WorkGraph copy;
+        copy.adjacency = adjacency;
+        return copy;
+    }
+
+    void WorkGraph::contract(NodeID node)
+    {
+        const NodeMask neighbors = adjacency[node];
+        save(node);
+        adjacency[node].clear();
+        neighbors.forEach([&](NodeID neighbor)
+                          {
+            save(neighbor);
+            adjacency[neighbor] |= neighbors;
+            adjacency[neighbor].reset(neighbor);
+            adjacency[neighbor].reset(node); });
+    }
+
+    void WorkGraph::remove(NodeID node)
+    {
+        save(node);
+        adjacency[node].forEach([&](NodeID neighbor)
+                                {
+            save(neighbor);
+            adjacency[neighbor].reset(node); });
+        adjacency[node].clear();
+    }
+
+    void WorkGraph::undo(size_t mark)
+    {
+        while (undoLog.size() > mark)
+        {
+            auto &[node, neighbors] = undoLog.back();
+            adjacency[node] = std::move(neighbors);
+            undoLog.pop_back();
+        }
+    }
+
+    NodeID WorkGraph::pivot(NodeID src, NodeID dst) const
+    {
+        if (adjacency[src].test(dst))
+        {
+            return TRUE_PIVOT;
+        }
+
+        // Layered BFS from dst, src is never entered so the first layer touching a neighbor of src is the closest
+        NodeMask layer = adjacency[dst];
+        layer.reset(src);
+        NodeMask visited = layer;
+        visited.set(dst);
+        visited.set(src);
+        NodeMask next = layer;
+        while (layer.any())
+        {
+            NodeMask candidates = layer;
+            candidates &= adjacency[src];
+            if (candidates.any())
+            {
+                NodeID best = FALSE_PIVOT;
+                size_t bestDegree = 0;
+                candidates.forEach([&](NodeID node)
+                                   {
+                    size_t degree = adjacency[node].count();
+                    if (best == FALSE_PIVOT || degree > bestDegree)
+                    {
+                        best = node;
+                        bestDegree = degree;
+                    } });
+                return best;
+            }
+
+            next.clear();
+            layer.forEach([&](NodeID node)
+                          { next |= adjacency[node]; });
+            next.subtract(visited);
+            visited |= next;
+            std::swap(layer, next);
+        }
+        return FALSE_PIVOT;
+    }
+
+    // Counters of the factoring tree of a pair, shared by the tasks
+    struct Counters
+    {
+        std::atomic<size_t> branches{0};
+        std::atomic<size_t> leaves{0};
+        std::atomic<size_t> depth{0};
+    };
+
+    // Factor the graph on the pivot, the branches down to taskDepth are spawned as tasks
+    static double factor(WorkGraph &graph, NodeID src, NodeID dst, const ProbabilityMap &probaMap,
+                         size_t depth, size_t taskDepth, Counters &counters)
+    {
+        NodeID pivot = graph.pivot(src, dst);
+        if (pivot == WorkGraph::TRUE_PIVOT || pivot == WorkGraph::FALSE_PIVOT)
+        {
+            counters.leaves.fetch_add(1, std::memory_order_relaxed);
+            size_t deepest = counters.depth.load(std::memory_order_relaxed);
+            while (deepest < depth && !counters.depth.compare_exchange_weak(deepest, depth, std::memory_order_relaxed))
+            {
+            }
+            return pivot == WorkGraph::TRUE_PIVOT ? 1.0 : 0.0;
+        }
+        counters.branches.fetch_add(1, std::memory_order_relaxed);
+
+        double p = probaMap[pivot];
+        double up = 0.0;
+        double down = 0.0;
+        if (depth < taskDepth)
+        {
+            // The failed branch runs as a task on its own copy of the graph
+            auto copy = std::make_shared<WorkGraph>(graph.fork());
+            #pragma omp task default(none) shared(down, probaMap, counters) firstprivate(copy, pivot, src, dst, depth, taskDepth)
+            {
+                copy->remove(pivot);
+                down = factor(*copy, src, dst, probaMap, depth + 1, taskDepth, counters);
+            }
+
+            size_t mark = graph.mark();
+            graph.contract(pivot);
+            up = factor(graph, src, dst, probaMap, depth + 1, taskDepth, counters);
+            graph.undo(mark);
+
+            #pragma omp taskwait
+        }
+        else
+        {
+            size_t mark = graph.mark();
+            graph.contract(pivot);
+            up = factor(graph, src, dst, probaMap, depth + 1, taskDepth, counters);
+            graph.undo(mark);
+
+            graph.remove(pivot);
+            down = factor(graph, src, dst, probaMap, depth + 1, taskDepth, counters);
+            graph.undo(mark);
+        }
+        return p * up + (1.0 - p) * down;
+    }
+
+    double evalAvail(const Graph &graph, NodeID src, NodeID dst, const ProbabilityMap &probaMap, bool parallel,
+                     stats::PairStats *pairStats)
+    {
+        // Collect the stats of the pair if requested
+        stats::Scope scope(pairStats);
+        if (pairStats)
+        {
+            pairStats->src = src;
+            pairStats->dst = dst;
+        }
+
+        WorkGraph workGraph(graph);
+        Counters counters;
+        double availability = 0.0;
+        if (parallel)
+        {
+            #pragma omp parallel
+            #pragma omp single
+            availability = factor(workGraph, src, dst, probaMap, 0, DEFAULT_TASK_DEPTH, counters);
+        }
+        else
+        {
+            availability = factor(workGraph, src, dst, probaMap, 0, 0, counters);
+        }
+
+        stats::add(&stats::PairStats::decompositions, counters.branches.load());
+        stats::add(&stats::PairStats::terms, counters.leaves.load());
+        stats::raise(&stats::PairStats::queueHighWater, counters.depth.load());
+
+        // The pair is only available if src and dst work
+        return probaMap[src] * probaMap[dst] * availability;
+    }
+
+    std::vector<AvailTriple> evalAvailTopo(const Graph &graph, const NodePairs &nodePairs, const ProbabilityMap &probaMap,
+                                           bool parallel, std::vector<stats::PairStats> *statsList)
+    {
+        std::vector<AvailTriple> availList(nodePairs.size());
+
+        // Prepare one stats record per pair if requested
+        if (statsList)
+        {
+            statsList->assign(nodePairs.size(), {});
+        }
+
+        #pragma omp parallel for schedule(dynamic) if (parallel)
+        for (size_t i = 0; i < nodePairs.size(); ++i)
+        {
+            const auto &[src, dst] = nodePairs[i];
+            double availability = evalAvail(graph, src, dst, probaMap, false, statsList ? &(*statsList)[i] : nullptr);
+            availList[i] = std::make_tuple(src, dst, availability);
+        }
+
+        return availList;
+    }
+
+} // namespace pyrbdpp::factoring
\ No newline at end of file
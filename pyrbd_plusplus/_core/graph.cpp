@@ -0,0 +1,121 @@
+#include <pyrbd_plusplus/graph.hpp>
+#include <stdexcept>
+#include <unordered_map>
+
+namespace pyrbdpp
+{
+    Graph::Graph(const std::vector<std::vector<NodeID>> &adjacency, const std::vector<std::vector<double>> &edgeLengths)
+    {
+        numNodes = adjacency.empty() ? 0 : static_cast<int>(adjacency.size()) - 1;
+
+        // Count the neighbors to compute the offsets
+        offsets.assign(numNodes + 2, 0);
+        for (int node = 1; node <= numNodes; ++node)
+        {
+            offsets[node + 1] = offsets[node] + adjacency[node].size();
+        }
+
+        // Copy the neighbors in the input order
+        neighbors.reserve(offsets[numNodes + 1]);
+        for (int node = 1; node <= numNodes; ++node)
+        {
+            for (NodeID neighbor : adjacency[node])
+            {
+                if (neighbor < 1 || neighbor > numNodes)
+                {
+                    throw std::out_of_range("Neighbor " + std::to_string(neighbor) + " of node " + std::to_string(node) + " is not a node ID");
+                }
+                neighbors.push_back(neighbor);
+            }
+        }
+
+        // Copy the lengths in the same layout as the neighbors
+        if (!edgeLengths.empty())
+        {
+            if (edgeLengths.size() != adjacency.size())
+            {
+                throw std::invalid_argument("Expected lengths for " + std::to_string(adjacency.size()) + " adjacency lists, got " + std::to_string(edgeLengths.size()));
+            }
+            lengths.reserve(neighbors.size());
+            for (int node = 1; node <= numNodes; ++node)
+            {
+                if (edgeLengths[node].size() != adjacency[node].size())
+                {
+                    throw std::invalid_argument("The lengths of node " + std::to_string(node) + " do not match its neighbors");
+                }
+                for (double length : edgeLengths[node])
+                {
+                    if (length < 0.0)
+                    {
+                        throw std::invalid_argument("Negative edge length at node " + std::to_string(node));
+                    }
+                    lengths.push_back(length);
+                }
+            }
+        }
+
+        buildMasks();
+        buildEdgeIDs();
+    }
+
+    Graph Graph::fromEdges(int numNodes, const std::vector<std::pair<NodeID, NodeID>> &edges)
+    {
+        std::vector<std::vector<NodeID>> adjacency(numNodes + 1);
+        for (const auto &[u, v] : edges)
+        {
+            if (u < 1 || u > numNodes || v < 1 || v > numNodes)
+            {
+                throw std::out_of_range("Edge (" + std::to_string(u) + ", " + std::to_string(v) + ") is out of the node ID range");
+            }
+            adjacency[u].push_back(v);
+            adjacency[v].push_back(u);
+        }
+        return Graph(adjacency);
+    }
+
+    NodeID Graph::edgeID(NodeID u, NodeID v) const
+    {
+        const NodeID *edge = std::find(begin(u), end(u), v);
+        return edge == end(u) ? 0 : edgeID(edge);
+    }
+
+    void Graph::buildEdgeIDs()
+    {
+        // The first adjacency list holding an edge numbers it, the key of an edge is its smaller node first
+        edgeIDs.assign(neighbors.size(), 0);
+        edgeEndNodes.clear();
+        std::unordered_map<uint64_t, NodeID> idOf;
+        idOf.reserve(neighbors.size() / 2);
+        for (int node = 1; node <= numNodes; ++node)
+        {
+            for (const NodeID *it = begin(node); it != end(node); ++it)
+            {
+                NodeID neighbor = *it;
+                if (neighbor == node)
+                {
+                    continue;
+                }
+                uint64_t key = static_cast<uint64_t>(std::min(node, neighbor)) << 32 | static_cast<uint32_t>(std::max(node, neighbor));
+                auto [entry, inserted] = idOf.try_emplace(key, numNodes + static_cast<NodeID>(edgeEndNodes.size()) + 1);
+                if (inserted)
+                {
+                    edgeEndNodes.emplace_back(node, neighbor);
+                }
+                edgeIDs[it - neighbors.data()] = entry->second;
+            }
+        }
+    }
+
+    void Graph::buildMasks()
+    {
+        neighborMasks.assign(numNodes + 1, makeMask());
+        for (int node = 1; node <= numNodes; ++node)
+        {
+            for (const NodeID *it = begin(node); it != end(node); ++it)
+            {
+                neighborMasks[node].set(*it);
+            }
+        }
+    }
+
+} // namespace pyrbdpp
\ No newline at end of file
@@ -0,0 +1,51 @@
+#pragma once
+#include <pyrbd_plusplus/common.hpp>
+#include <pyrbd_plusplus/graph.hpp>
+#include <pyrbd_plusplus/selector.hpp>
+#include <cstdint>
+
+namespace pyrbdpp::allpairs
+{
+    // Declaration of the short types for the allpairs module
+    using Label = int64_t;
+    using LabelEdges = std::vector<std::pair<Label, Label>>;
+    using Engine = selector::Engine;
+
+    /**
+     * @brief Dense availability matrix of all pairs, row-major, index i is the i-th node label.
+     */
+    struct AvailMatrix
+    {
+        size_t numNodes = 0;
+        std::vector<double> values;
+
+        double at(size_t i, size_t j) const { return values[i * numNodes + j]; }
+    };
+
+    /**
+     * @brief Relabel the nodes to the node IDs 1..n and build the graph
+     * @param nodes Node labels, the i-th label gets the node ID i + 1
+     * @param edges Undirected edges as pairs of node labels
+     * @return The graph with the node IDs, throws std::invalid_argument for an unknown or duplicate label
+     */
+    Graph relabelGraph(const std::vector<Label> &nodes, const LabelEdges &edges);
+
+    /**
+     * @brief Evaluate the availability of all pairs of a topology entirely in C++.
+     * Algorithm:
+     * 1. Relabel the nodes to 1..n and build the CSR graph.
+     * 2. For every source, enumerate the path sets to all later nodes with a single DFS.
+     * 3. Evaluate every pair of the source with the engine (MCS enumerates the minimal cut sets up to order ceil(n / 2)
+     *    like minimalcuts_optimized()), then free the sets of the source.
+     * The sources are processed in parallel, so only the sets of the sources in progress are held in memory.
+     * @param nodes Node labels, the i-th label is row and column i of the matrix
+     * @param edges Undirected edges as pairs of node labels
+     * @param probabilities Availability of each node, in the order of the labels
+     * @param engine Engine used for every pair
+     * @param parallel True to process the sources in parallel
+     * @return Symmetric matrix, the diagonal is the availability of the node and disconnected pairs are 0
+     */
+    AvailMatrix evalAvailMatrix(const std::vector<Label> &nodes, const LabelEdges &edges, const std::vector<double> &probabilities,
+                                Engine engine = Engine::SDP, bool parallel = true);
+
+} // namespace pyrbdpp::allpairs
\ No newline at end of file
@@ -0,0 +1,177 @@
+#pragma once
+#include <pyrbd_plusplus/common.hpp>
+#include <pyrbd_plusplus/graph.hpp>
+#include <pyrbd_plusplus/stats.hpp>
+
+namespace pyrbdpp::bdd
+{
+    // Declaration of the short types for the bdd module
+    using PathSets = std::vector<Set>;
+
+    // Index of the terminal nodes of a diagram
+    inline constexpr uint32_t FALSE_NODE = 0;
+    inline constexpr uint32_t TRUE_NODE = 1;
+
+    /**
+     * @brief Variable ordering heuristics, the size of a BDD depends strongly on the order of its variables.
+     */
+    enum class Ordering
+    {
+        BFS,      // breadth-first order, keeps the frontier between the levels small on meshed graphs
+        Frequency // decreasing number of path sets containing the node (degree for a graph), ties in the BFS order
+    };
+
+    /**
+     * @brief Decision node of a diagram, the low child is taken if the variable of the level fails.
+     */
+    struct BddNode
+    {
+        uint32_t level;
+        uint32_t low;
+        uint32_t high;
+    };
+
+    /**
+     * @brief Reduced ordered BDD of the connectivity function of a pair.
+     * The diagram only depends on the structure, so it is compiled once and evaluated for any probability map.
+     */
+    struct Diagram
+    {
+        NodeID src = 0;
+        NodeID dst = 0;
+        std::vector<NodeID> order;   // node ID of the variable of every level
+        std::vector<BddNode> nodes;  // the terminals 0 and 1 first, every node after its children
+        uint32_t root = FALSE_NODE;
+        size_t maxWidth = 0;         // largest number of nodes of a level
+
+        /**
+         * @brief Number of nodes of the diagram, the two terminals included
+         */
+        size_t size() const { return nodes.size(); }
+
+        /**
+         * @brief Compute the availability with a single bottom-up pass over the nodes.
+         * P(node) = p(var) * P(high) + (1 - p(var)) * P(low), skipped levels do not change the probability.
+         * @param probaMap Probability map containing the availability of each node
+         * @return Availability between source and destination in double
+         */
+        double availability(const ProbabilityMap &probaMap) const;
+    };
+
+    /**
+     * @brief Compute the variable order of a pair from its path sets.
+     * The BFS order follows the consecutive nodes of the paths from the source.
+     * @param pathSets Path sets as node lists from src to dst
+     * @param src Source node ID
+     * @param ordering Ordering heuristic
+     * @return The node IDs in the order of the levels
+     */
+    std::vector<NodeID> variableOrder(const PathSets &pathSets, NodeID src, Ordering ordering = Ordering::BFS);
+
+    /**
+     * @brief Compute the variable order of a pair from the graph, only the nodes connected to the source are kept.
+     * The BFS order starts from a pseudo-peripheral node, the last node of repeated BFS runs from the source, so the
+     * graph is swept in layers. The frequency order is the decreasing degree, it ignores the locality of the graph.
+     * @param graph Graph in CSR layout
+     * @param src Source node ID
+     * @param ordering Ordering heuristic
+     * @return The node IDs in the order of the levels
+     */
+    std::vector<NodeID> variableOrder(const Graph &graph, NodeID src, Ordering ordering = Ordering::BFS);
+
+    /**
+     * @brief Compile the BDD of a pair from its path sets.
+     * Algorithm:
+     * 1. Every path set becomes a chain of high edges, the AND of its nodes.
+     * 2. The chains are combined with the apply operation OR. The nodes are hash-consed in a unique table, so equal
+     *    sub-diagrams are shared and nodes with equal children are dropped, and the results of OR(f, g) are kept in
+     *    a computed table, so every pair of sub-diagrams is combined once.
+     * @param pathSets Path sets as node lists from src to dst
+     * @param src Source node ID
+     * @param dst Destination node ID
+     * @param ordering Ordering heuristic
+     * @return The reduced ordered BDD of the pair
+     */
+    Diagram fromPathSets(const PathSets &pathSets, NodeID src, NodeID dst, Ordering ordering = Ordering::BFS);
+
+    /**
+     * @brief Compile the BDD of a pair directly from the graph by frontier-based construction, no path set is enumerated.
+     * Algorithm:
+     * 1. The nodes are decided level by level in the variable order. The frontier of a level holds the decided nodes
+     *    with an undecided neighbor, a state is the partition of the working frontier nodes into components with the
+     *    components of src and dst.
+     * 2. A working node joins the components of its working frontier neighbors. The state is true once src and dst
+     *    share a component and false once src or dst fails or the component of src or dst leaves the frontier.
+     * 3. Equal states of a level are merged, then the levels are reduced bottom-up through the unique table.
+     * The number of states per level only depends on the frontier width, not on the number of paths.
+     * @param graph Graph in CSR layout
+     * @param src Source node ID
+     * @param dst Destination node ID
+     * @param ordering Ordering heuristic
+     * @return The reduced ordered BDD of the pair
+     */
+    Diagram fromGraph(const Graph &graph, NodeID src, NodeID dst, Ordering ordering = Ordering::BFS);
+
+    /**
+     * @brief Evaluate the availability for a specific source and destination with the BDD of its path sets.
+     * @param src Source node ID
+     * @param dst Destination node ID
+     * @param probaMap Probability map containing the availability of each node
+     * @param pathSets Path sets for the source and destination pair
+     * @param pairStats Stats record filled with the instrumentation counters of the pair, nullptr to disable the stats
+     * @return Availability between source and destination in double
+     * @note The stats count the BDD nodes as terms and the largest level as queue high-water mark.
+     */
+    double evalAvail(NodeID src, NodeID dst, const ProbabilityMap &probaMap, const PathSets &pathSets, stats::PairStats *pairStats = nullptr);
+
+    /**
+     * @brief Evaluate the availability for each pair of source and destination nodes in a topology.
+     * @param nodePairs A vector of pairs of source and destination node IDs
+     * @param probaMap Probability map containing the availability probabilities for each node
+     * @param pathsetsList A vector of path sets for each pair of source and destination nodes
+     * @param statsList Filled with one stats record per node pair, nullptr to disable the stats
+     * @return List of (src, dst, availability) tuples
+     */
+    std::vector<AvailTriple> evalAvailTopo(const NodePairs &nodePairs, const ProbabilityMap &probaMap, const std::vector<PathSets> &pathsetsList,
+                                           std::vector<stats::PairStats> *statsList = nullptr);
+
+    /**
+     * @brief Parallel version of evalAvailTopo(), the pairs are evaluated in parallel.
+     */
+    std::vector<AvailTriple> evalAvailTopoParallel(const NodePairs &nodePairs, const ProbabilityMap &probaMap, const std::vector<PathSets> &pathsetsList,
+                                                   std::vector<stats::PairStats> *statsList = nullptr);
+
+    /**
+     * @brief Compile the BDD of each pair from the graph by frontier-based construction.
+     * @param graph Graph in CSR layout
+     * @param nodePairs A vector of pairs of source and destination node IDs
+     * @param ordering Ordering heuristic
+     * @param parallel True to compile the pairs in parallel
+     * @return A diagram for each node pair
+     */
+    std::vector<Diagram> compileTopo(const Graph &graph, const NodePairs &nodePairs, Ordering ordering = Ordering::BFS, bool parallel = true);
+
+    /**
+     * @brief Evaluate compiled diagrams with a probability map, the diagrams can be reused for any number of maps.
+     * @param diagrams Compiled diagrams, e.g. from compileTopo()
+     * @param probaMap Probability map containing the availability of each node
+     * @param parallel True to evaluate the diagrams in parallel
+     * @return List of (src, dst, availability) tuples in the order of the diagrams
+     */
+    std::vector<AvailTriple> evalDiagrams(const std::vector<Diagram> &diagrams, const ProbabilityMap &probaMap, bool parallel = true);
+
+    /**
+     * @brief Compile the BDD of each pair from the graph and evaluate its availability.
+     * @param graph Graph in CSR layout
+     * @param nodePairs A vector of pairs of source and destination node IDs
+     * @param probaMap Probability map containing the availability of each node
+     * @param ordering Ordering heuristic
+     * @param parallel True to process the pairs in parallel
+     * @param statsList Filled with one stats record per node pair, nullptr to disable the stats
+     * @return List of (src, dst, availability) tuples in the order of the pairs, disconnected pairs are 0
+     */
+    std::vector<AvailTriple> evalAvailTopoGraph(const Graph &graph, const NodePairs &nodePairs, const ProbabilityMap &probaMap,
+                                                Ordering ordering = Ordering::BFS, bool parallel = true,
+                                                std::vector<stats::PairStats> *statsList = nullptr);
+
+} // namespace pyrbdpp::bdd
\ No newline at end of file
@@ -0,0 +1,67 @@
+#pragma once
+#include <pyrbd_plusplus/common.hpp>
+#include <pyrbd_plusplus/graph.hpp>
+#include <pyrbd_plusplus/selector.hpp>
+
+namespace pyrbdpp::blockcut
+{
+    using Engine = selector::Engine;
+
+    /**
+     * @brief Biconnected blocks of a graph, the blocks and the cut vertices form the block-cut tree.
+     * A cut vertex (articulation point) belongs to several blocks, every other node to exactly one block.
+     * A bridge is a block of two nodes and an isolated node is a block of one node.
+     */
+    struct BlockCutTree
+    {
+        std::vector<Set> blocks;                // node IDs of every block, sorted
+        std::vector<std::vector<int>> blocksOf; // indices of the blocks of every node, index 0 is unused
+
+        bool isCut(NodeID node) const { return blocksOf[node].size() > 1; }
+    };
+
+    /**
+     * @brief Counters of a decomposed run
+     */
+    struct DecompositionInfo
+    {
+        size_t numBlocks = 0;        // number of biconnected blocks
+        size_t numCutVertices = 0;   // number of cut vertices
+        size_t blockEvaluations = 0; // number of distinct (block, entry, exit) evaluations, bridges excluded
+        size_t pathSets = 0;         // total number of path sets enumerated inside the blocks
+    };
+
+    /**
+     * @brief Compute the biconnected blocks with the iterative Hopcroft-Tarjan algorithm.
+     * The edges are kept on a stack during the DFS, a child with low[child] >= disc[parent] closes a block
+     * made of the edges above the tree edge (parent, child).
+     * @param graph Graph in CSR layout
+     * @return The blocks and the blocks of every node
+     */
+    BlockCutTree biconnectedComponents(const Graph &graph);
+
+    /**
+     * @brief Evaluate the availability of each pair by factoring along the block-cut tree.
+     * Algorithm:
+     * Every path from src to dst passes through the cut vertices on the tree path between them, and the blocks on that
+     * path only share these cut vertices. Conditioned on the working cut vertices the blocks are independent, so
+     *  A(src, dst) = p(src) * p(dst) * prod p(cut vertex) * prod A_B(entry, exit | entry and exit working)
+     * 1. Compute the blocks once and root every tree of the block-cut forest.
+     * 2. Collect the distinct (block, entry, exit) triples of all pairs.
+     * 3. Evaluate every triple in parallel on the subgraph of its block with the engine, the entry and exit have
+     *    the availability 1. Bridges are 1 without any evaluation. MCS limits the cut sets to the order ceil(k / 2)
+     *    for a block of k nodes, like minimalcuts_optimized().
+     * 4. Multiply the cached values along the tree path of every pair.
+     * The path sets are only enumerated inside the blocks, so tree-like regions add no paths at all.
+     * @param graph Graph in CSR layout
+     * @param nodePairs A vector of pairs of source and destination node IDs
+     * @param probaMap Probability map containing the availability of each node
+     * @param engine Engine used for the blocks
+     * @param parallel True to evaluate the blocks in parallel
+     * @param info Filled with the counters of the run, nullptr to ignore them
+     * @return List of (src, dst, availability) tuples in the order of the pairs, disconnected pairs are 0
+     */
+    std::vector<AvailTriple> evalAvailTopo(const Graph &graph, const NodePairs &nodePairs, const ProbabilityMap &probaMap,
+                                           Engine engine = Engine::SDP, bool parallel = true, DecompositionInfo *info = nullptr);
+
+} // namespace pyrbdpp::blockcut
\ No newline at end of file
@@ -0,0 +1,32 @@
+#pragma once
+#include <pyrbd_plusplus/common.hpp>
+#include <pyrbd_plusplus/enumeration.hpp>
+#include <pyrbd_plusplus/graph.hpp>
+#include <pyrbd_plusplus/selector.hpp>
+#include <pyrbd_plusplus/stats.hpp>
+
+namespace pyrbdpp::bounded
+{
+    using Engine = selector::Engine;
+    using PathBound = enumeration::PathBound;
+
+    /**
+     * @brief Evaluate the hop-bounded or length-bounded availability of each pair.
+     * The pair is available if a path within the bound works, e.g. the paths a routing policy would actually use.
+     * The path sets are enumerated with enumeration::boundedPaths(), MCS takes the minimal cut sets of the bounded
+     * path sets. Without a limit the result is the availability of minimalPaths().
+     * @param graph Graph in CSR layout, with the edge lengths for a length limit
+     * @param nodePairs A vector of pairs of source and destination node IDs
+     * @param probaMap Probability map containing the availability of each node
+     * @param engine Engine used for every pair
+     * @param bound Hop and length limits
+     * @param order Maximal size of the minimal cut sets for MCS, 0 for no limit
+     * @param parallel True to process the pairs in parallel
+     * @param statsList Filled with one stats record per node pair, nullptr to disable the stats
+     * @return List of (src, dst, availability) tuples in the order of the pairs, 0 if no path is within the bound
+     */
+    std::vector<AvailTriple> evalAvailTopo(const Graph &graph, const NodePairs &nodePairs, const ProbabilityMap &probaMap,
+                                           Engine engine, const PathBound &bound, size_t order = 0, bool parallel = true,
+                                           std::vector<stats::PairStats> *statsList = nullptr);
+
+} // namespace pyrbdpp::bounded
\ No newline at end of file
@@ -0,0 +1,97 @@
+#pragma once
+#include <pyrbd_plusplus/common.hpp>
+#include <chrono>
+#include <functional>
+
+namespace pyrbdpp
+{
+    /**
+     * @brief Lower and upper bound of the availability of a pair produced by the anytime evaluation.
+     * The exact availability is always within [lower, upper].
+     */
+    struct AvailBounds
+    {
+        NodeID src = 0;
+        NodeID dst = 0;
+        double lower = 0.0;     // sum of the probability mass of the evaluated disjoint terms
+        double upper = 1.0;     // lower plus an upper bound of the mass not evaluated yet
+        size_t processed = 0;   // number of evaluated work units (path sets of SDP, expansion rounds of PathSet)
+        size_t total = 0;       // number of work units known so far
+        double elapsed = 0.0;   // seconds since the start of the evaluation
+        bool converged = false; // true if upper - lower < epsilon or the evaluation is complete
+    };
+
+    /**
+     * @brief Stop criteria and reporting of the anytime evaluation.
+     */
+    struct BoundsOptions
+    {
+        double epsilon = 1e-9;       // stop if upper - lower < epsilon
+        double deadline = 0.0;       // stop after this many seconds, no deadline if <= 0
+        double reportInterval = 0.0; // minimal seconds between two callback calls, 0 reports every work unit
+    };
+
+    /**
+     * @brief Callback streaming the intermediate bounds, return false to stop the evaluation.
+     */
+    using BoundsCallback = std::function<bool(const AvailBounds &)>;
+
+    /**
+     * @brief Book-keeping of the anytime evaluation shared by the engines.
+     * The tracker owns the bounds of one pair, checks the stop criteria and calls the callback.
+     */
+    class BoundsTracker
+    {
+    public:
+        using Clock = std::chrono::steady_clock;
+
+    private:
+        AvailBounds bounds;
+        const BoundsOptions &options;
+        const BoundsCallback &callback;
+        Clock::time_point start;
+        Clock::time_point deadline;
+        Clock::time_point lastReport;
+        bool stopped = false;
+
+    public:
+        /**
+         * @brief Create a tracker for a pair
+         * @param src Source node ID
+         * @param dst Destination node ID
+         * @param options Stop criteria and reporting options
+         * @param callback Callback for the intermediate bounds, may be empty
+         * @param deadline Absolute deadline, Clock::time_point::max() for none
+         */
+        BoundsTracker(NodeID src, NodeID dst, const BoundsOptions &options, const BoundsCallback &callback,
+                      Clock::time_point deadline);
+
+        /**
+         * @brief Compute the absolute deadline of the options from now
+         */
+        static Clock::time_point deadlineOf(const BoundsOptions &options);
+
+        /**
+         * @brief Update the bounds after some work units
+         * @param lower New lower bound
+         * @param remaining Upper bound of the mass not evaluated yet, the upper bound is min(1, lower + remaining)
+         * @param processed Number of evaluated work units
+         * @param total Number of known work units
+         * @return True if the evaluation should continue, false if a stop criterion is met
+         */
+        bool update(double lower, double remaining, size_t processed, size_t total);
+
+        /**
+         * @brief Finish the evaluation, calls the callback a last time
+         * @param complete True if all work units were evaluated, then lower is exact and upper is set to lower
+         * @return The final bounds
+         */
+        AvailBounds finish(bool complete);
+
+        /**
+         * @brief Check if the deadline has passed
+         */
+        bool expired() const { return Clock::now() >= deadline; }
+    };
+
+} // namespace pyrbdpp
\ No newline at end of file
@@ -35,6 +35,20 @@ namespace pyrbdpp
             }
         }
 
+        // The node availabilities followed by the edge availabilities, edge_avail[k] is the literal avail_arr.size() + 1 + k,
+        // the edge ID of Graph::edgeID() when avail_arr holds every node of the graph
+        ProbabilityMap(const std::map<int, double> &avail_arr, const std::vector<double> &edge_avail) : ProbabilityMap(avail_arr)
+        {
+            size_t offset = pos_array.size();
+            pos_array.resize(offset + edge_avail.size());
+            neg_array.resize(offset + edge_avail.size());
+            for (size_t k = 0; k < edge_avail.size(); ++k)
+            {
+                pos_array[offset + k] = edge_avail[k];
+                neg_array[offset + k] = 1 - edge_avail[k];
+            }
+        }
+
         ProbabilityMap(std::initializer_list<std::pair<const int, double>> init_list)
         {
             int max_id = 0;
@@ -72,6 +86,9 @@ namespace pyrbdpp
             }
         }
 
+        // Number of literals, the largest ID of the map
+        size_t size() const { return pos_array.size() - 1; }
+
         void print() const
         {
             std::cout << "Positive Array: ";
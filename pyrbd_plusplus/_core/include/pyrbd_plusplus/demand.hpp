@@ -0,0 +1,89 @@
+#pragma once
+#include <pyrbd_plusplus/common.hpp>
+#include <pyrbd_plusplus/graph.hpp>
+#include <pyrbd_plusplus/selector.hpp>
+
+namespace pyrbdpp::demand
+{
+    using Engine = selector::Engine;
+    using MinCutSets = selector::MinCutSets;
+    using PathSets = selector::PathSets;
+
+    /**
+     * @brief Traffic from src to dst, the availability of the pair does not depend on the direction
+     */
+    struct Demand
+    {
+        NodeID src = 0;
+        NodeID dst = 0;
+        double weight = 0.0;
+    };
+    using Demands = std::vector<Demand>;
+
+    /**
+     * @brief Reductions computed over the demands
+     */
+    struct Reductions
+    {
+        bool mean = true;       // demand-weighted mean availability
+        bool minimum = true;    // least available pair
+        size_t worst = 0;       // number of least available pairs to keep, 0 to skip them
+        bool perSource = false; // demand-weighted mean availability of the demands of every source
+    };
+
+    /**
+     * @brief Compact result of the reductions, the fields of the reductions not requested keep their defaults
+     */
+    struct DemandSummary
+    {
+        size_t demands = 0;                               // number of demands with a positive weight
+        size_t pairs = 0;                                 // number of distinct pairs of these demands
+        double totalDemand = 0.0;                         // sum of the weights
+        double weightedMean = 1.0;                        // sum of weight * availability over the total demand
+        AvailTriple minimum{0, 0, 1.0};                   // least available pair
+        std::vector<AvailTriple> worst;                   // least available pairs in increasing availability
+        std::vector<std::pair<NodeID, double>> perSource; // (source, weighted mean) of every source with a demand
+    };
+
+    /**
+     * @brief Read the demands of a dense row-major matrix, entry (i, j) is the traffic from node i + 1 to node j + 1
+     * @param matrix Row-major demand matrix of numNodes * numNodes entries
+     * @param numNodes Number of rows and columns
+     * @return The demands with a nonzero weight, the diagonal is ignored
+     * @note Throws std::invalid_argument if the matrix does not have numNodes * numNodes entries.
+     */
+    Demands fromMatrix(const std::vector<double> &matrix, size_t numNodes);
+
+    /**
+     * @brief Reduce the availability of evaluated pairs over the demands.
+     * The demands are grouped by source and the groups are reduced in chunks in parallel, the partial results of the
+     * chunks are merged in chunk order, so the result does not depend on the scheduling. The minimum and the worst
+     * pairs are taken over the distinct pairs, ties broken by the order of the pairs.
+     * @param availList List of (src, dst, availability) tuples, e.g. from an evalAvailTopo()
+     * @param demands Demands, the demands of weight 0 and from a node to itself are skipped
+     * @param reductions Reductions to compute
+     * @param parallel True to reduce the chunks in parallel
+     * @return The summary of the demands
+     * @note Throws std::invalid_argument if a weight is negative or a demand has no pair in availList.
+     */
+    DemandSummary reduce(const std::vector<AvailTriple> &availList, const Demands &demands, const Reductions &reductions,
+                         bool parallel = true);
+
+    /**
+     * @brief Evaluate the pairs with a demand and reduce their availability over the demands.
+     * Only the distinct pairs of the demands with a positive weight are enumerated and evaluated (in parallel), the
+     * other pairs are skipped entirely and the n^2 availabilities are never returned.
+     * @param graph Graph in CSR layout
+     * @param demands Demands, the demands of weight 0 and from a node to itself are skipped
+     * @param probaMap Probability map containing the availability of each node
+     * @param reductions Reductions to compute
+     * @param engine Engine evaluating the pairs
+     * @param order Maximal size of the cut sets for MCS, 0 for no limit
+     * @param parallel True to evaluate the pairs and reduce the chunks in parallel
+     * @return The summary of the demands, disconnected pairs have the availability 0
+     * @note Throws std::invalid_argument if a weight is negative or a node is not in the graph.
+     */
+    DemandSummary evalAvailTopo(const Graph &graph, const Demands &demands, const ProbabilityMap &probaMap,
+                                const Reductions &reductions, Engine engine = Engine::SDP, size_t order = 0, bool parallel = true);
+
+} // namespace pyrbdpp::demand
\ No newline at end of file
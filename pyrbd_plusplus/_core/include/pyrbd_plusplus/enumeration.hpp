@@ -0,0 +1,227 @@
+#pragma once
+#include <pyrbd_plusplus/common.hpp>
+#include <pyrbd_plusplus/graph.hpp>
+
+namespace pyrbdpp::enumeration
+{
+    // Declaration of the short types for the enumeration module
+    using PathSets = std::vector<Set>;
+    using MinCutSets = std::vector<Set>;
+
+    /**
+     * @brief Enumerate the minimal path sets between the source and destination nodes.
+     * Algorithm:
+     * Depth first search with the same rule as minimalpaths() in sets/pathsets.py:
+     * a node is not expanded if it is a neighbor of a visited node other than the current one,
+     * because the path would then have a shortcut and not be minimal.
+     * The visited nodes and the forbidden neighbors are kept as bitsets, the forbidden mask of each depth is
+     * the mask of the previous depth combined with the neighbors of the previous node.
+     * e.g. for the ring 1-2-3-4-1 and the pair (1, 3) the path sets are {1, 2, 3} and {1, 4, 3}.
+     * @param graph Graph in CSR layout
+     * @param src Source node ID
+     * @param dst Destination node ID
+     * @return Path sets as node lists from src to dst, in the order of the DFS over the adjacency lists
+     */
+    PathSets minimalPaths(const Graph &graph, NodeID src, NodeID dst);
+
+    /**
+     * @brief The parallel version of minimalPaths().
+     * The DFS is split at the first branching levels: the path prefixes are expanded level by level until there are
+     * enough prefixes for all threads, then every prefix is finished with a serial DFS in parallel.
+     * The result has the same order as minimalPaths().
+     * @param graph Graph in CSR layout
+     * @param src Source node ID
+     * @param dst Destination node ID
+     * @return Path sets as node lists from src to dst
+     */
+    PathSets minimalPathsParallel(const Graph &graph, NodeID src, NodeID dst);
+
+    /**
+     * @brief Enumerate the minimal path sets for each pair of source and destination nodes.
+     * @param graph Graph in CSR layout
+     * @param nodePairs A vector of pairs of source and destination node IDs
+     * @return A vector of path sets for each node pair
+     */
+    std::vector<PathSets> minimalPathsTopo(const Graph &graph, const NodePairs &nodePairs);
+
+    /**
+     * @brief The parallel version of minimalPathsTopo(), the pairs are enumerated in parallel.
+     */
+    std::vector<PathSets> minimalPathsTopoParallel(const Graph &graph, const NodePairs &nodePairs);
+
+    /**
+     * @brief Enumerate the minimal path sets from a source to several destinations with a single DFS.
+     * The DFS continues through the destinations, so every prefix is explored once instead of once per destination.
+     * The path sets of each destination are the same and in the same order as minimalPaths(graph, src, dst).
+     * @param graph Graph in CSR layout
+     * @param src Source node ID
+     * @param targets Destination node IDs, must be distinct
+     * @return A vector of path sets for each destination, in the order of the targets
+     */
+    std::vector<PathSets> minimalPathsFromSource(const Graph &graph, NodeID src, const std::vector<NodeID> &targets);
+
+    /**
+     * @brief Enumerate the minimal path sets for each pair with one DFS per source.
+     * The pairs are grouped by source and each group is enumerated with minimalPathsFromSource().
+     * @param graph Graph in CSR layout
+     * @param nodePairs A vector of pairs of source and destination node IDs
+     * @return A vector of path sets for each node pair, the same as minimalPathsTopo()
+     */
+    std::vector<PathSets> minimalPathsTopoFromSources(const Graph &graph, const NodePairs &nodePairs);
+
+    /**
+     * @brief The parallel version of minimalPathsTopoFromSources(), the sources are enumerated in parallel.
+     */
+    std::vector<PathSets> minimalPathsTopoFromSourcesParallel(const Graph &graph, const NodePairs &nodePairs);
+
+    /**
+     * @brief Limits of the bounded enumeration, 0 disables a limit.
+     */
+    struct PathBound
+    {
+        size_t maxHops = 0;     // maximal number of edges of a path
+        double maxLength = 0.0; // maximal sum of the edge lengths of a path, see Graph::length()
+    };
+
+    /**
+     * @brief Enumerate the minimal path sets between the source and destination nodes over the paths within the bound.
+     * The bounded system works if a path within the bound works, its minimal path sets are the minimal node sets of
+     * these paths. The search prunes a prefix as soon as its hops (or length) plus the shortest distance from its
+     * last node to dst exceed the bound, the distances are computed once with a BFS (or Dijkstra) from dst.
+     * With a hop limit only, a shortcut is always a shorter path, so the minimality rule of minimalPaths() still
+     * applies and the result is the subset of minimalPaths() within the hop limit, in the same order.
+     * With a length limit, a shortcut can be longer, so all simple paths within the bound are enumerated
+     * and the node sets that contain another one are removed.
+     * @param graph Graph in CSR layout
+     * @param src Source node ID
+     * @param dst Destination node ID
+     * @param bound Hop and length limits
+     * @return Path sets as node lists from src to dst, in the order of the DFS, empty if no path is within the bound
+     */
+    PathSets boundedPaths(const Graph &graph, NodeID src, NodeID dst, const PathBound &bound);
+
+    /**
+     * @brief Enumerate the bounded minimal path sets for each pair of source and destination nodes.
+     * @param graph Graph in CSR layout
+     * @param nodePairs A vector of pairs of source and destination node IDs
+     * @param bound Hop and length limits
+     * @return A vector of path sets for each node pair
+     */
+    std::vector<PathSets> boundedPathsTopo(const Graph &graph, const NodePairs &nodePairs, const PathBound &bound);
+
+    /**
+     * @brief The parallel version of boundedPathsTopo(), the pairs are enumerated in parallel.
+     */
+    std::vector<PathSets> boundedPathsTopoParallel(const Graph &graph, const NodePairs &nodePairs, const PathBound &bound);
+
+    /**
+     * @brief Minimal path sets of a truncated enumeration with the bound of the paths left out.
+     */
+    struct ProbablePaths
+    {
+        PathSets pathSets;      // path sets in decreasing order of their probability
+        double remaining = 0.0; // upper bound of the probability that a path left out works and no kept one does
+        size_t open = 0;        // number of prefixes left in the queue
+        bool complete = false;  // true if every minimal path set was enumerated, remaining is 0 then
+    };
+
+    /**
+     * @brief Enumerate the minimal path sets in decreasing order of their probability until the rest is negligible.
+     * Algorithm:
+     * Best-first search over the prefixes of the DFS of minimalPaths(), with the same minimality rule. The priority
+     * of a prefix is the product of the availabilities of its nodes and of dst, an upper bound of the probability
+     * of every path through it, so the path sets leave the queue in decreasing order of their probability.
+     * A prefix is dropped once dst can not be reached from its last node without a visited or forbidden node.
+     * Every minimal path set not enumerated yet extends a prefix of the queue, so the probability that one of them
+     * works is at most the sum of the priorities in the queue. The search stops once this sum is below epsilon.
+     * @param graph Graph in CSR layout
+     * @param src Source node ID
+     * @param dst Destination node ID
+     * @param probaMap Probability map containing the availability of each node
+     * @param epsilon Stop once the bound of the paths left out is below epsilon, 0 enumerates all path sets
+     * @param maxPaths Stop once this many path sets are enumerated, 0 for no limit
+     * @return The path sets as node lists from src to dst and the bound of the paths left out
+     */
+    ProbablePaths probablePaths(const Graph &graph, NodeID src, NodeID dst, const ProbabilityMap &probaMap, double epsilon,
+                                size_t maxPaths = 0);
+
+    /**
+     * @brief Check that the probability map holds a literal for every node and edge of the graph
+     * @note Throws std::invalid_argument if the probability map does not cover the edge IDs.
+     */
+    void checkLinkMap(const Graph &graph, const ProbabilityMap &probaMap);
+
+    /**
+     * @brief Enumerate the minimal path sets with link failures: every edge is a component of its own.
+     * Algorithm:
+     * The DFS of minimalPaths() with the shortcut rule restricted to the perfect edges (availability 1): a path with a
+     * failing chord is still minimal, because the shortcut needs the chord, which the path does not. The literal
+     * (Graph::edgeID()) of every failing edge of a path is inserted between its end nodes, the perfect edges have none.
+     * With every edge perfect the result is minimalPaths(), with every edge failing it is every simple path.
+     * The path sets are plain literal sets, so minimalCuts() returns the mixed node and edge cut sets and every engine
+     * evaluates them, without subdividing the edges into extra nodes.
+     * e.g. for the triangle 1-2-3 with the failing edges 4 = (1, 2), 5 = (1, 3), 6 = (2, 3) and the pair (1, 3) the
+     * path sets are {1, 4, 2, 6, 3} and {1, 5, 3}.
+     * @param graph Graph in CSR layout
+     * @param src Source node ID
+     * @param dst Destination node ID
+     * @param probaMap Probability map of the node and edge literals, e.g. ProbabilityMap(nodes, edges)
+     * @return Path sets as literal lists from src to dst in path order, in the order of the DFS over the adjacency lists
+     * @note Throws std::invalid_argument if the probability map does not cover the edge IDs.
+     */
+    PathSets linkPaths(const Graph &graph, NodeID src, NodeID dst, const ProbabilityMap &probaMap);
+
+    /**
+     * @brief Enumerate the link path sets of linkPaths() for each pair of source and destination nodes.
+     * @param parallel True to enumerate the pairs in parallel
+     */
+    std::vector<PathSets> linkPathsTopo(const Graph &graph, const NodePairs &nodePairs, const ProbabilityMap &probaMap,
+                                        bool parallel = true);
+
+    /**
+     * @brief Get the default order limit of the minimal cut sets, the one of minimalcuts() in sets/cutsets.py.
+     * @param numElements Number of components that can fail, the nodes or the nodes and edges of the link model
+     * @return ceil(numElements / 2)
+     */
+    size_t cutOrder(size_t numElements);
+
+    /**
+     * @brief Enumerate the minimal cut sets between the source and destination nodes from their path sets.
+     * Algorithm:
+     * The minimal cut sets are the minimal hitting sets of the path sets without src and dst.
+     * The search adds nodes of an uncovered path set, the path set with the fewest candidates first.
+     * Every chosen node keeps the bitset of the path sets only it hits, if a bitset becomes empty the node is
+     * redundant and the branch is pruned, so every result is minimal and no superset is generated.
+     * A candidate is excluded from the branches after its own, so every cut set is generated once.
+     * e.g. for the path sets {1, 2, 4}, {1, 3, 4} and the pair (1, 4) the result is {{1}, {4}, {2, 3}}.
+     * @param pathSets Path sets of the pair
+     * @param src Source node ID
+     * @param dst Destination node ID
+     * @param order Maximal size of the cut sets, 0 for no limit
+     * @return {src}, {dst}, then the cut sets sorted by size and lexicographically, the same layout as minimalcuts_optimized()
+     * @note Throws std::invalid_argument if there is no path set. If src and dst are neighbors, the result is {{src}, {dst}}.
+     *       The path sets of linkPaths() give the cut sets of nodes and failing edges, the edge of neighbors included.
+     */
+    MinCutSets minimalCuts(const PathSets &pathSets, NodeID src, NodeID dst, size_t order = 0);
+
+    /**
+     * @brief The parallel version of minimalCuts().
+     * The search is split after the first two chosen nodes, the remaining branches are searched in parallel.
+     */
+    MinCutSets minimalCutsParallel(const PathSets &pathSets, NodeID src, NodeID dst, size_t order = 0);
+
+    /**
+     * @brief Enumerate the minimal cut sets for each pair, the path sets are enumerated with one DFS per source.
+     * @param graph Graph in CSR layout
+     * @param nodePairs A vector of pairs of source and destination node IDs
+     * @param order Maximal size of the cut sets, 0 for no limit
+     * @return A vector of minimal cut sets for each node pair
+     */
+    std::vector<MinCutSets> minimalCutsTopo(const Graph &graph, const NodePairs &nodePairs, size_t order = 0);
+
+    /**
+     * @brief The parallel version of minimalCutsTopo(), the sources and then the pairs are processed in parallel.
+     */
+    std::vector<MinCutSets> minimalCutsTopoParallel(const Graph &graph, const NodePairs &nodePairs, size_t order = 0);
+
+} // namespace pyrbdpp::enumeration
\ No newline at end of file
@@ -0,0 +1,104 @@
+#pragma once
+#include <pyrbd_plusplus/common.hpp>
+#include <pyrbd_plusplus/graph.hpp>
+#include <pyrbd_plusplus/selector.hpp>
+#include <pyrbd_plusplus/stats.hpp>
+
+namespace pyrbdpp::exhaustive
+{
+    using Engine = selector::Engine;
+    using MinCutSets = selector::MinCutSets;
+    using PathSets = selector::PathSets;
+
+    // Largest number of components of a pair, 2^30 states
+    inline constexpr size_t MAX_COMPONENTS = 30;
+
+    // The states of LANE_BITS components are the lanes of one word, so every step of the walk evaluates LANES states
+    using Word = uint64_t;
+    inline constexpr size_t LANE_BITS = 6;
+    inline constexpr size_t LANES = size_t(1) << LANE_BITS;
+
+    // Components walked in Gray-code order inside a block, the other components select the block
+    inline constexpr size_t BLOCK_BITS = 12;
+
+    // Pairs with at most this many components take the exhaustive fast path in evalAvailTopoGraph()
+    inline constexpr size_t DEFAULT_THRESHOLD = 16;
+
+    /**
+     * @brief Counters of a run with the exhaustive fast path
+     */
+    struct ExhaustiveInfo
+    {
+        size_t exhaustivePairs = 0; // pairs evaluated over all states of their components
+        size_t enginePairs = 0;     // pairs evaluated with the set based engine
+        size_t states = 0;          // number of enumerated states
+    };
+
+    /**
+     * @brief Components of a pair: the nodes connected to src apart from src and dst, without the dangling trees.
+     * The nodes of degree one (apart from src and dst) are removed repeatedly, they are on no path between src and dst.
+     * @param graph Graph in CSR layout
+     * @param src Source node ID
+     * @param dst Destination node ID
+     * @return The node IDs of the components in increasing order, empty if dst is not connected to src or adjacent to it
+     */
+    std::vector<NodeID> components(const Graph &graph, NodeID src, NodeID dst);
+
+    /**
+     * @brief Evaluate the availability of a pair by enumerating all states of its components.
+     * Algorithm:
+     * 1. The states of the first LANE_BITS components are the LANES lanes of a word (bit-sliced), the next BLOCK_BITS
+     *    components are walked in Gray-code order and every value of the remaining components is a block. The blocks
+     *    are evaluated in parallel.
+     * 2. Every step of the walk flips one component in all lanes. The lanes in which every node is reached from src
+     *    are updated incrementally: a component turned on takes the reached lanes of its neighbors and propagates
+     *    them, a reached component turned off restarts the propagation from src.
+     * 3. The reached word of dst holds the connected lanes. The lanes are weighted with the probabilities of the lane
+     *    states and the steps with the probabilities of the walk in Gray-code order, tables computed once per pair,
+     *    in loops the compiler vectorizes.
+     * The result is exact and independent of the path sets, which makes it a reference for the other engines.
+     * @param graph Graph in CSR layout
+     * @param src Source node ID
+     * @param dst Destination node ID
+     * @param probaMap Probability map containing the availability of each node
+     * @param parallel True to evaluate the blocks in parallel
+     * @param pairStats Stats record filled with the instrumentation counters of the pair, nullptr to disable the stats
+     * @return Availability between source and destination in double
+     * @note Throws std::invalid_argument if the pair has more than MAX_COMPONENTS components.
+     *       The stats count the states as terms.
+     */
+    double evalAvail(const Graph &graph, NodeID src, NodeID dst, const ProbabilityMap &probaMap, bool parallel = false,
+                     stats::PairStats *pairStats = nullptr);
+
+    /**
+     * @brief Evaluate the availability for each pair of source and destination nodes by enumerating all states.
+     * @param graph Graph in CSR layout
+     * @param nodePairs A vector of pairs of source and destination node IDs
+     * @param probaMap Probability map containing the availability of each node
+     * @param parallel True to process the pairs in parallel
+     * @param statsList Filled with one stats record per node pair, nullptr to disable the stats
+     * @return List of (src, dst, availability) tuples in the order of the pairs, disconnected pairs are 0
+     * @note Throws std::invalid_argument if a pair has more than MAX_COMPONENTS components.
+     */
+    std::vector<AvailTriple> evalAvailTopo(const Graph &graph, const NodePairs &nodePairs, const ProbabilityMap &probaMap,
+                                           bool parallel = true, std::vector<stats::PairStats> *statsList = nullptr);
+
+    /**
+     * @brief Evaluate each pair with the exhaustive enumeration if it is small, otherwise with a set based engine.
+     * The pairs with at most threshold components skip the path set enumeration, the other pairs enumerate their
+     * path sets (and cut sets for MCS) and are evaluated with the engine.
+     * @param graph Graph in CSR layout
+     * @param nodePairs A vector of pairs of source and destination node IDs
+     * @param probaMap Probability map containing the availability of each node
+     * @param engine Engine of the larger pairs
+     * @param threshold Largest number of components of an exhaustive pair, at most MAX_COMPONENTS
+     * @param order Maximal size of the cut sets for MCS, 0 for no limit
+     * @param parallel True to process the pairs in parallel
+     * @param info Filled with the counters of the run, nullptr to ignore them
+     * @return List of (src, dst, availability) tuples in the order of the pairs, disconnected pairs are 0
+     */
+    std::vector<AvailTriple> evalAvailTopoGraph(const Graph &graph, const NodePairs &nodePairs, const ProbabilityMap &probaMap,
+                                                Engine engine = Engine::SDP, size_t threshold = DEFAULT_THRESHOLD,
+                                                size_t order = 0, bool parallel = true, ExhaustiveInfo *info = nullptr);
+
+} // namespace pyrbdpp::exhaustive
\ No newline at end of file
@@ -0,0 +1,97 @@
+#pragma once
+#include <pyrbd_plusplus/common.hpp>
+#include <pyrbd_plusplus/graph.hpp>
+#include <pyrbd_plusplus/stats.hpp>
+
+namespace pyrbdpp::factoring
+{
+    // Depth of the factoring tree down to which the branches of a parallel pair are spawned as tasks
+    inline constexpr size_t DEFAULT_TASK_DEPTH = 8;
+
+    /**
+     * @brief Adjacency bitsets of a graph modified in place, every change is recorded in an undo log.
+     */
+    class WorkGraph
+    {
+    private:
+        std::vector<NodeMask> adjacency;                  // neighbors of every node, index 0 is unused
+        std::vector<std::pair<NodeID, NodeMask>> undoLog; // previous neighbors of the modified nodes
+
+        WorkGraph() = default;
+
+        // Save the neighbors of the node before they are modified
+        void save(NodeID node) { undoLog.emplace_back(node, adjacency[node]); }
+
+    public:
+        explicit WorkGraph(const Graph &graph);
+
+        /**
+         * @brief Contract a working node: it is removed and its neighbors are connected pairwise
+         */
+        void contract(NodeID node);
+
+        /**
+         * @brief Delete a failed node with its edges
+         */
+        void remove(NodeID node);
+
+        /**
+         * @brief Copy of the current graph with an empty undo log
+         */
+        WorkGraph fork() const;
+
+        /**
+         * @brief Position in the undo log, to pass to undo()
+         */
+        size_t mark() const { return undoLog.size(); }
+
+        /**
+         * @brief Revert every change made after the mark
+         */
+        void undo(size_t mark);
+
+        /**
+         * @brief Select the next pivot of a pair with a bitset BFS from dst that does not pass src.
+         * @param src Source node ID
+         * @param dst Destination node ID
+         * @return TRUE_PIVOT if src and dst are adjacent, FALSE_PIVOT if dst can not be reached,
+         *         otherwise the neighbor of src closest to dst, the node of highest degree breaks the ties
+         */
+        NodeID pivot(NodeID src, NodeID dst) const;
+
+        static constexpr NodeID TRUE_PIVOT = -1;
+        static constexpr NodeID FALSE_PIVOT = 0;
+    };
+
+    /**
+     * @brief Evaluate the availability of a pair by pivotal decomposition (factoring) on the nodes.
+     * Algorithm (the native version of the pyrbd algorithm):
+     * A(G) = p(v) * A(G with v contracted) + (1 - p(v)) * A(G with v deleted), until src and dst are adjacent (1)
+     * or disconnected (0). The pivot v is the neighbor of src closest to dst, so every pivot is on a path and
+     * contracting it brings dst closer to src. The branches reuse one graph through the undo log, a parallel pair
+     * spawns the branches down to DEFAULT_TASK_DEPTH as tasks on copies of the graph.
+     * @param graph Graph in CSR layout
+     * @param src Source node ID
+     * @param dst Destination node ID
+     * @param probaMap Probability map containing the availability of each node
+     * @param parallel True to run the branches as parallel tasks
+     * @param pairStats Stats record filled with the instrumentation counters of the pair, nullptr to disable the stats
+     * @return Availability between source and destination in double, the same as eval_avail_pyrbd()
+     * @note The stats count the branches as decompositions, the leaves as terms and the depth as queue high-water mark.
+     */
+    double evalAvail(const Graph &graph, NodeID src, NodeID dst, const ProbabilityMap &probaMap, bool parallel = false,
+                     stats::PairStats *pairStats = nullptr);
+
+    /**
+     * @brief Evaluate the availability for each pair of source and destination nodes by factoring.
+     * @param graph Graph in CSR layout
+     * @param nodePairs A vector of pairs of source and destination node IDs
+     * @param probaMap Probability map containing the availability of each node
+     * @param parallel True to process the pairs in parallel
+     * @param statsList Filled with one stats record per node pair, nullptr to disable the stats
+     * @return List of (src, dst, availability) tuples in the order of the pairs, disconnected pairs are 0
+     */
+    std::vector<AvailTriple> evalAvailTopo(const Graph &graph, const NodePairs &nodePairs, const ProbabilityMap &probaMap,
+                                           bool parallel = true, std::vector<stats::PairStats> *statsList = nullptr);
+
+} // namespace pyrbdpp::factoring
\ No newline at end of file
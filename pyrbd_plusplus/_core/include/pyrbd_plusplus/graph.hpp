@@ -0,0 +1,194 @@
+#pragma once
+#include <pyrbd_plusplus/common.hpp>
+#include <cstdint>
+
+namespace pyrbdpp
+{
+    /**
+     * @brief Fixed size bitset over the node IDs, sized at runtime.
+     */
+    class NodeMask
+    {
+    private:
+        std::vector<uint64_t> words;
+
+    public:
+        NodeMask() = default;
+        explicit NodeMask(size_t numBits) : words((numBits + 63) / 64, 0) {}
+
+        bool test(NodeID node) const { return (words[node >> 6] >> (node & 63)) & 1; }
+        void set(NodeID node) { words[node >> 6] |= uint64_t(1) << (node & 63); }
+        void reset(NodeID node) { words[node >> 6] &= ~(uint64_t(1) << (node & 63)); }
+        void clear() { std::fill(words.begin(), words.end(), 0); }
+
+        /**
+         * @brief Set this mask to other | extra, the masks must have the same size
+         */
+        void assignUnion(const NodeMask &other, const NodeMask &extra)
+        {
+            for (size_t i = 0; i < words.size(); ++i)
+            {
+                words[i] = other.words[i] | extra.words[i];
+            }
+        }
+
+        /**
+         * @brief Check if every bit of this mask is set in the other mask, the masks must have the same size
+         */
+        bool isSubsetOf(const NodeMask &other) const
+        {
+            for (size_t i = 0; i < words.size(); ++i)
+            {
+                if (words[i] & ~other.words[i])
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        NodeMask &operator|=(const NodeMask &other)
+        {
+            for (size_t i = 0; i < words.size(); ++i)
+            {
+                words[i] |= other.words[i];
+            }
+            return *this;
+        }
+
+        NodeMask &operator&=(const NodeMask &other)
+        {
+            for (size_t i = 0; i < words.size(); ++i)
+            {
+                words[i] &= other.words[i];
+            }
+            return *this;
+        }
+
+        /**
+         * @brief Clear every bit that is set in the other mask, the masks must have the same size
+         */
+        void subtract(const NodeMask &other)
+        {
+            for (size_t i = 0; i < words.size(); ++i)
+            {
+                words[i] &= ~other.words[i];
+            }
+        }
+
+        size_t count() const
+        {
+            size_t bits = 0;
+            for (uint64_t word : words)
+            {
+                bits += __builtin_popcountll(word);
+            }
+            return bits;
+        }
+
+        bool any() const
+        {
+            return std::any_of(words.begin(), words.end(), [](uint64_t word)
+                               { return word != 0; });
+        }
+
+        /**
+         * @brief Call visit(node) for every set bit in ascending order
+         */
+        template <typename Visit>
+        void forEach(Visit visit) const
+        {
+            for (size_t i = 0; i < words.size(); ++i)
+            {
+                for (uint64_t word = words[i]; word; word &= word - 1)
+                {
+                    visit(static_cast<NodeID>(i * 64 + __builtin_ctzll(word)));
+                }
+            }
+        }
+    };
+
+    /**
+     * @brief Graph in compressed sparse row (CSR) layout with the node IDs 1..numNodes, index 0 is unused.
+     * The neighbors of a node keep the order of the input, so the enumeration order matches the networkx adjacency.
+     * An undirected graph stores every edge in both adjacency lists.
+     * The edges have optional lengths for the length-bounded enumeration, every edge has the length 1 otherwise.
+     * Every undirected edge has an ID after the node IDs for the link failure model, the k-th edge in the order of
+     * the adjacency lists gets the ID numNodes + 1 + k, so the node and edge IDs are one range of literals.
+     */
+    class Graph
+    {
+    private:
+        int numNodes = 0;
+        std::vector<size_t> offsets;     // neighbors of node v are neighbors[offsets[v] .. offsets[v + 1])
+        std::vector<NodeID> neighbors;
+        std::vector<double> lengths;     // length of every stored edge in the order of the neighbors, empty for unit lengths
+        std::vector<NodeMask> neighborMasks;
+        std::vector<NodeID> edgeIDs;                         // ID of every stored edge in the order of the neighbors
+        std::vector<std::pair<NodeID, NodeID>> edgeEndNodes; // end nodes of the k-th edge ID, in adjacency order
+
+        void buildMasks();
+        void buildEdgeIDs();
+
+    public:
+        Graph() = default;
+
+        /**
+         * @brief Build the graph from adjacency lists
+         * @param adjacency adjacency[v] is the list of neighbors of node v, adjacency[0] is ignored
+         * @param edgeLengths edgeLengths[v][k] is the length of the edge to adjacency[v][k], empty for unit lengths
+         * @note Throws std::out_of_range if a neighbor is not a node ID
+         * and std::invalid_argument if the lengths do not match the adjacency or are negative
+         */
+        explicit Graph(const std::vector<std::vector<NodeID>> &adjacency, const std::vector<std::vector<double>> &edgeLengths = {});
+
+        /**
+         * @brief Build the graph from an undirected edge list
+         * @param numNodes Number of nodes, the node IDs are 1..numNodes
+         * @param edges Undirected edges, each edge is added in both directions in the order of the list
+         */
+        static Graph fromEdges(int numNodes, const std::vector<std::pair<NodeID, NodeID>> &edges);
+
+        int size() const { return numNodes; }
+        const NodeID *begin(NodeID node) const { return neighbors.data() + offsets[node]; }
+        const NodeID *end(NodeID node) const { return neighbors.data() + offsets[node + 1]; }
+        size_t degree(NodeID node) const { return offsets[node + 1] - offsets[node]; }
+        bool isWeighted() const { return !lengths.empty(); }
+
+        /**
+         * @brief Length of the edge at a position of an adjacency list, between begin(node) and end(node)
+         */
+        double length(const NodeID *edge) const { return lengths.empty() ? 1.0 : lengths[edge - neighbors.data()]; }
+
+        /**
+         * @brief Number of undirected edges, the edge IDs are numNodes + 1 .. numNodes + numEdges()
+         */
+        int numEdges() const { return static_cast<int>(edgeEndNodes.size()); }
+
+        /**
+         * @brief Edge ID of the edge at a position of an adjacency list, between begin(node) and end(node), 0 for a self-loop
+         */
+        NodeID edgeID(const NodeID *edge) const { return edgeIDs[edge - neighbors.data()]; }
+
+        /**
+         * @brief Edge ID of the edge (u, v), 0 if the nodes are not adjacent
+         */
+        NodeID edgeID(NodeID u, NodeID v) const;
+
+        /**
+         * @brief End nodes of an edge ID, in the order of the first adjacency list holding the edge
+         */
+        const std::pair<NodeID, NodeID> &edgeEnds(NodeID edge) const { return edgeEndNodes[edge - numNodes - 1]; }
+
+        /**
+         * @brief Neighbors of a node as bitset, used for the forbidden masks of the enumeration
+         */
+        const NodeMask &neighborMask(NodeID node) const { return neighborMasks[node]; }
+
+        /**
+         * @brief Create an empty mask able to hold all node IDs of the graph
+         */
+        NodeMask makeMask() const { return NodeMask(numNodes + 1); }
+    };
+
+} // namespace pyrbdpp
\ No newline at end of file
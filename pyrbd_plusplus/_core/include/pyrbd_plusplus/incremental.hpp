@@ -0,0 +1,142 @@
+#pragma once
+#include <pyrbd_plusplus/common.hpp>
+#include <pyrbd_plusplus/graph.hpp>
+#include <pyrbd_plusplus/selector.hpp>
+#include <map>
+#include <set>
+
+namespace pyrbdpp::incremental
+{
+    using Engine = selector::Engine;
+    using MinCutSets = selector::MinCutSets;
+    using PathSets = selector::PathSets;
+    using Edge = std::pair<NodeID, NodeID>;
+
+    /**
+     * @brief Counters of the edits and evaluations of an incremental topology
+     */
+    struct IncrementalInfo
+    {
+        size_t edits = 0;        // number of edits that changed the topology or an availability
+        size_t enumerations = 0; // number of pairs whose path sets were enumerated
+        size_t evaluations = 0;  // number of pairs evaluated
+        size_t lastDirty = 0;    // number of pairs refreshed by the last evaluate()
+    };
+
+    /**
+     * @brief Topology with the cached availability of its pairs, refreshed pair by pair after every edit.
+     * The minimal path sets of a pair are the induced paths between src and dst, so an edit only changes the pairs below
+     * (the cut sets of MCS are computed from the path sets and contain no other node):
+     * - Removing the edge (u, v) changes the pairs with a path set using the edge, found with the edge index. A path
+     *   set that becomes minimal had (u, v) as its only shortcut, so the shortcut path was a path set of the pair.
+     * - Adding the edge (u, v) changes the pairs with a simple path through the edge in the new graph, the pairs whose
+     *   block-cut tree path passes the block of the edge (blockcut::biconnectedComponents()).
+     * - Changing the availability of a node changes the pairs with a path set containing it, found with the node
+     *   index, their path sets are kept.
+     * The edits only mark the pairs dirty, evaluate() refreshes the dirty pairs in parallel and keeps the others.
+     */
+    class IncrementalTopology
+    {
+    private:
+        struct PairState
+        {
+            PathSets pathSets;
+            double availability = 0.0;
+            bool enumerate = true; // the path sets are out of date
+            bool evaluate = true;  // the availability is out of date
+        };
+
+        std::vector<std::set<NodeID>> adjacency;
+        std::map<int, double> availabilities;
+        NodePairs nodePairs;
+        Engine engine;
+        size_t order;
+        bool parallel;
+
+        Graph graph;
+        std::vector<PairState> pairs;
+        std::vector<std::set<size_t>> nodeIndex;     // pairs with a path set containing the node
+        std::map<Edge, std::set<size_t>> edgeIndex;  // pairs with a path set using the edge, smaller node first
+        IncrementalInfo info_;
+
+        // Check that the node is a node of the topology
+        void checkNode(NodeID node) const;
+
+        // Rebuild the CSR graph from the adjacency sets
+        void rebuildGraph();
+
+        // Mark a pair dirty, return true if it was clean
+        bool markDirty(size_t index, bool enumerate);
+
+        // Remove or add the entries of the path sets of a pair in the indices
+        void unindex(size_t index);
+        void index(size_t index);
+
+    public:
+        /**
+         * @brief Create the topology, every pair is dirty until the first evaluate()
+         * @param numNodes Number of nodes, the node IDs are 1..numNodes
+         * @param edges Edges of the topology
+         * @param probabilities Availability of each node
+         * @param nodePairs Pairs of source and destination node IDs to keep up to date
+         * @param engine Engine evaluating the pairs
+         * @param order Maximal size of the cut sets for MCS, 0 for no limit
+         * @param parallel True to refresh the dirty pairs in parallel
+         */
+        IncrementalTopology(int numNodes, const std::vector<Edge> &edges, const std::map<int, double> &probabilities,
+                            const NodePairs &nodePairs, Engine engine = Engine::SDP, size_t order = 0, bool parallel = true);
+
+        /**
+         * @brief Add an edge and mark the pairs with a simple path through it dirty
+         * @return Number of pairs newly marked dirty, 0 if the edge already exists
+         * @note Throws std::invalid_argument if a node is not in the topology or u == v.
+         */
+        size_t addEdge(NodeID u, NodeID v);
+
+        /**
+         * @brief Remove an edge and mark the pairs with a path set using it dirty
+         * @return Number of pairs newly marked dirty, 0 if the edge does not exist
+         * @note Throws std::invalid_argument if a node is not in the topology.
+         */
+        size_t removeEdge(NodeID u, NodeID v);
+
+        /**
+         * @brief Change the availability of a node and mark the pairs with a path set containing it dirty
+         * @return Number of pairs newly marked dirty
+         * @note Throws std::invalid_argument if the node is not in the topology.
+         */
+        size_t setAvailability(NodeID node, double availability);
+
+        /**
+         * @brief Refresh the dirty pairs, their path sets are enumerated again only after a change of the edges
+         * @return List of (src, dst, availability) tuples in the order of the pairs, disconnected pairs are 0
+         */
+        std::vector<AvailTriple> evaluate();
+
+        /**
+         * @brief Indices of the pairs refreshed by the next evaluate()
+         */
+        std::vector<size_t> dirtyPairs() const;
+
+        /**
+         * @brief Indices of the pairs with a path set containing the node
+         */
+        std::vector<size_t> pairsOfNode(NodeID node) const;
+
+        /**
+         * @brief Indices of the pairs with a path set using the edge
+         */
+        std::vector<size_t> pairsOfEdge(NodeID u, NodeID v) const;
+
+        /**
+         * @brief The current topology in CSR layout
+         */
+        const Graph &currentGraph() const { return graph; }
+
+        /**
+         * @brief Counters of the edits and evaluations so far
+         */
+        const IncrementalInfo &info() const { return info_; }
+    };
+
+} // namespace pyrbdpp::incremental
\ No newline at end of file
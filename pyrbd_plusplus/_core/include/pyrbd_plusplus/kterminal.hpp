@@ -0,0 +1,65 @@
+#pragma once
+#include <pyrbd_plusplus/common.hpp>
+#include <pyrbd_plusplus/graph.hpp>
+
+namespace pyrbdpp::kterminal
+{
+    // Declaration of the short types for the kterminal module
+    using Terminals = std::vector<NodeID>;
+
+    // Largest number of frontier nodes, the labels of a state are signed bytes
+    inline constexpr size_t MAX_FRONTIER = 127;
+
+    // Smallest number of states of a level expanded in parallel, smaller levels are expanded by one thread
+    inline constexpr size_t PARALLEL_STATES = 1024;
+
+    /**
+     * @brief Counters of the frontier-based evaluation of a terminal set
+     */
+    struct FrontierInfo
+    {
+        size_t levels = 0;      // number of decided nodes, the nodes connected to the first terminal
+        size_t maxFrontier = 0; // largest number of decided nodes with an undecided neighbor
+        size_t maxStates = 0;   // largest number of states of a level
+        size_t states = 0;      // number of states over all levels
+    };
+
+    /**
+     * @brief Evaluate the k-terminal reliability: the probability that all terminals work and are connected.
+     * Algorithm (frontier-based, the states of bdd::fromGraph() with the probabilities summed instead of a diagram):
+     * 1. The nodes connected to the first terminal are decided level by level in the BFS order of bdd::variableOrder().
+     *    A state is the partition of the working frontier nodes into components, a component is marked once it
+     *    contains a terminal. Equal states of a level are merged and their probabilities summed.
+     * 2. A working node joins the components of its working frontier neighbors. A state succeeds once all terminals
+     *    are decided and share one component, the undecided nodes do not matter then. It fails once a terminal fails
+     *    or a marked component leaves the frontier without the other terminals.
+     * 3. The states of large levels are expanded in parallel, each thread merges its states and the threads are
+     *    merged in order, so the result does not depend on the scheduling.
+     * One computation answers the whole terminal set instead of combining the availability of its pairs, and the
+     * number of states only depends on the frontier width.
+     * @param graph Graph in CSR layout
+     * @param terminals Node IDs of the terminals, every node for the all-terminal reliability
+     * @param probaMap Probability map containing the availability of each node
+     * @param parallel True to expand the large levels in parallel
+     * @param info Filled with the counters of the evaluation, nullptr to ignore them
+     * @return Reliability of the terminal set in double, equal to the availability of the pair for two terminals
+     * @note Throws std::invalid_argument if terminals is empty or the frontier exceeds MAX_FRONTIER.
+     *       With node failures the all-terminal reliability is the product of the availabilities if the graph is
+     *       connected, the terminal subsets are the useful queries.
+     */
+    double evalReliability(const Graph &graph, const Terminals &terminals, const ProbabilityMap &probaMap, bool parallel = false,
+                           FrontierInfo *info = nullptr);
+
+    /**
+     * @brief Evaluate the k-terminal reliability of each terminal set.
+     * @param graph Graph in CSR layout
+     * @param terminalSets A vector of terminal sets
+     * @param probaMap Probability map containing the availability of each node
+     * @param parallel True to process the terminal sets in parallel
+     * @return Reliability of each terminal set in the order of the sets
+     * @note Throws std::invalid_argument if a terminal set is empty or the frontier of a set exceeds MAX_FRONTIER.
+     */
+    std::vector<double> evalReliabilityTopo(const Graph &graph, const std::vector<Terminals> &terminalSets,
+                                            const ProbabilityMap &probaMap, bool parallel = true);
+
+} // namespace pyrbdpp::kterminal
\ No newline at end of file
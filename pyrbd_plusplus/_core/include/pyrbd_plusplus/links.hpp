@@ -0,0 +1,47 @@
+#pragma once
+#include <pyrbd_plusplus/common.hpp>
+#include <pyrbd_plusplus/enumeration.hpp>
+#include <pyrbd_plusplus/graph.hpp>
+#include <pyrbd_plusplus/selector.hpp>
+#include <pyrbd_plusplus/stats.hpp>
+
+namespace pyrbdpp::links
+{
+    using Engine = selector::Engine;
+
+    /**
+     * @brief Evaluate the availability of a pair with node and link (edge) failures.
+     * The path sets of enumeration::linkPaths() hold the literals of the nodes and of the failing edges, so the engines
+     * evaluate them unchanged (toSDPSet() for SDP, toProbaSet() for PathSet, the minimal cut sets of the mixed path
+     * sets for MCS). Compared to subdividing every edge into an extra node, the graph keeps its size and the perfect
+     * edges add no literal and no path set.
+     * @param graph Graph in CSR layout
+     * @param src Source node ID
+     * @param dst Destination node ID
+     * @param probaMap Probability map of the nodes followed by the edge IDs, ProbabilityMap(nodes, edges)
+     * @param engine Engine evaluating the path sets
+     * @param order Maximal size of the cut sets for MCS, 0 for no limit
+     * @param pairStats Stats record filled with the instrumentation counters of the pair, nullptr to disable the stats
+     * @return Availability between source and destination in double, 0 if they are not connected
+     * @note Throws std::invalid_argument if the probability map does not cover the edge IDs.
+     */
+    double evalAvail(const Graph &graph, NodeID src, NodeID dst, const ProbabilityMap &probaMap, Engine engine = Engine::SDP,
+                     size_t order = 0, stats::PairStats *pairStats = nullptr);
+
+    /**
+     * @brief Evaluate the availability with node and link failures for each pair of source and destination nodes.
+     * @param graph Graph in CSR layout
+     * @param nodePairs A vector of pairs of source and destination node IDs
+     * @param probaMap Probability map of the nodes followed by the edge IDs, ProbabilityMap(nodes, edges)
+     * @param engine Engine evaluating the path sets
+     * @param order Maximal size of the cut sets for MCS, 0 for no limit
+     * @param parallel True to process the pairs in parallel
+     * @param statsList Filled with one stats record per node pair, nullptr to disable the stats
+     * @return List of (src, dst, availability) tuples in the order of the pairs, disconnected pairs are 0
+     * @note Throws std::invalid_argument if the probability map does not cover the edge IDs.
+     */
+    std::vector<AvailTriple> evalAvailTopo(const Graph &graph, const NodePairs &nodePairs, const ProbabilityMap &probaMap,
+                                           Engine engine = Engine::SDP, size_t order = 0, bool parallel = true,
+                                           std::vector<stats::PairStats> *statsList = nullptr);
+
+} // namespace pyrbdpp::links
\ No newline at end of file
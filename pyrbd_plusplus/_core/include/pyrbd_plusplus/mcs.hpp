@@ -1,5 +1,6 @@
 #pragma once
 #include <pyrbd_plusplus/common.hpp>
+#include <pyrbd_plusplus/stats.hpp>
 
 
 namespace pyrbdpp::mcs
@@ -63,18 +64,21 @@ namespace pyrbdpp::mcs
      * @param dst Destination node ID
      * @param probMap Probability map containing the availability probabilities for each node
      * @param minCutSets Minimal cut sets for the source and destination pair
+     * @param pairStats Stats record filled with the instrumentation counters of the pair, nullptr to disable the stats
      * @return Availability between source and destination in double
      */
-    double evalAvail(NodeID src, NodeID dst, const ProbabilityMap &probaMap, const MinCutSets &minCutSets);
+    double evalAvail(NodeID src, NodeID dst, const ProbabilityMap &probaMap, const MinCutSets &minCutSets, stats::PairStats *pairStats = nullptr);
 
     /**
      * @brief Evaluate the availability for each pair of source and destination nodes in a topology.
      * @param nodePairs A vector of pairs of source and destination node IDs
      * @param probaMap Probability map containing the availability probabilities for each node
      * @param minCutSetsList A vector of minimal cut sets for each pair of source and destination nodes
+     * @param statsList Filled with one stats record per node pair, nullptr to disable the stats
      * @return List of (src, dst, availability) tuples
      */
-    std::vector<AvailTriple> evalAvailTopo(const NodePairs &nodePairs, const ProbabilityMap &probaMap, const std::vector<MinCutSets> &minCutSetsList);
+    std::vector<AvailTriple> evalAvailTopo(const NodePairs &nodePairs, const ProbabilityMap &probaMap, const std::vector<MinCutSets> &minCutSetsList,
+                                           std::vector<stats::PairStats> *statsList = nullptr);
 
     /**
      * @brief Evaluate the availability for each pair of source and destination nodes in a topology in parallel.
@@ -83,9 +87,11 @@ namespace pyrbdpp::mcs
      * @param nodePairs A vector of pairs of source and destination node IDs
      * @param probaMap Probability map containing the availability probabilities for each node
      * @param minCutSetsList A vector of minimal cut sets for each pair of source and destination nodes
+     * @param statsList Filled with one stats record per node pair, nullptr to disable the stats
      * @return List of (src, dst, availability) tuples
      */
-    std::vector<AvailTriple> evalAvailTopoParallel(const NodePairs &nodePairs, const ProbabilityMap &probaMap, const std::vector<MinCutSets> &minCutSetsList);
+    std::vector<AvailTriple> evalAvailTopoParallel(const NodePairs &nodePairs, const ProbabilityMap &probaMap, const std::vector<MinCutSets> &minCutSetsList,
+                                                   std::vector<stats::PairStats> *statsList = nullptr);
 
 
 } // namespace pyrbdpp::mcs
\ No newline at end of file
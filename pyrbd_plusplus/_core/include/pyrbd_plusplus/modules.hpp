@@ -0,0 +1,100 @@
+#pragma once
+#include <pyrbd_plusplus/common.hpp>
+#include <pyrbd_plusplus/graph.hpp>
+#include <pyrbd_plusplus/selector.hpp>
+#include <pyrbd_plusplus/stats.hpp>
+
+namespace pyrbdpp::modules
+{
+    // Declaration of the short types for the modules module
+    using PathSets = std::vector<Set>;
+    using MinCutSets = std::vector<Set>;
+    using Engine = selector::Engine;
+
+    /**
+     * @brief Sets over synthetic literals after the module detection.
+     * The literal 1 is the source and the literal 2 the destination, the literals 3..k are the modules.
+     */
+    struct ModularSets
+    {
+        std::vector<Set> sets;              // sets over the literals
+        std::map<int, double> availability; // availability of every literal
+        std::vector<Set> members;           // original node IDs of every literal, index 0 is unused
+        double multiplier = 1.0;            // availability of the mandatory nodes factored out of the sets
+        size_t mandatory = 0;               // number of mandatory nodes
+    };
+
+    /**
+     * @brief Counters of a modular run, summed over the pairs
+     */
+    struct ModuleInfo
+    {
+        size_t nodes = 0;     // distinct nodes in the sets before the detection
+        size_t literals = 0;  // literals after the detection, the src and dst included
+        size_t mandatory = 0; // mandatory nodes factored out
+        size_t pathSets = 0;  // enumerated path sets
+    };
+
+    /**
+     * @brief Collapse the modules of the path sets of a pair into synthetic literals.
+     * Algorithm:
+     * Every node has a column bitset over the path sets, the columns are hashed and the nodes with the same column
+     * always appear together, so they form a module whose literal works if all members work, p = prod p(member).
+     * A node with a full column is on every path and is factored out as multiplier. src and dst are kept as the
+     * literals 1 and 2. Distinct path sets stay distinct, so the minimality of the sets is kept.
+     * e.g. the path sets {1, 2, 3, 5}, {1, 4, 5} of the pair (1, 5) become {1, 2, 3}, {1, 2, 4} with the module
+     * {2, 3} as literal 3 and the node 4 as literal 4.
+     * @param pathSets Path sets of the pair
+     * @param src Source node ID
+     * @param dst Destination node ID
+     * @param probaMap Probability map containing the availability of each node
+     * @return The collapsed path sets, the availability = multiplier * availability of the collapsed sets
+     */
+    ModularSets collapsePathSets(const PathSets &pathSets, NodeID src, NodeID dst, const ProbabilityMap &probaMap);
+
+    /**
+     * @brief Collapse the modules of the minimal cut sets of a pair into synthetic literals.
+     * The nodes with the same column over the cut sets always fail together in a cut, so they form a module whose
+     * literal fails only if all members fail, p = 1 - prod (1 - p(member)). A node with a singleton cut set is
+     * mandatory and is factored out as multiplier. The sets {src} and {dst} are kept as {1} and {2}.
+     * @param minCutSets Minimal cut sets of the pair in the layout of minimalcuts_optimized()
+     * @param src Source node ID
+     * @param dst Destination node ID
+     * @param probaMap Probability map containing the availability of each node
+     * @return The collapsed cut sets, the availability = multiplier * availability of the collapsed sets
+     */
+    ModularSets collapseCutSets(const MinCutSets &minCutSets, NodeID src, NodeID dst, const ProbabilityMap &probaMap);
+
+    /**
+     * @brief Evaluate the availability of a pair with the engine on the collapsed sets.
+     * @param engine Engine to use
+     * @param src Source node ID
+     * @param dst Destination node ID
+     * @param probaMap Probability map containing the availability of each node
+     * @param pathSets Path sets of the pair, used by SDP and PathSet
+     * @param minCutSets Minimal cut sets of the pair, used by MCS
+     * @param pairStats Stats record filled with the instrumentation counters of the pair, nullptr to disable the stats
+     * @param modularSets Filled with the collapsed sets, nullptr to ignore them
+     * @return The availability of the pair
+     */
+    double evalAvailWith(Engine engine, NodeID src, NodeID dst, const ProbabilityMap &probaMap,
+                         const PathSets &pathSets, const MinCutSets &minCutSets, stats::PairStats *pairStats = nullptr,
+                         ModularSets *modularSets = nullptr);
+
+    /**
+     * @brief Enumerate the sets of each pair and evaluate the availability on the collapsed sets.
+     * @param graph Graph in CSR layout
+     * @param nodePairs A vector of pairs of source and destination node IDs
+     * @param probaMap Probability map containing the availability of each node
+     * @param engine Engine used for every pair
+     * @param order Maximal size of the minimal cut sets for MCS, 0 for no limit
+     * @param parallel True to process the pairs in parallel
+     * @param statsList Filled with one stats record per node pair, nullptr to disable the stats
+     * @param info Filled with the counters of the run, nullptr to ignore them
+     * @return List of (src, dst, availability) tuples in the order of the pairs, disconnected pairs are 0
+     */
+    std::vector<AvailTriple> evalAvailTopo(const Graph &graph, const NodePairs &nodePairs, const ProbabilityMap &probaMap,
+                                           Engine engine = Engine::SDP, size_t order = 0, bool parallel = true,
+                                           std::vector<stats::PairStats> *statsList = nullptr, ModuleInfo *info = nullptr);
+
+} // namespace pyrbdpp::modules
\ No newline at end of file
@@ -0,0 +1,138 @@
+#pragma once
+#include <pyrbd_plusplus/common.hpp>
+#include <pyrbd_plusplus/graph.hpp>
+#include <cstdint>
+
+namespace pyrbdpp::montecarlo
+{
+    // One bit per sampled scenario, every batch samples LANES scenarios at once
+    using Word = uint64_t;
+    inline constexpr size_t LANES = 64;
+
+    // Number of batches sampled between two checks of the stop criterion
+    inline constexpr size_t ROUND_BATCHES = 64;
+
+    using MinCutSets = std::vector<Set>;
+
+    /**
+     * @brief Sample budget and stop criterion of the Monte Carlo estimation.
+     */
+    struct Options
+    {
+        size_t maxSamples = size_t(1) << 20; // stop after this many samples, rounded up to a multiple of LANES
+        double targetWidth = 0.0;            // stop a pair once upper - lower <= targetWidth, 0 samples maxSamples
+        double z = 1.96;                     // standard normal quantile of the confidence level, 1.96 for 95%
+        uint64_t seed = 0;                   // seed of the random streams, the same seed gives the same estimates
+        double targetRelError = 0.0;         // importance sampling: stop once half-width / unavailability <= targetRelError
+    };
+
+    /**
+     * @brief Estimated availability of a pair with its Wilson score confidence interval.
+     */
+    struct Estimate
+    {
+        NodeID src = 0;
+        NodeID dst = 0;
+        double availability = 0.0; // fraction of the samples in which src and dst are connected
+        double lower = 0.0;         // lower end of the confidence interval
+        double upper = 1.0;         // upper end of the confidence interval
+        size_t samples = 0;         // number of samples of the pair
+        bool converged = false;     // true if upper - lower <= targetWidth
+    };
+
+    /**
+     * @brief Estimated unavailability of a pair by importance sampling with its normal confidence interval.
+     */
+    struct RareEstimate
+    {
+        NodeID src = 0;
+        NodeID dst = 0;
+        double unavailability = 0.0; // weighted mean of the samples
+        double lower = 0.0;          // lower end of the confidence interval
+        double upper = 0.0;          // upper end of the confidence interval
+        double relError = 0.0;       // half-width of the interval divided by the unavailability
+        size_t samples = 0;          // number of samples of the pair
+        bool converged = false;      // true if relError <= targetRelError
+    };
+
+    /**
+     * @brief Sample the state of a node in the LANES scenarios of a batch.
+     * The random numbers are a counter-based stream: a hash of (seed, node, batch, lane), so every batch can be
+     * sampled by any thread in any order and the samples do not depend on the number of threads.
+     * @param seed Seed of the random streams
+     * @param node Node ID
+     * @param batch Index of the batch
+     * @param availability Availability of the node
+     * @return Bit i is set if the node works in scenario i of the batch
+     */
+    Word sampleWord(uint64_t seed, NodeID node, uint64_t batch, double availability);
+
+    /**
+     * @brief Estimate the availability of a pair by Monte Carlo sampling of the node states.
+     * @param graph Graph in CSR layout
+     * @param src Source node ID
+     * @param dst Destination node ID
+     * @param probaMap Probability map containing the availability of each node
+     * @param options Sample budget and stop criterion
+     * @param parallel True to sample the batches of a round in parallel
+     * @return The estimate of the pair
+     */
+    Estimate estimateAvail(const Graph &graph, NodeID src, NodeID dst, const ProbabilityMap &probaMap,
+                           const Options &options = {}, bool parallel = false);
+
+    /**
+     * @brief Estimate the availability of each pair from the same sampled node states.
+     * Algorithm:
+     * 1. A batch samples the state of every node in LANES scenarios at once, one bit per scenario.
+     * 2. For every source a bit-parallel BFS propagates the reached lanes along the edges: a node is reached in the
+     *    lanes where it works and a reached neighbor works, until no word changes. The connected lanes of a pair are
+     *    the reached word of its destination, so one BFS per source and batch counts all its pairs.
+     * 3. After every round of ROUND_BATCHES batches, the pairs whose confidence interval is narrower than the target
+     *    stop, the sources without unfinished pairs are skipped from then on.
+     * The rounds and the batches are fixed by the options, so the estimates do not depend on the number of threads.
+     * @param graph Graph in CSR layout
+     * @param nodePairs A vector of pairs of source and destination node IDs
+     * @param probaMap Probability map containing the availability of each node
+     * @param options Sample budget and stop criterion
+     * @param parallel True to sample the batches of a round in parallel
+     * @return The estimate of each pair in the order of the pairs
+     */
+    std::vector<Estimate> estimateAvailTopo(const Graph &graph, const NodePairs &nodePairs, const ProbabilityMap &probaMap,
+                                            const Options &options = {}, bool parallel = true);
+
+    /**
+     * @brief Estimate the unavailability of a pair by importance sampling on its minimal cut sets.
+     * Crude sampling almost never fails a pair of high-nines nodes, so the samples are biased toward the cut sets:
+     * 1. A cut set C is chosen with probability q(C) / S, q(C) the probability that all nodes of C fail and S the sum
+     *    over the cut sets. The nodes of C fail, the other nodes are sampled with their own availability.
+     * 2. The weight of a sample is S / N, N the number of cut sets whose nodes all failed in the sample (N >= 1).
+     * The weighted mean is unbiased for the probability that some cut set fails, and since 1 <= N <= number of cut
+     * sets the relative error is bounded however rare the failure is. The samples are drawn LANES at a time as
+     * bit words with the counter-based streams of sampleWord(), in rounds as in estimateAvailTopo().
+     * @param src Source node ID
+     * @param dst Destination node ID
+     * @param probaMap Probability map containing the availability of each node
+     * @param minCutSets Minimal cut sets for the source and destination pair, {src} and {dst} included
+     * @param options Sample budget and stop criterion, the rounds stop once the relative error reaches targetRelError
+     * @param parallel True to sample the batches of a round in parallel
+     * @return The estimate of the pair, the availability is 1 - unavailability
+     * @note Cut sets missing from minCutSets (e.g. above the order limit) are not counted, their failure is usually
+     *       far rarer than the failure of the smaller cut sets.
+     */
+    RareEstimate estimateUnavail(NodeID src, NodeID dst, const ProbabilityMap &probaMap, const MinCutSets &minCutSets,
+                                 const Options &options = {}, bool parallel = false);
+
+    /**
+     * @brief Estimate the unavailability of each pair by importance sampling on its minimal cut sets.
+     * @param nodePairs A vector of pairs of source and destination node IDs
+     * @param probaMap Probability map containing the availability of each node
+     * @param minCutSetsList A vector of minimal cut sets for each pair of source and destination nodes
+     * @param options Sample budget and stop criterion
+     * @param parallel True to process the pairs in parallel
+     * @return The estimate of each pair in the order of the pairs
+     */
+    std::vector<RareEstimate> estimateUnavailTopo(const NodePairs &nodePairs, const ProbabilityMap &probaMap,
+                                                  const std::vector<MinCutSets> &minCutSetsList, const Options &options = {},
+                                                  bool parallel = true);
+
+} // namespace pyrbdpp::montecarlo
\ No newline at end of file
@@ -1,5 +1,7 @@
 #pragma once
 #include <pyrbd_plusplus/common.hpp>
+#include <pyrbd_plusplus/stats.hpp>
+#include <pyrbd_plusplus/bounds.hpp>
 
 namespace pyrbdpp::pathset
 {
@@ -58,18 +60,21 @@ namespace pyrbdpp::pathset
      * @param dst Destination node ID
      * @param probMap Probability map containing the availability probabilities for each node
      * @param pathSets Path sets for the source and destination pair
+     * @param pairStats Stats record filled with the instrumentation counters of the pair, nullptr to disable the stats
      * @return Availability between source and destination in double
      */
-    double evalAvail(NodeID src, NodeID dst, const ProbabilityMap &probaMap, const PathSets &pathSets);
+    double evalAvail(NodeID src, NodeID dst, const ProbabilityMap &probaMap, const PathSets &pathSets, stats::PairStats *pairStats = nullptr);
 
     /**
      * @brief Evaluate the availability for each pair of source and destination nodes in a topology.
      * @param nodePairs A vector of pairs of source and destination node IDs
      * @param probaMap Probability map containing the availability probabilities for each node
      * @param pathsetsList A vector of path sets for each pair of source and destination nodes
+     * @param statsList Filled with one stats record per node pair, nullptr to disable the stats
      * @return List of (src, dst, availability) tuples
      */
-    std::vector<AvailTriple> evalAvailTopo(const NodePairs &nodePairs, const ProbabilityMap &probaMap, const std::vector<PathSets> &pathsetsList);
+    std::vector<AvailTriple> evalAvailTopo(const NodePairs &nodePairs, const ProbabilityMap &probaMap, const std::vector<PathSets> &pathsetsList,
+                                           std::vector<stats::PairStats> *statsList = nullptr);
 
     /**
      * @brief Evaluate the availability for each pair of source and destination nodes in a topology in parallel.
@@ -77,8 +82,44 @@ namespace pyrbdpp::pathset
      * @param nodePairs A vector of pairs of source and destination node IDs
      * @param probaMap Probability map containing the availability probabilities for each node
      * @param pathsetsList A vector of path sets for each pair of source and destination nodes
+     * @param statsList Filled with one stats record per node pair, nullptr to disable the stats
      * @return List of (src, dst, availability) tuples
      */
-    std::vector<AvailTriple> evalAvailTopoParallel(const NodePairs &nodePairs, const ProbabilityMap &probaMap, const std::vector<PathSets> &pathsetsList);
+    std::vector<AvailTriple> evalAvailTopoParallel(const NodePairs &nodePairs, const ProbabilityMap &probaMap, const std::vector<PathSets> &pathsetsList,
+                                                   std::vector<stats::PairStats> *statsList = nullptr);
+
+    /**
+     * @brief Anytime evaluation of the availability of a pair with PathSet algorithm.
+     * Each round selects the most probable working set, adds its probability to the lower bound and
+     * makes the other working sets disjoint to it. The upper bound adds the union bound of the working sets.
+     * The evaluation stops when upper - lower < epsilon, the deadline passes or the callback returns false.
+     * @param src Source node ID
+     * @param dst Destination node ID
+     * @param probaMap Probability map containing the availability of each node
+     * @param pathSets Path sets for the source and destination pair
+     * @param options Stop criteria and reporting options
+     * @param callback Callback for the intermediate bounds, may be empty
+     * @return Final bounds, lower == upper if the expansion finished
+     */
+    AvailBounds evalAvailBounds(NodeID src, NodeID dst, const ProbabilityMap &probaMap, const PathSets &pathSets,
+                                const BoundsOptions &options = {}, const BoundsCallback &callback = {});
+
+    /**
+     * @brief Anytime evaluation for each pair of a topology with PathSet algorithm.
+     * All pairs share the deadline of the options, the pairs not finished in time keep their intermediate bounds.
+     * @param nodePairs A vector of pairs of source and destination node IDs
+     * @param probaMap Probability map containing the availability of each node
+     * @param pathsetsList A vector of path sets for each node pair
+     * @param options Stop criteria of every pair
+     * @return A vector of bounds for each node pair
+     */
+    std::vector<AvailBounds> evalAvailBoundsTopo(const NodePairs &nodePairs, const ProbabilityMap &probaMap,
+                                                 const std::vector<PathSets> &pathsetsList, const BoundsOptions &options = {});
+
+    /**
+     * @brief Parallel version of evalAvailBoundsTopo(), the pairs are evaluated in parallel.
+     */
+    std::vector<AvailBounds> evalAvailBoundsTopoParallel(const NodePairs &nodePairs, const ProbabilityMap &probaMap,
+                                                         const std::vector<PathSets> &pathsetsList, const BoundsOptions &options = {});
 
 } // namespace pyrbdpp::pathset
\ No newline at end of file
@@ -0,0 +1,143 @@
+#pragma once
+#include <pyrbd_plusplus/common.hpp>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+namespace pyrbdpp::perf
+{
+    /**
+     * @brief The pipeline stages wrapped with hardware counters.
+     * The stages are the same as the time fields of stats::PairStats and are inclusive in the same way,
+     * e.g. the counters of Decompose contain the counters of the Eliminate and Absorb calls made during the decomposition.
+     */
+    enum class Stage
+    {
+        Sort,      // sdp::sortPathSet()
+        RC,        // RC generation of SDP, disjoint expansion (makeDisjointSet) of MCS and PathSet, BDD compilation
+        Absorb,    // sdp::absorbSDPSet()
+        Eliminate, // sdp::eliminateSDPSet()
+        Decompose, // sdp::decomposeSDPSet()
+        Eval,      // conversion of the terms to the availability
+        Count      // number of stages, not a stage
+    };
+
+    constexpr size_t NUM_STAGES = static_cast<size_t>(Stage::Count);
+
+    /**
+     * @brief Get the name of a stage
+     */
+    const char *stageName(Stage stage);
+
+    /**
+     * @brief Hardware counters of a stage.
+     * The values are scaled by time_enabled / time_running if the kernel multiplexed the counters.
+     */
+    struct Counters
+    {
+        uint64_t cycles = 0;
+        uint64_t instructions = 0;
+        uint64_t llcMisses = 0;    // last level cache misses (PERF_COUNT_HW_CACHE_MISSES)
+        uint64_t branchMisses = 0;
+        uint64_t calls = 0;        // number of measured scopes
+
+        Counters &operator+=(const Counters &other);
+    };
+
+    /**
+     * @brief Counters of all stages measured on a single thread.
+     */
+    struct ThreadReport
+    {
+        size_t threadIndex = 0; // index of the thread in order of its first measurement
+        long tid = 0;           // kernel thread ID
+        std::array<Counters, NUM_STAGES> stages;
+    };
+
+    // Whether the counters are collected, checked by every ScopedCounters
+    extern std::atomic<bool> enabled;
+
+    /**
+     * @brief Check if the hardware counters can be opened on the current thread
+     * @return True if perf_event_open succeeded, false otherwise, see unavailableReason()
+     */
+    bool isAvailable();
+
+    /**
+     * @brief Get the reason why the hardware counters are not available
+     * @return Empty string if the counters are available
+     */
+    std::string unavailableReason();
+
+    /**
+     * @brief Enable the collection of the hardware counters.
+     * @return True if the counters are available and enabled, false otherwise (the mode stays off)
+     */
+    bool enable();
+
+    /**
+     * @brief Disable the collection of the hardware counters, the collected values are kept
+     */
+    void disable();
+
+    /**
+     * @brief Check if the collection of the hardware counters is enabled
+     */
+    inline bool isEnabled() { return enabled.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief Reset the collected counters of all threads
+     */
+    void reset();
+
+    /**
+     * @brief Get the collected counters per thread
+     * @return One report per thread that measured at least one stage
+     * @note Call it after the evaluation, the values of running stages are not included.
+     */
+    std::vector<ThreadReport> report();
+
+    /**
+     * @brief Get the collected counters per stage summed over all threads
+     */
+    std::array<Counters, NUM_STAGES> summary();
+
+    /**
+     * @brief RAII guard adding the hardware counters of its scope to a stage of the current thread.
+     * The guard only reads the counters if the mode is enabled, otherwise it costs one relaxed atomic load.
+     * The counters of a thread are opened on its first measurement and kept open for the lifetime of the thread.
+     */
+    class ScopedCounters
+    {
+    private:
+        Stage stage;
+        bool active = false;
+        std::array<uint64_t, 4> start{};
+
+    public:
+        explicit ScopedCounters(Stage stage) : stage(stage)
+        {
+            if (isEnabled())
+            {
+                begin();
+            }
+        }
+
+        ~ScopedCounters()
+        {
+            if (active)
+            {
+                end();
+            }
+        }
+
+        ScopedCounters(const ScopedCounters &) = delete;
+        ScopedCounters &operator=(const ScopedCounters &) = delete;
+
+    private:
+        void begin();
+        void end();
+    };
+
+} // namespace pyrbdpp::perf
\ No newline at end of file
@@ -0,0 +1,153 @@
+#pragma once
+#include <pyrbd_plusplus/common.hpp>
+#include <pyrbd_plusplus/graph.hpp>
+#include <pyrbd_plusplus/selector.hpp>
+#include <pyrbd_plusplus/stats.hpp>
+#include <atomic>
+#include <memory>
+
+namespace pyrbdpp::pipeline
+{
+    using Engine = selector::Engine;
+
+    /**
+     * @brief Bounded lock-free multi-producer multi-consumer queue (Dmitry Vyukov's ring buffer).
+     * Every cell has a sequence number telling whether it is free for the producer of a round or filled for the consumer,
+     * so producers and consumers only contend on their own position counter.
+     * @note The capacity is rounded up to a power of two.
+     */
+    template <typename T>
+    class BoundedQueue
+    {
+    private:
+        struct Cell
+        {
+            std::atomic<size_t> sequence;
+            T data;
+        };
+
+        std::unique_ptr<Cell[]> cells;
+        size_t mask;
+        alignas(64) std::atomic<size_t> enqueuePos{0};
+        alignas(64) std::atomic<size_t> dequeuePos{0};
+
+    public:
+        explicit BoundedQueue(size_t capacity)
+        {
+            size_t size = 2;
+            while (size < capacity)
+            {
+                size <<= 1;
+            }
+            cells.reset(new Cell[size]);
+            mask = size - 1;
+            for (size_t i = 0; i < size; ++i)
+            {
+                cells[i].sequence.store(i, std::memory_order_relaxed);
+            }
+        }
+
+        size_t capacity() const { return mask + 1; }
+
+        /**
+         * @brief Move the item into the queue
+         * @return False if the queue is full, the item is not moved then
+         */
+        bool tryPush(T &item)
+        {
+            size_t pos = enqueuePos.load(std::memory_order_relaxed);
+            for (;;)
+            {
+                Cell &cell = cells[pos & mask];
+                size_t sequence = cell.sequence.load(std::memory_order_acquire);
+                intptr_t diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos);
+                if (diff == 0)
+                {
+                    // The cell is free in this round, claim it
+                    if (enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                    {
+                        cell.data = std::move(item);
+                        cell.sequence.store(pos + 1, std::memory_order_release);
+                        return true;
+                    }
+                }
+                else if (diff < 0)
+                {
+                    return false;
+                }
+                else
+                {
+                    pos = enqueuePos.load(std::memory_order_relaxed);
+                }
+            }
+        }
+
+        /**
+         * @brief Move the oldest item out of the queue
+         * @return False if the queue is empty
+         */
+        bool tryPop(T &item)
+        {
+            size_t pos = dequeuePos.load(std::memory_order_relaxed);
+            for (;;)
+            {
+                Cell &cell = cells[pos & mask];
+                size_t sequence = cell.sequence.load(std::memory_order_acquire);
+                intptr_t diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos + 1);
+                if (diff == 0)
+                {
+                    // The cell is filled in this round, claim it
+                    if (dequeuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                    {
+                        item = std::move(cell.data);
+                        cell.data = T{};
+                        cell.sequence.store(pos + mask + 1, std::memory_order_release);
+                        return true;
+                    }
+                }
+                else if (diff < 0)
+                {
+                    return false;
+                }
+                else
+                {
+                    pos = dequeuePos.load(std::memory_order_relaxed);
+                }
+            }
+        }
+    };
+
+    /**
+     * @brief Counters of a pipeline run
+     */
+    struct PipelineInfo
+    {
+        size_t capacity = 0;    // capacity of the queue after rounding
+        size_t peakPending = 0; // maximal number of enumerated pairs not evaluated yet, at most capacity + threads
+        size_t fullWaits = 0;   // number of times a producer found the queue full and evaluated a pair instead
+    };
+
+    /**
+     * @brief Evaluate the availability of each pair with enumeration and evaluation overlapped.
+     * Algorithm:
+     * Every thread produces and consumes. A producer claims the next pair, enumerates its path sets
+     * (and minimal cut sets for MCS) and pushes them into the bounded queue. A consumer pops a pair, evaluates it
+     * and frees its sets. A thread pops before it produces, and a producer facing a full queue evaluates queued pairs
+     * until it can push, so the pipeline never blocks and works with any number of threads.
+     * The sets held at the same time are bounded by the queue capacity plus one pair per thread.
+     * @param graph Graph in CSR layout
+     * @param nodePairs A vector of pairs of source and destination node IDs
+     * @param probaMap Probability map containing the availability of each node
+     * @param engine Engine used for every pair
+     * @param capacity Capacity of the queue in pairs
+     * @param order Maximal size of the minimal cut sets for MCS, 0 for no limit
+     * @param parallel True to run the pipeline on all threads
+     * @param statsList Filled with one stats record per node pair, nullptr to disable the stats
+     * @param info Filled with the counters of the run, nullptr to ignore them
+     * @return List of (src, dst, availability) tuples in the order of the pairs, disconnected pairs are 0
+     */
+    std::vector<AvailTriple> evalAvailTopo(const Graph &graph, const NodePairs &nodePairs, const ProbabilityMap &probaMap,
+                                           Engine engine, size_t capacity = 64, size_t order = 0, bool parallel = true,
+                                           std::vector<stats::PairStats> *statsList = nullptr, PipelineInfo *info = nullptr);
+
+} // namespace pyrbdpp::pipeline
\ No newline at end of file
@@ -0,0 +1,70 @@
+#pragma once
+#include <pyrbd_plusplus/common.hpp>
+#include <pyrbd_plusplus/graph.hpp>
+#include <pyrbd_plusplus/selector.hpp>
+
+namespace pyrbdpp::reduction
+{
+    using Engine = selector::Engine;
+
+    /**
+     * @brief Graph of a pair after the reduction, the reduced nodes are super-components of the original nodes.
+     */
+    struct ReducedPair
+    {
+        Graph graph;                        // reduced graph with the node IDs 1..k
+        std::map<int, double> availability; // availability of every reduced node
+        std::vector<Set> members;           // original node IDs folded into every reduced node, index 0 is unused
+        NodeID src = 0;                     // reduced node ID of the source
+        NodeID dst = 0;                     // reduced node ID of the destination, 0 if it is not reachable
+    };
+
+    /**
+     * @brief Counters of a reduced run, summed over the pairs
+     */
+    struct ReductionInfo
+    {
+        size_t originalNodes = 0; // nodes of the graph, once per pair
+        size_t reducedNodes = 0;  // nodes of the reduced graphs
+        size_t pathSets = 0;      // path sets enumerated on the reduced graphs
+
+        double ratio() const { return originalNodes ? static_cast<double>(reducedNodes) / originalNodes : 1.0; }
+    };
+
+    /**
+     * @brief Reduce the graph of a pair with exact series-parallel rules, src and dst are never folded.
+     * The nodes fail and the edges are perfect, the rules are applied until none matches:
+     * 1. Unreachable: the nodes outside the component of src are removed.
+     * 2. Dangling: a node with at most one neighbor is on no minimal path and is removed.
+     * 3. Shortcut: a node with the two neighbors a and b is removed if a and b are neighbors,
+     *    every path through it has the shortcut (a, b).
+     * 4. Series: two neighboring nodes of degree 2 are one chain, they are folded into one node with p = p1 * p2.
+     * 5. Parallel: two nodes with the same neighbors are never on the same minimal path and the graph only depends
+     *    on whether one of them works, they are folded into one node with p = 1 - (1 - p1) * (1 - p2).
+     * e.g. for the ring 1-2-3-4-5-6-1 and the pair (1, 4) the chains {2, 3} and {5, 6} become two nodes in parallel,
+     * then one node with p = 1 - (1 - p2 p3)(1 - p5 p6), and the reduced graph is the path 1-x-4.
+     * @param graph Graph in CSR layout
+     * @param src Source node ID
+     * @param dst Destination node ID
+     * @param probaMap Probability map containing the availability of each node
+     * @return The reduced graph, its availabilities and the folded members of every reduced node
+     */
+    ReducedPair reducePair(const Graph &graph, NodeID src, NodeID dst, const ProbabilityMap &probaMap);
+
+    /**
+     * @brief Evaluate the availability of each pair on its reduced graph.
+     * Every pair is reduced with reducePair(), then the path sets of the reduced graph are enumerated and evaluated
+     * with the engine. MCS limits the cut sets to the order ceil(k / 2) for a reduced graph of k nodes,
+     * like minimalcuts_optimized().
+     * @param graph Graph in CSR layout
+     * @param nodePairs A vector of pairs of source and destination node IDs
+     * @param probaMap Probability map containing the availability of each node
+     * @param engine Engine used for the reduced graphs
+     * @param parallel True to process the pairs in parallel
+     * @param info Filled with the counters of the run, nullptr to ignore them
+     * @return List of (src, dst, availability) tuples in the order of the pairs, disconnected pairs are 0
+     */
+    std::vector<AvailTriple> evalAvailTopo(const Graph &graph, const NodePairs &nodePairs, const ProbabilityMap &probaMap,
+                                           Engine engine = Engine::SDP, bool parallel = true, ReductionInfo *info = nullptr);
+
+} // namespace pyrbdpp::reduction
\ No newline at end of file
@@ -1,5 +1,7 @@
 #pragma once
 #include <pyrbd_plusplus/common.hpp>
+#include <pyrbd_plusplus/stats.hpp>
+#include <pyrbd_plusplus/bounds.hpp>
 
 namespace pyrbdpp::sdp
 {
@@ -117,6 +119,15 @@ namespace pyrbdpp::sdp
      */
     std::vector<SDPSets> toSDPSet(NodeID src, NodeID dst, PathSets pathSets);
 
+    /**
+     * @brief Convert the i-th path set of sorted path sets to its disjoint SDP terms
+     * The terms are the i-th path set combined with the RC sets of all preceding path sets, decomposed if needed.
+     * @param sortedPathSet Path sets sorted by sortPathSet()
+     * @param i Index of the path set to convert
+     * @return SDP sets of the i-th path set, the sum of their availability is the mass contributed by the path set
+     */
+    std::vector<SDPSets> pathSetToSDPSet(const PathSets &sortedPathSet, size_t i);
+
     /**
      * @brief The parallel version of the toSDPSet() function for large path sets.
      * The thread are used to parallelize the part2 of the SDP algorithm.
@@ -154,9 +165,10 @@ namespace pyrbdpp::sdp
      * @param dst Destination node ID
      * @param probaMap ProbabilityMap containing the availability of each node
      * @param pathSets Path sets for the source and destination pair
+     * @param pairStats Stats record filled with the instrumentation counters of the pair, nullptr to disable the stats
      * @return Availability between source and destination in double
      */
-    double evalAvail(NodeID src, NodeID dst, const ProbabilityMap &probaMap, PathSets &pathSets);
+    double evalAvail(NodeID src, NodeID dst, const ProbabilityMap &probaMap, PathSets &pathSets, stats::PairStats *pairStats = nullptr);
 
     /**
      * @brief Evaluate the availability for a specific source and destination from a topology with SDP algorithm.
@@ -165,21 +177,24 @@ namespace pyrbdpp::sdp
      * @param dst Destination node ID
      * @param probaMap ProbabilityMap containing the availability of each node
      * @param pathSets Path sets for the source and destination pair
+     * @param pairStats Stats record filled with the instrumentation counters of the pair, nullptr to disable the stats
      * @return Availability between source and destination in double
      * @note This function is only used for the pathSets size larger equal than 1000.
      * The function will not be used together with the evalAvailTopoParallel() function to avoid exceeding the number of available cores.
      * This function will call the toSDPSetParallel() function to convert the path sets to SDP sets.
      */
-    double evalAvailParallel(NodeID src, NodeID dst, const ProbabilityMap &probaMap, PathSets &pathSets);
+    double evalAvailParallel(NodeID src, NodeID dst, const ProbabilityMap &probaMap, PathSets &pathSets, stats::PairStats *pairStats = nullptr);
 
     /**
      * @brief Evaluate the availability for each pair of source and destination nodes in a topology with SDP algorithm.
      * @param nodePairs A vector of pairs of source and destination node IDs
      * @param probaMap Probability map containing the availability of each node
      * @param pathsetsList A vector of path sets for each node pair
+     * @param statsList Filled with one stats record per node pair, nullptr to disable the stats
      * @return List of (src, dst, availability) triples
      */
-    std::vector<AvailTriple> evalAvailTopo(const NodePairs &nodePairs, const ProbabilityMap &probaMap, std::vector<PathSets> &pathsetsList);
+    std::vector<AvailTriple> evalAvailTopo(const NodePairs &nodePairs, const ProbabilityMap &probaMap, std::vector<PathSets> &pathsetsList,
+                                           std::vector<stats::PairStats> *statsList = nullptr);
 
     /**
      * @brief Evaluate the availability for each node pair in the nodePairs and topology file with SDP algorithm
@@ -187,11 +202,53 @@ namespace pyrbdpp::sdp
      * @param nodePairs A vector of pairs of source and destination node IDs
      * @param probaMap Probability map containing the availability of each node
      * @param pathsetsList A vector of path sets for each node pair
+     * @param statsList Filled with one stats record per node pair, nullptr to disable the stats
      * @return List of (src, dst, availability) triples
      * @note This function can be used for every path sets size.
      * Do not use this function to call evalAvailParallel() function to keep the number of available cores not exceeded.
      */
-    std::vector<AvailTriple> evalAvailTopoParallel(const NodePairs &nodePairs, const ProbabilityMap &probaMap, std::vector<PathSets> &pathsetsList);
+    std::vector<AvailTriple> evalAvailTopoParallel(const NodePairs &nodePairs, const ProbabilityMap &probaMap, std::vector<PathSets> &pathsetsList,
+                                                   std::vector<stats::PairStats> *statsList = nullptr);
 
+    /**
+     * @brief Anytime evaluation of the availability of a pair with SDP algorithm.
+     * The path sets are evaluated in the order of their estimated probability mass, the largest first.
+     * After each path set the lower bound is the sum of the evaluated disjoint terms,
+     * the upper bound adds the estimated mass of the remaining path sets.
+     * The evaluation stops when upper - lower < epsilon, the deadline passes or the callback returns false.
+     * @param src Source node ID
+     * @param dst Destination node ID
+     * @param probaMap Probability map containing the availability of each node
+     * @param pathSets Path sets for the source and destination pair
+     * @param options Stop criteria and reporting options
+     * @param callback Callback for the intermediate bounds, may be empty
+     * @return Final bounds, lower == upper if all path sets were evaluated
+     */
+    AvailBounds evalAvailBounds(NodeID src, NodeID dst, const ProbabilityMap &probaMap, const PathSets &pathSets,
+                                const BoundsOptions &options = {}, const BoundsCallback &callback = {});
+
+    /**
+     * @brief Parallel version of evalAvailBounds(), evaluates batches of path sets in parallel between the checks of the stop criteria.
+     */
+    AvailBounds evalAvailBoundsParallel(NodeID src, NodeID dst, const ProbabilityMap &probaMap, const PathSets &pathSets,
+                                        const BoundsOptions &options = {}, const BoundsCallback &callback = {});
+
+    /**
+     * @brief Anytime evaluation for each pair of a topology with SDP algorithm.
+     * All pairs share the deadline of the options, the pairs not finished in time keep their intermediate bounds.
+     * @param nodePairs A vector of pairs of source and destination node IDs
+     * @param probaMap Probability map containing the availability of each node
+     * @param pathsetsList A vector of path sets for each node pair
+     * @param options Stop criteria of every pair
+     * @return A vector of bounds for each node pair
+     */
+    std::vector<AvailBounds> evalAvailBoundsTopo(const NodePairs &nodePairs, const ProbabilityMap &probaMap,
+                                                 const std::vector<PathSets> &pathsetsList, const BoundsOptions &options = {});
+
+    /**
+     * @brief Parallel version of evalAvailBoundsTopo(), the pairs are evaluated in parallel.
+     */
+    std::vector<AvailBounds> evalAvailBoundsTopoParallel(const NodePairs &nodePairs, const ProbabilityMap &probaMap,
+                                                         const std::vector<PathSets> &pathsetsList, const BoundsOptions &options = {});
 
 } // namespace pyrbdpp::sdp
\ No newline at end of file
@@ -0,0 +1,212 @@
+#pragma once
+#include <pyrbd_plusplus/common.hpp>
+#include <pyrbd_plusplus/mcs.hpp>
+#include <pyrbd_plusplus/pathset.hpp>
+#include <pyrbd_plusplus/sdp.hpp>
+
+namespace pyrbdpp::selector
+{
+    // Declaration of the short types for the selector module
+    using PathSets   = std::vector<Set>;
+    using MinCutSets = std::vector<Set>;
+
+    /**
+     * @brief The evaluation engines the selector can dispatch a pair to.
+     */
+    enum class Engine
+    {
+        MCS,
+        PathSet,
+        SDP
+    };
+
+    // (src, dst, availability, engine used for the pair)
+    using AutoTriple = std::tuple<NodeID, NodeID, double, Engine>;
+
+    /**
+     * @brief Cheap statistics of a list of sets (path sets or minimal cut sets).
+     */
+    struct SetStats
+    {
+        size_t count = 0;    // number of sets
+        size_t maxWidth = 0; // size of the largest set
+        double avgWidth = 0; // average size of the sets
+    };
+
+    /**
+     * @brief Linear coefficients of the cost model, one per engine.
+     * The predicted cost of an engine is coefficient * shape(stats), where the shapes are
+     *  SDP:     P^2 * w       (sortPathSet and the RC generation are quadratic in the number of paths P)
+     *  PathSet: P^2 * w^2     (the disjoint expansion grows with the width w of the path sets)
+     *  MCS:     C^3 * w       (the disjoint expansion of the C cut sets grows roughly cubic)
+     * plus a constant overhead per call. The default coefficients are seconds measured on a desktop machine,
+     * calibrate() replaces them with values measured on the current machine and input.
+     */
+    struct CostModel
+    {
+        double sdpCoeff = 6.5e-8;
+        double pathsetCoeff = 2.5e-8;
+        double mcsCoeff = 1.0e-8;
+        double sdpOverhead = 1.0e-6;
+        double pathsetOverhead = 2.0e-7;
+        double mcsOverhead = 4.0e-7;
+    };
+
+    /**
+     * @brief Predicted cost of each engine for a single pair in seconds.
+     * @note The cost of MCS is infinity if no cut sets are given for the pair.
+     */
+    struct CostEstimate
+    {
+        double mcs = 0.0;
+        double pathset = 0.0;
+        double sdp = 0.0;
+    };
+
+    /**
+     * @brief Compute the statistics of a list of sets
+     * @param sets Path sets or minimal cut sets
+     * @return Statistics of the sets
+     */
+    SetStats computeSetStats(const std::vector<Set> &sets);
+
+    /**
+     * @brief Estimate the cost of each engine for a pair from the statistics of its input sets
+     * @param model Cost model
+     * @param pathSets Path sets for the source and destination pair
+     * @param minCutSets Minimal cut sets for the source and destination pair, may be empty if not available
+     * @return Predicted cost of each engine
+     * @note The sets {src} and {dst} in the minimal cut sets are not counted, they are removed by mcs::toProbaSet().
+     */
+    CostEstimate estimateCost(const CostModel &model, const PathSets &pathSets, const MinCutSets &minCutSets);
+
+    /**
+     * @brief Estimate the statistics of the minimal cut sets of a pair from its path sets, without enumerating them.
+     * The shortest path sets with disjoint inner nodes are picked greedily, every cut set hits the k picked paths, so
+     * it is at least k wide. Every inner node of a path is in some cut set, the count is estimated by the inner length
+     * of the longest picked path. The count is usually low, parallel chains and cross links add cut sets, so a pair
+     * where MCS is the fastest engine is rarely skipped.
+     * @param src Source node ID
+     * @param dst Destination node ID
+     * @param pathSets Path sets for the source and destination pair
+     * @return Estimated statistics of the minimal cut sets, {src} and {dst} included like computeSetStats()
+     */
+    SetStats estimateCutStats(NodeID src, NodeID dst, const PathSets &pathSets);
+
+    /**
+     * @brief Check whether MCS can be the fastest engine of a pair before its cut sets are enumerated.
+     * The cost of MCS is predicted from estimateCutStats(), the cut sets are only worth enumerating for the selection
+     * if it is at most the predicted cost of SDP and PathSet.
+     * @param model Cost model
+     * @param src Source node ID
+     * @param dst Destination node ID
+     * @param pathSets Path sets for the source and destination pair
+     * @return True if the minimal cut sets of the pair should be enumerated
+     */
+    bool mcsCandidate(const CostModel &model, NodeID src, NodeID dst, const PathSets &pathSets);
+
+    /**
+     * @brief Select the engine with the lowest predicted cost for a pair
+     * @param model Cost model
+     * @param pathSets Path sets for the source and destination pair
+     * @param minCutSets Minimal cut sets for the source and destination pair, may be empty if not available
+     * @return The predicted fastest engine
+     */
+    Engine selectEngine(const CostModel &model, const PathSets &pathSets, const MinCutSets &minCutSets);
+
+    /**
+     * @brief Calibrate the cost model with a small run on the given input
+     * Algorithm:
+     * 1. Estimate the cost of every pair with the default model and keep the pairs where every engine is predicted
+     *    to finish within the time budget, so a bad sample can not stall the calibration.
+     * 2. Pick up to samples pairs evenly spread over the predicted cost.
+     * 3. Run every engine on the picked pairs and fit each coefficient as the median of measured / predicted time.
+     * @param nodePairs A vector of pairs of source and destination node IDs
+     * @param probaMap Probability map containing the availability of each node
+     * @param pathsetsList A vector of path sets for each node pair
+     * @param minCutSetsList A vector of minimal cut sets for each node pair, may be empty, MCS is skipped for a pair without cut sets
+     * @param samples Maximal number of pairs used for the calibration
+     * @param budget Maximal predicted time in seconds of a single engine run used for the calibration
+     * @return Calibrated cost model
+     */
+    CostModel calibrate(const NodePairs &nodePairs, const ProbabilityMap &probaMap,
+                        const std::vector<PathSets> &pathsetsList, const std::vector<MinCutSets> &minCutSetsList,
+                        size_t samples = 8, double budget = 0.05);
+
+    /**
+     * @brief Calibrate the cost model before the minimal cut sets of the pairs are enumerated.
+     * Same as calibrate(), except that the cost of MCS is predicted from estimateCutStats() when the samples are picked
+     * and only the cut sets of the picked pairs are enumerated, so the calibrated model can decide which pairs need
+     * their cut sets with mcsCandidate().
+     * @param nodePairs A vector of pairs of source and destination node IDs
+     * @param probaMap Probability map containing the availability of each node
+     * @param pathsetsList A vector of path sets for each node pair
+     * @param order Maximal size of the cut sets of the picked pairs, 0 for no limit
+     * @param samples Maximal number of pairs used for the calibration
+     * @param budget Maximal predicted time in seconds of a single engine run used for the calibration
+     * @return Calibrated cost model
+     */
+    CostModel calibrateFromPaths(const NodePairs &nodePairs, const ProbabilityMap &probaMap,
+                                 const std::vector<PathSets> &pathsetsList, size_t order = 0,
+                                 size_t samples = 8, double budget = 0.05);
+
+    /**
+     * @brief Evaluate the availability of a pair with the given engine
+     * @param engine Engine to use
+     * @param src Source node ID
+     * @param dst Destination node ID
+     * @param probaMap Probability map containing the availability of each node
+     * @param pathSets Path sets for the source and destination pair
+     * @param minCutSets Minimal cut sets for the source and destination pair
+     * @param pairStats Stats record filled with the instrumentation counters of the pair, nullptr to disable the stats
+     * @return Availability between source and destination in double
+     */
+    double evalAvailWith(Engine engine, NodeID src, NodeID dst, const ProbabilityMap &probaMap,
+                         const PathSets &pathSets, const MinCutSets &minCutSets, stats::PairStats *pairStats = nullptr);
+
+    /**
+     * @brief Evaluate the availability for a specific source and destination with the predicted fastest engine.
+     * @param src Source node ID
+     * @param dst Destination node ID
+     * @param probaMap Probability map containing the availability of each node
+     * @param pathSets Path sets for the source and destination pair
+     * @param minCutSets Minimal cut sets for the source and destination pair, may be empty
+     * @param model Cost model
+     * @param pairStats Stats record filled with the instrumentation counters of the pair, nullptr to disable the stats
+     * @return (src, dst, availability, engine)
+     */
+    AutoTriple evalAvail(NodeID src, NodeID dst, const ProbabilityMap &probaMap,
+                         const PathSets &pathSets, const MinCutSets &minCutSets, const CostModel &model = {},
+                         stats::PairStats *pairStats = nullptr);
+
+    /**
+     * @brief Evaluate the availability for each pair of source and destination nodes, every pair with its predicted fastest engine.
+     * @param nodePairs A vector of pairs of source and destination node IDs
+     * @param probaMap Probability map containing the availability of each node
+     * @param pathsetsList A vector of path sets for each node pair
+     * @param minCutSetsList A vector of minimal cut sets for each node pair, may be empty, MCS is skipped for a pair without cut sets
+     * @param model Cost model
+     * @param statsList Filled with one stats record per node pair, nullptr to disable the stats
+     * @return List of (src, dst, availability, engine) tuples
+     */
+    std::vector<AutoTriple> evalAvailTopo(const NodePairs &nodePairs, const ProbabilityMap &probaMap,
+                                          const std::vector<PathSets> &pathsetsList, const std::vector<MinCutSets> &minCutSetsList,
+                                          const CostModel &model = {}, std::vector<stats::PairStats> *statsList = nullptr);
+
+    /**
+     * @brief Parallel version of evalAvailTopo().
+     * This function uses OpenMP to parallelize the evaluation over the pairs. The pairs are scheduled
+     * in descending order of their predicted cost, so the expensive pairs do not end up at the tail of the loop.
+     * @param nodePairs A vector of pairs of source and destination node IDs
+     * @param probaMap Probability map containing the availability of each node
+     * @param pathsetsList A vector of path sets for each node pair
+     * @param minCutSetsList A vector of minimal cut sets for each node pair, may be empty, MCS is skipped for a pair without cut sets
+     * @param model Cost model
+     * @param statsList Filled with one stats record per node pair, nullptr to disable the stats
+     * @return List of (src, dst, availability, engine) tuples in the order of nodePairs
+     */
+    std::vector<AutoTriple> evalAvailTopoParallel(const NodePairs &nodePairs, const ProbabilityMap &probaMap,
+                                                  const std::vector<PathSets> &pathsetsList, const std::vector<MinCutSets> &minCutSetsList,
+                                                  const CostModel &model = {}, std::vector<stats::PairStats> *statsList = nullptr);
+
+} // namespace pyrbdpp::selector
\ No newline at end of file
@@ -0,0 +1,138 @@
+#pragma once
+#include <pyrbd_plusplus/common.hpp>
+#include <chrono>
+
+namespace pyrbdpp::stats
+{
+    /**
+     * @brief Instrumentation counters of a single source and destination pair.
+     * The times are in seconds. The stage times are inclusive, e.g. decomposeTime contains the time of
+     * the eliminate and absorb steps called during the decomposition, which are also counted in eliminateTime and absorbTime.
+     * When a stage runs on several threads (e.g. sdp::toSDPSetParallel()) the times of all threads are summed up.
+     */
+    struct PairStats
+    {
+        NodeID src = 0;
+        NodeID dst = 0;
+
+        double totalTime = 0.0;     // time of the whole evaluation of the pair
+        double sortTime = 0.0;      // sdp::sortPathSet()
+        double rcTime = 0.0;        // RC generation of SDP, disjoint expansion (makeDisjointSet) of MCS and PathSet, BDD compilation
+        double absorbTime = 0.0;    // sdp::absorbSDPSet()
+        double eliminateTime = 0.0; // sdp::eliminateSDPSet()
+        double decomposeTime = 0.0; // sdp::decomposeSDPSet()
+        double evalTime = 0.0;      // conversion of the terms to the availability
+
+        size_t queueHighWater = 0;  // maximal size of the decomposition queue or of the MCS / PathSet working list, widest BDD level
+        size_t decompositions = 0;  // number of SDP decompositions or MCS / PathSet expansion rounds
+        size_t terms = 0;           // number of disjoint terms of the final expression, nodes of the BDD
+        size_t bytesAllocated = 0;  // approximate payload bytes of the sets and terms created during the evaluation
+    };
+
+    // The stats record of the pair evaluated by the current thread, nullptr if the stats are disabled
+    extern thread_local PairStats *activeStats;
+
+    /**
+     * @brief Get the stats record of the current thread
+     * @return The active stats record, nullptr if no stats are collected
+     */
+    inline PairStats *current() { return activeStats; }
+
+    /**
+     * @brief Add a value to a counter of the active stats record, no-op if the stats are disabled
+     */
+    inline void add(size_t PairStats::*counter, size_t value)
+    {
+        if (activeStats)
+        {
+            activeStats->*counter += value;
+        }
+    }
+
+    /**
+     * @brief Raise a high-water mark of the active stats record, no-op if the stats are disabled
+     */
+    inline void raise(size_t PairStats::*counter, size_t value)
+    {
+        if (activeStats && activeStats->*counter < value)
+        {
+            activeStats->*counter = value;
+        }
+    }
+
+    /**
+     * @brief Approximate payload bytes of a list of sets
+     */
+    template <typename Sets>
+    size_t bytesOf(const Sets &sets)
+    {
+        size_t bytes = sets.size() * sizeof(typename Sets::value_type);
+        for (const auto &set : sets)
+        {
+            bytes += set.size() * sizeof(NodeID);
+        }
+        return bytes;
+    }
+
+    /**
+     * @brief Merge the counters of another stats record into a stats record
+     * The times and counts are added, the high-water marks take the maximum.
+     * @param into The stats record to merge into
+     * @param other The stats record to merge
+     */
+    void merge(PairStats &into, const PairStats &other);
+
+    /**
+     * @brief RAII guard activating a stats record for the current thread.
+     * The guard restores the previously active record on destruction and measures the total time of the scope.
+     * Passing nullptr is a no-op, so nested evaluations keep recording into the record of the caller.
+     */
+    class Scope
+    {
+    private:
+        PairStats *previous;
+        PairStats *record;
+        std::chrono::steady_clock::time_point start;
+
+    public:
+        explicit Scope(PairStats *record);
+        ~Scope();
+
+        Scope(const Scope &) = delete;
+        Scope &operator=(const Scope &) = delete;
+    };
+
+    /**
+     * @brief RAII timer adding the elapsed time of its scope to a time field of the active stats record.
+     * The timer does not read the clock if the stats are disabled.
+     */
+    class ScopedTimer
+    {
+    private:
+        PairStats *record;
+        double PairStats::*field;
+        std::chrono::steady_clock::time_point start;
+
+    public:
+        explicit ScopedTimer(double PairStats::*field) : record(activeStats), field(field)
+        {
+            if (record)
+            {
+                start = std::chrono::steady_clock::now();
+            }
+        }
+
+        ~ScopedTimer()
+        {
+            if (record)
+            {
+                std::chrono::duration<double> duration = std::chrono::steady_clock::now() - start;
+                record->*field += duration.count();
+            }
+        }
+
+        ScopedTimer(const ScopedTimer &) = delete;
+        ScopedTimer &operator=(const ScopedTimer &) = delete;
+    };
+
+} // namespace pyrbdpp::stats
\ No newline at end of file
@@ -0,0 +1,78 @@
+#pragma once
+#include <pyrbd_plusplus/common.hpp>
+#include <pyrbd_plusplus/graph.hpp>
+#include <pyrbd_plusplus/selector.hpp>
+#include <pyrbd_plusplus/stats.hpp>
+
+namespace pyrbdpp::symmetry
+{
+    using Engine = selector::Engine;
+
+    // Default maximal number of search tree nodes of the automorphism search
+    inline constexpr size_t DEFAULT_SEARCH_BUDGET = 20000;
+
+    /**
+     * @brief Automorphisms of a graph with the node availabilities as colors.
+     */
+    struct Automorphisms
+    {
+        std::vector<std::vector<NodeID>> generators; // permutations of the node IDs, index 0 is unused
+        std::vector<NodeID> orbitOf;                 // smallest node of the orbit of every node, index 0 is unused
+        bool complete = true;                        // false if the search budget ran out, the generators are then a subgroup
+    };
+
+    /**
+     * @brief Counters of a symmetric run
+     */
+    struct SymmetryInfo
+    {
+        size_t generators = 0; // number of automorphism generators found
+        size_t orbits = 0;     // number of pair orbits, i.e. evaluated pairs
+        bool complete = true;  // false if the search budget ran out
+    };
+
+    /**
+     * @brief Compute generators of the automorphism group that preserve the node availabilities.
+     * Algorithm (individualization-refinement, as nauty and bliss):
+     * 1. The colors start from the availabilities and are refined to the coarsest equitable partition: a node's new
+     *    color is its old color with the sorted colors of its neighbors, renumbered in sorted order, so the refinement
+     *    commutes with every automorphism.
+     * 2. The first path of the search tree individualizes the first node of the first non-singleton cell and
+     *    refines, until the partition is discrete. Its leaf is the reference labeling.
+     * 3. Bottom-up, for every level and every node of the target cell not yet in the orbit of the first node under the
+     *    generators found so far, the subtree of that node is searched for a leaf whose mapping to the reference leaf
+     *    is an automorphism. Partitions whose cell sizes differ from the first path at the same depth are pruned.
+     * Every generator is verified on all edges, so a search stopped by the budget still returns valid automorphisms.
+     * @param graph Graph in CSR layout
+     * @param probaMap Probability map containing the availability of each node, used as node colors
+     * @param budget Maximal number of search tree nodes
+     * @return The generators and the node orbits
+     */
+    Automorphisms automorphisms(const Graph &graph, const ProbabilityMap &probaMap, size_t budget = DEFAULT_SEARCH_BUDGET);
+
+    /**
+     * @brief Group the pairs into orbits of unordered pairs under the automorphisms.
+     * @param nodePairs A vector of pairs of source and destination node IDs
+     * @param automorphisms Generators of the automorphisms
+     * @return The index of the representative pair of every pair, the first pair of its orbit in the list
+     */
+    std::vector<size_t> pairOrbits(const NodePairs &nodePairs, const Automorphisms &automorphisms);
+
+    /**
+     * @brief Evaluate one representative pair per orbit and copy the availability to the other pairs of the orbit.
+     * The representatives are enumerated and evaluated in parallel with the engine.
+     * @param graph Graph in CSR layout
+     * @param nodePairs A vector of pairs of source and destination node IDs
+     * @param probaMap Probability map containing the availability of each node
+     * @param engine Engine used for the representatives
+     * @param order Maximal size of the minimal cut sets for MCS, 0 for no limit
+     * @param parallel True to evaluate the representatives in parallel
+     * @param budget Maximal number of search tree nodes of the automorphism search
+     * @param info Filled with the counters of the run, nullptr to ignore them
+     * @return List of (src, dst, availability) tuples in the order of the pairs, disconnected pairs are 0
+     */
+    std::vector<AvailTriple> evalAvailTopo(const Graph &graph, const NodePairs &nodePairs, const ProbabilityMap &probaMap,
+                                           Engine engine = Engine::SDP, size_t order = 0, bool parallel = true,
+                                           size_t budget = DEFAULT_SEARCH_BUDGET, SymmetryInfo *info = nullptr);
+
+} // namespace pyrbdpp::symmetry
\ No newline at end of file
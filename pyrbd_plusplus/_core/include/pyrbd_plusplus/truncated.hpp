@@ -0,0 +1,52 @@
+#pragma once
+#include <pyrbd_plusplus/bounds.hpp>
+#include <pyrbd_plusplus/common.hpp>
+#include <pyrbd_plusplus/enumeration.hpp>
+#include <pyrbd_plusplus/graph.hpp>
+#include <pyrbd_plusplus/selector.hpp>
+#include <pyrbd_plusplus/stats.hpp>
+
+namespace pyrbdpp::truncated
+{
+    using Engine = selector::Engine;
+
+    /**
+     * @brief Evaluate the availability of a pair from its most probable path sets only, with the truncation bound.
+     * The path sets are enumerated with enumeration::probablePaths() until the paths left out can contribute less
+     * than epsilon, and the kept path sets are evaluated with the engine (toSDPSet() for SDP, toProbaSet() for
+     * PathSet, the minimal cut sets of the kept path sets for MCS).
+     * The kept path sets are a subsystem of the pair, so their availability is a lower bound, and the upper bound
+     * adds the probability that a path left out works, bounded by the prefixes left in the queue.
+     * @param graph Graph in CSR layout
+     * @param src Source node ID
+     * @param dst Destination node ID
+     * @param probaMap Probability map containing the availability of each node
+     * @param engine Engine evaluating the kept path sets
+     * @param epsilon Stop the enumeration once the bound of the paths left out is below epsilon
+     * @param maxPaths Stop the enumeration once this many path sets are kept, 0 for no limit
+     * @param order Maximal size of the cut sets for MCS, 0 for no limit
+     * @param pairStats Stats record filled with the instrumentation counters of the pair, nullptr to disable the stats
+     * @return The bounds of the pair, processed is the number of kept path sets and total adds the open prefixes
+     */
+    AvailBounds evalAvail(const Graph &graph, NodeID src, NodeID dst, const ProbabilityMap &probaMap, Engine engine = Engine::SDP,
+                          double epsilon = 1e-9, size_t maxPaths = 0, size_t order = 0, stats::PairStats *pairStats = nullptr);
+
+    /**
+     * @brief Evaluate the truncated availability bounds for each pair of source and destination nodes.
+     * @param graph Graph in CSR layout
+     * @param nodePairs A vector of pairs of source and destination node IDs
+     * @param probaMap Probability map containing the availability of each node
+     * @param engine Engine evaluating the kept path sets
+     * @param epsilon Stop the enumeration of a pair once the bound of its paths left out is below epsilon
+     * @param maxPaths Stop the enumeration of a pair once this many path sets are kept, 0 for no limit
+     * @param order Maximal size of the cut sets for MCS, 0 for no limit
+     * @param parallel True to process the pairs in parallel
+     * @param statsList Filled with one stats record per node pair, nullptr to disable the stats
+     * @return The bounds of each pair in the order of the pairs
+     */
+    std::vector<AvailBounds> evalAvailTopo(const Graph &graph, const NodePairs &nodePairs, const ProbabilityMap &probaMap,
+                                           Engine engine = Engine::SDP, double epsilon = 1e-9, size_t maxPaths = 0,
+                                           size_t order = 0, bool parallel = true,
+                                           std::vector<stats::PairStats> *statsList = nullptr);
+
+} // namespace pyrbdpp::truncated
\ No newline at end of file
@@ -0,0 +1,344 @@
+#include <pyrbd_plusplus/incremental.hpp>
+#include <pyrbd_plusplus/blockcut.hpp>
+#include <pyrbd_plusplus/enumeration.hpp>
+#include <queue>
+#include <stdexcept>
+#include <string>
+#include <omp.h>
+
+namespace pyrbdpp::incremental
+{
+    // Key of an edge in the edge index, smaller node first
+    static Edge edgeKey(NodeID u, NodeID v)
+    {
+        return u < v ? Edge{u, v} : Edge{v, u};
+    }
+
+    IncrementalTopology::IncrementalTopology(int numNodes, const std::vector<Edge> &edges, const std::map<int, double> &probabilities,
+                                             const NodePairs &nodePairs, Engine engine, size_t order, bool parallel)
+        : adjacency(numNodes + 1), availabilities(probabilities), nodePairs(nodePairs), engine(engine), order(order),
+          parallel(parallel), pairs(nodePairs.size()), nodeIndex(numNodes + 1)
+    {
+        for (const auto &[u, v] : edges)
+        {
+            checkNode(u);
+            checkNode(v);
+            if (u != v)
+            {
+                adjacency[u].insert(v);
+                adjacency[v].insert(u);
+            }
+        }
+        for (const auto &[src, dst] : nodePairs)
+        {
+            checkNode(src);
+            checkNode(dst);
+        }
+        rebuildGraph();
+    }
+
+    void IncrementalTopology::checkNode(NodeID node) const
+    {
+        if (node < 1 || node >= static_cast<NodeID>(adjacency.size()))
+        {
+            throw std::invalid_argument("Node " + std::to_string(node) + " is not a node of the topology");
+        }
+    }
+
+    void IncrementalTopology::rebuildGraph()
+    {
+        std::vector<Edge> edges;
+        for (NodeID u = 1; u < static_cast<NodeID>(adjacency.size()); ++u)
+        {
+            for (NodeID v : adjacency[u])
+            {
+                if (u < v)
+                {
+                    edges.emplace_back(u, v);
+                }
+            }
+        }
+        graph = Graph::fromEdges(static_cast<int>(adjacency.size()) - 1, edges);
+    }
+
+    bool IncrementalTopology::markDirty(size_t index, bool enumerate)
+    {
+        PairState &pair = pairs[index];
+        bool wasClean = !pair.evaluate;
+        pair.evaluate = true;
+        pair.enumerate = pair.enumerate || enumerate;
+        return wasClean;
+    }
+
+    void IncrementalTopology::unindex(size_t index)
+    {
+        for (const auto &pathSet : pairs[index].pathSets)
+        {
+            for (size_t k = 0; k < pathSet.size(); ++k)
+            {
+                nodeIndex[pathSet[k]].erase(index);
+                if (k > 0)
+                {
+                    auto it = edgeIndex.find(edgeKey(pathSet[k - 1], pathSet[k]));
+                    if (it != edgeIndex.end())
+                    {
+                        it->second.erase(index);
+                        if (it->second.empty())
+                        {
+                            edgeIndex.erase(it);
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    void IncrementalTopology::index(size_t index)
+    {
+        for (const auto &pathSet : pairs[index].pathSets)
+        {
+            for (size_t k = 0; k < pathSet.size(); ++k)
+            {
+                nodeIndex[pathSet[k]].insert(index);
+                if (k > 0)
+                {
+                    edgeIndex[edgeKey(pathSet[k - 1], pathSet[k])].insert(index);
+                }
+            }
+        }
+    }
+
+    size_t IncrementalTopology::addEdge(NodeID u, NodeID v)
+    {
+        checkNode(u);
+        checkNode(v);
+        if (u == v)
+        {
+            throw std::invalid_argument("Self-loop on node " + std::to_string(u));
+        }
+        if (!adjacency[u].insert(v).second)
+        {
+            return 0;
+        }
+        adjacency[v].insert(u);
+        rebuildGraph();
+        ++info_.edits;
+
+        // Step 1: Find the block of the new edge, u and v share exactly one block
+        blockcut::BlockCutTree tree = blockcut::biconnectedComponents(graph);
+        int numBlocks = static_cast<int>(tree.blocks.size());
+        int edgeBlock = -1;
+        for (int block : tree.blocksOf[u])
+        {
+            for (int other : tree.blocksOf[v])
+            {
+                edgeBlock = block == other ? block : edgeBlock;
+            }
+        }
+
+        // Step 2: Label the vertices of the block-cut tree with the branch around the block of the edge they are in.
+        // The blocks are the vertices 0..numBlocks-1 and the cut vertex c is the vertex numBlocks + c.
+        auto vertexOf = [&](NodeID node)
+        {
+            if (tree.blocksOf[node].empty())
+            {
+                return -1;
+            }
+            return tree.isCut(node) ? numBlocks + node : tree.blocksOf[node].front();
+        };
+        std::vector<int> branch(numBlocks + adjacency.size(), -1);
+        std::queue<int> queue;
+        branch[edgeBlock] = edgeBlock;
+        for (NodeID node : tree.blocks[edgeBlock])
+        {
+            if (tree.isCut(node))
+            {
+                branch[numBlocks + node] = numBlocks + node;
+                queue.push(numBlocks + node);
+            }
+        }
+        while (!queue.empty())
+        {
+            int vertex = queue.front();
+            queue.pop();
+            auto visit = [&](int next)
+            {
+                if (branch[next] == -1)
+                {
+                    branch[next] = branch[vertex];
+                    queue.push(next);
+                }
+            };
+            if (vertex < numBlocks)
+            {
+                for (NodeID node : tree.blocks[vertex])
+                {
+                    if (tree.isCut(node))
+                    {
+                        visit(numBlocks + node);
+                    }
+                }
+            }
+            else
+            {
+                for (int block : tree.blocksOf[vertex - numBlocks])
+                {
+                    visit(block);
+                }
+            }
+        }
+
+        // Step 3: A pair has a simple path through the edge if its tree path passes the block of the edge: one end is
+        // inside the block, or both ends are connected to the block in different branches
+        size_t dirty = 0;
+        for (size_t i = 0; i < nodePairs.size(); ++i)
+        {
+            int srcVertex = vertexOf(nodePairs[i].first);
+            int dstVertex = vertexOf(nodePairs[i].second);
+            if (srcVertex < 0 || dstVertex < 0 || branch[srcVertex] < 0 || branch[dstVertex] < 0)
+            {
+                continue;
+            }
+            if (branch[srcVertex] == edgeBlock || branch[dstVertex] == edgeBlock || branch[srcVertex] != branch[dstVertex])
+            {
+                dirty += markDirty(i, true);
+            }
+        }
+
+        return dirty;
+    }
+
+    size_t IncrementalTopology::removeEdge(NodeID u, NodeID v)
+    {
+        checkNode(u);
+        checkNode(v);
+        if (adjacency[u].erase(v) == 0)
+        {
+            return 0;
+        }
+        adjacency[v].erase(u);
+        rebuildGraph();
+        ++info_.edits;
+
+        size_t dirty = 0;
+        for (size_t i : pairsOfEdge(u, v))
+        {
+            dirty += markDirty(i, true);
+        }
+
+        return dirty;
+    }
+
+    size_t IncrementalTopology::setAvailability(NodeID node, double availability)
+    {
+        checkNode(node);
+        auto it = availabilities.find(node);
+        if (it != availabilities.end() && it->second == availability)
+        {
+            return 0;
+        }
+        availabilities[node] = availability;
+        ++info_.edits;
+
+        size_t dirty = 0;
+        for (size_t i : nodeIndex[node])
+        {
+            dirty += markDirty(i, false);
+        }
+
+        return dirty;
+    }
+
+    std::vector<AvailTriple> IncrementalTopology::evaluate()
+    {
+        // Step 1: Collect the dirty pairs and drop the index entries of the pairs enumerated again
+        std::vector<size_t> dirty = dirtyPairs();
+        size_t enumerations = 0;
+        for (size_t i : dirty)
+        {
+            if (pairs[i].enumerate)
+            {
+                unindex(i);
+                ++enumerations;
+            }
+        }
+
+        // Step 2: Refresh the dirty pairs in parallel, the clean pairs keep their availability
+        ProbabilityMap probaMap(availabilities);
+
+        #pragma omp parallel for schedule(dynamic) if (parallel)
+        for (size_t k = 0; k < dirty.size(); ++k)
+        {
+            PairState &pair = pairs[dirty[k]];
+            const auto &[src, dst] = nodePairs[dirty[k]];
+            if (pair.enumerate)
+            {
+                pair.pathSets = enumeration::minimalPaths(graph, src, dst);
+            }
+
+            // A pair without path sets is disconnected
+            pair.availability = 0.0;
+            if (!pair.pathSets.empty())
+            {
+                MinCutSets minCutSets;
+                if (engine == Engine::MCS)
+                {
+                    minCutSets = enumeration::minimalCuts(pair.pathSets, src, dst, order);
+                }
+                pair.availability = selector::evalAvailWith(engine, src, dst, probaMap, pair.pathSets, minCutSets, nullptr);
+            }
+        }
+
+        // Step 3: Index the new path sets and mark the pairs clean
+        for (size_t i : dirty)
+        {
+            if (pairs[i].enumerate)
+            {
+                index(i);
+            }
+            pairs[i].enumerate = false;
+            pairs[i].evaluate = false;
+        }
+        info_.enumerations += enumerations;
+        info_.evaluations += dirty.size();
+        info_.lastDirty = dirty.size();
+
+        std::vector<AvailTriple> availList(nodePairs.size());
+        for (size_t i = 0; i < nodePairs.size(); ++i)
+        {
+            availList[i] = std::make_tuple(nodePairs[i].first, nodePairs[i].second, pairs[i].availability);
+        }
+
+        return availList;
+    }
+
+    std::vector<size_t> IncrementalTopology::dirtyPairs() const
+    {
+        std::vector<size_t> dirty;
+        for (size_t i = 0; i < pairs.size(); ++i)
+        {
+            if (pairs[i].evaluate)
+            {
+                dirty.push_back(i);
+            }
+        }
+        return dirty;
+    }
+
+    std::vector<size_t> IncrementalTopology::pairsOfNode(NodeID node) const
+    {
+        checkNode(node);
+        return std::vector<size_t>(nodeIndex[node].begin(), nodeIndex[node].end());
+    }
+
+    std::vector<size_t> IncrementalTopology::pairsOfEdge(NodeID u, NodeID v) const
+    {
+        auto it = edgeIndex.find(edgeKey(u, v));
+        if (it == edgeIndex.end())
+        {
+            return {};
+        }
+        return std::vector<size_t>(it->second.begin(), it->second.end());
+    }
+
+} // namespace pyrbdpp::incremental
\ No newline at end of file
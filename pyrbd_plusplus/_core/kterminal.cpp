@@ -0,0 +1,359 @@
+#include <pyrbd_plusplus/kterminal.hpp>
+#include <pyrbd_plusplus/bdd.hpp>
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <omp.h>
+
+namespace pyrbdpp::kterminal
+{
+    // Marks a node that is not decided
+    constexpr uint32_t NO_LEVEL = std::numeric_limits<uint32_t>::max();
+
+    // A state holds one label per frontier node: 0 if it failed, otherwise its component numbered by first
+    // appearance, negative if the component contains a terminal. The labels are bytes, so the states of narrow
+    // frontiers fit in the inline buffer of the string and are hashed without allocation.
+    using State = std::string;
+
+    // Merged states of a level with their probabilities
+    struct Level
+    {
+        std::vector<State> states;
+        std::vector<double> mass;
+        std::unordered_map<State, size_t> index;
+        double reached = 0.0; // probability of the states that succeeded
+
+        void add(State &&state, double probability)
+        {
+            auto [it, inserted] = index.emplace(state, states.size());
+            if (inserted)
+            {
+                states.push_back(std::move(state));
+                mass.push_back(probability);
+            }
+            else
+            {
+                mass[it->second] += probability;
+            }
+        }
+    };
+
+    // Throw if the terminal set is empty or holds a node outside of the graph
+    static void checkTerminals(const Graph &graph, const Terminals &terminals)
+    {
+        if (terminals.empty())
+        {
+            throw std::invalid_argument("The terminal set is empty");
+        }
+        for (NodeID terminal : terminals)
+        {
+            if (terminal < 1 || terminal > graph.size())
+            {
+                throw std::invalid_argument("Terminal " + std::to_string(terminal) + " is not a node of the graph");
+            }
+        }
+    }
+
+    // Order of the nodes of a terminal set and the levels at which they leave the frontier
+    struct Plan
+    {
+        std::vector<NodeID> order;
+        std::vector<uint32_t> levelOf;
+        std::vector<uint32_t> lastLevel; // a decided node stays on the frontier until its last neighbor is decided
+        std::vector<char> isTerminal;
+        uint32_t lastTerminal = 0;
+        bool connected = true; // false if a terminal is not connected to the first one
+        size_t maxFrontier = 0;
+    };
+
+    // Order the nodes connected to the first terminal, a terminal outside of them is never connected
+    static Plan makePlan(const Graph &graph, const Terminals &terminals)
+    {
+        Plan plan;
+        plan.order = bdd::variableOrder(graph, terminals.front(), bdd::Ordering::BFS);
+        uint32_t numLevels = static_cast<uint32_t>(plan.order.size());
+
+        plan.levelOf.assign(graph.size() + 1, NO_LEVEL);
+        for (uint32_t level = 0; level < numLevels; ++level)
+        {
+            plan.levelOf[plan.order[level]] = level;
+        }
+        plan.isTerminal.assign(graph.size() + 1, 0);
+        for (NodeID terminal : terminals)
+        {
+            if (plan.levelOf[terminal] == NO_LEVEL)
+            {
+                plan.connected = false;
+                return plan;
+            }
+            plan.isTerminal[terminal] = 1;
+            plan.lastTerminal = std::max(plan.lastTerminal, plan.levelOf[terminal]);
+        }
+
+        plan.lastLevel.assign(graph.size() + 1, 0);
+        for (NodeID node : plan.order)
+        {
+            for (const NodeID *it = graph.begin(node); it != graph.end(node); ++it)
+            {
+                plan.lastLevel[node] = std::max(plan.lastLevel[node], plan.levelOf[*it]);
+            }
+        }
+
+        // The frontier of a level holds the nodes decided before it with a neighbor decided at or after it
+        std::vector<long> delta(numLevels + 1, 0);
+        for (NodeID node : plan.order)
+        {
+            uint32_t level = plan.levelOf[node];
+            if (plan.lastLevel[node] > level)
+            {
+                ++delta[level + 1];
+                --delta[plan.lastLevel[node] + 1];
+            }
+        }
+        long width = 0;
+        for (uint32_t level = 0; level < numLevels; ++level)
+        {
+            width += delta[level];
+            plan.maxFrontier = std::max(plan.maxFrontier, static_cast<size_t>(width));
+        }
+
+        return plan;
+    }
+
+    // Throw if the frontier of a plan is wider than the states support
+    static void checkFrontier(const Plan &plan)
+    {
+        if (plan.maxFrontier > MAX_FRONTIER)
+        {
+            throw std::invalid_argument("The frontier of the terminal set has more than " + std::to_string(MAX_FRONTIER) + " nodes");
+        }
+    }
+
+    // Expand the states of a checked plan level by level
+    static double evalPlan(const Graph &graph, const Plan &plan, const ProbabilityMap &probaMap, bool parallel,
+                           FrontierInfo *info)
+    {
+        const std::vector<NodeID> &order = plan.order;
+        const std::vector<uint32_t> &levelOf = plan.levelOf;
+        const std::vector<uint32_t> &lastLevel = plan.lastLevel;
+        const std::vector<char> &isTerminal = plan.isTerminal;
+        const uint32_t lastTerminal = plan.lastTerminal;
+        uint32_t numLevels = static_cast<uint32_t>(order.size());
+        if (info)
+        {
+            *info = FrontierInfo{};
+            info->levels = numLevels;
+        }
+        if (!plan.connected)
+        {
+            return 0.0;
+        }
+
+        // Expand the states level by level
+        double reliability = 0.0;
+        Level current;
+        current.states.emplace_back();
+        current.mass.push_back(1.0);
+        std::vector<NodeID> frontier;
+        std::vector<int> positionOf(graph.size() + 1, -1);
+
+        for (uint32_t level = 0; level < numLevels && !current.states.empty(); ++level)
+        {
+            NodeID node = order[level];
+            double p = probaMap[node];
+            double q = probaMap[-node];
+            bool allDecided = level >= lastTerminal;
+
+            std::vector<NodeID> nextFrontier;
+            for (NodeID other : frontier)
+            {
+                if (lastLevel[other] > level)
+                {
+                    nextFrontier.push_back(other);
+                }
+            }
+            if (lastLevel[node] > level)
+            {
+                nextFrontier.push_back(node);
+            }
+            for (size_t k = 0; k < frontier.size(); ++k)
+            {
+                positionOf[frontier[k]] = static_cast<int>(k);
+            }
+
+            // Expand the states [begin, end) of the level into one partial next level
+            auto expand = [&](size_t begin, size_t end, Level &next)
+            {
+                // The node is the last entry of the labels and marked the flags of the components with a terminal
+                size_t width = frontier.size();
+                std::vector<int> labels(width + 1);
+                std::vector<char> marked(width + 2);
+                std::vector<int> renamed(width + 2);
+
+                for (size_t k = begin; k < end; ++k)
+                {
+                    const State &state = current.states[k];
+                    for (int works = 0; works < 2; ++works)
+                    {
+                        if (!works && isTerminal[node])
+                        {
+                            continue;
+                        }
+
+                        std::fill(marked.begin(), marked.end(), 0);
+                        for (size_t i = 0; i < width; ++i)
+                        {
+                            labels[i] = std::abs(static_cast<int>(state[i]));
+                            marked[labels[i]] = marked[labels[i]] || state[i] < 0;
+                        }
+                        marked[0] = 0;
+
+                        // A working node merges the components of its decided neighbors
+                        int nodeLabel = 0;
+                        if (works)
+                        {
+                            nodeLabel = static_cast<int>(width) + 1;
+                            marked[nodeLabel] = isTerminal[node];
+                            for (const NodeID *it = graph.begin(node); it != graph.end(node); ++it)
+                            {
+                                int position = levelOf[*it] < level ? positionOf[*it] : -1;
+                                int merged = position >= 0 ? labels[position] : 0;
+                                if (merged == 0 || merged == nodeLabel)
+                                {
+                                    continue;
+                                }
+                                std::replace(labels.begin(), labels.begin() + width, merged, nodeLabel);
+                                marked[nodeLabel] = marked[nodeLabel] || marked[merged];
+                            }
+                        }
+                        labels[width] = nodeLabel;
+
+                        // Count the components with a terminal, every one of them is on the frontier or the node
+                        std::fill(renamed.begin(), renamed.end(), 0);
+                        int terminalComponents = 0;
+                        for (int label : labels)
+                        {
+                            if (label != 0 && marked[label] && renamed[label] == 0)
+                            {
+                                renamed[label] = -1;
+                                ++terminalComponents;
+                            }
+                        }
+                        double probability = current.mass[k] * (works ? p : q);
+                        if (allDecided && terminalComponents == 1)
+                        {
+                            next.reached += probability;
+                            continue;
+                        }
+
+                        // Relabel the next frontier by first appearance, a component with a terminal may not leave it
+                        std::fill(renamed.begin(), renamed.end(), 0);
+                        State nextState;
+                        nextState.reserve(nextFrontier.size());
+                        int numLabels = 0;
+                        int keptTerminalComponents = 0;
+                        for (NodeID other : nextFrontier)
+                        {
+                            int label = other == node ? nodeLabel : labels[positionOf[other]];
+                            if (label != 0 && renamed[label] == 0)
+                            {
+                                renamed[label] = ++numLabels;
+                                keptTerminalComponents += marked[label];
+                            }
+                            nextState.push_back(static_cast<char>(label == 0 ? 0 : marked[label] ? -renamed[label] : renamed[label]));
+                        }
+                        if (keptTerminalComponents < terminalComponents)
+                        {
+                            continue;
+                        }
+                        next.add(std::move(nextState), probability);
+                    }
+                }
+            };
+
+            // Expand the large levels in chunks, the partial levels are merged in chunk order
+            size_t numStates = current.states.size();
+            size_t numChunks = parallel && numStates >= PARALLEL_STATES ? static_cast<size_t>(omp_get_max_threads()) : 1;
+            std::vector<Level> partial(numChunks);
+
+            #pragma omp parallel for schedule(static) if (numChunks > 1)
+            for (size_t chunk = 0; chunk < numChunks; ++chunk)
+            {
+                expand(chunk * numStates / numChunks, (chunk + 1) * numStates / numChunks, partial[chunk]);
+            }
+
+            Level next = std::move(partial[0]);
+            for (size_t chunk = 1; chunk < numChunks; ++chunk)
+            {
+                next.reached += partial[chunk].reached;
+                for (size_t k = 0; k < partial[chunk].states.size(); ++k)
+                {
+                    next.add(std::move(partial[chunk].states[k]), partial[chunk].mass[k]);
+                }
+            }
+            reliability += next.reached;
+
+            if (info)
+            {
+                info->maxFrontier = std::max(info->maxFrontier, frontier.size());
+                info->maxStates = std::max(info->maxStates, numStates);
+                info->states += numStates;
+            }
+
+            for (NodeID other : frontier)
+            {
+                positionOf[other] = -1;
+            }
+            frontier = std::move(nextFrontier);
+            current = std::move(next);
+            current.index.clear();
+            current.reached = 0.0;
+        }
+
+        return reliability;
+    }
+
+    double evalReliability(const Graph &graph, const Terminals &terminals, const ProbabilityMap &probaMap, bool parallel,
+                           FrontierInfo *info)
+    {
+        checkTerminals(graph, terminals);
+        Plan plan = makePlan(graph, terminals);
+        checkFrontier(plan);
+        return evalPlan(graph, plan, probaMap, parallel, info);
+    }
+
+    std::vector<double> evalReliabilityTopo(const Graph &graph, const std::vector<Terminals> &terminalSets,
+                                            const ProbabilityMap &probaMap, bool parallel)
+    {
+        std::vector<double> reliabilities(terminalSets.size(), 0.0);
+        for (const auto &terminals : terminalSets)
+        {
+            checkTerminals(graph, terminals);
+        }
+
+        // Step 1: Plan every set and check the frontiers before the parallel region, an exception must not leave it
+        std::vector<Plan> plans(terminalSets.size());
+
+        #pragma omp parallel for schedule(dynamic) if (parallel)
+        for (size_t i = 0; i < terminalSets.size(); ++i)
+        {
+            plans[i] = makePlan(graph, terminalSets[i]);
+        }
+        for (const Plan &plan : plans)
+        {
+            checkFrontier(plan);
+        }
+
+        // Step 2: The sets are processed in parallel, each set is expanded by one thread
+        #pragma omp parallel for schedule(dynamic) if (parallel)
+        for (size_t i = 0; i < terminalSets.size(); ++i)
+        {
+            reliabilities[i] = evalPlan(graph, plans[i], probaMap, false, nullptr);
+        }
+
+        return reliabilities;
+    }
+
+} // namespace pyrbdpp::kterminal
\ No newline at end of file
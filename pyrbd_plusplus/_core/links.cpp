@@ -0,0 +1,48 @@
+#include <pyrbd_plusplus/links.hpp>
+#include <omp.h>
+
+namespace pyrbdpp::links
+{
+    double evalAvail(const Graph &graph, NodeID src, NodeID dst, const ProbabilityMap &probaMap, Engine engine,
+                     size_t order, stats::PairStats *pairStats)
+    {
+        // Step 1: Enumerate the path sets with the literals of the failing edges
+        enumeration::PathSets pathSets = enumeration::linkPaths(graph, src, dst, probaMap);
+        if (pathSets.empty())
+        {
+            return 0.0;
+        }
+
+        // Step 2: Evaluate them like node path sets, MCS hits the node and edge literals
+        enumeration::MinCutSets minCutSets;
+        if (engine == Engine::MCS)
+        {
+            minCutSets = enumeration::minimalCuts(pathSets, src, dst, order);
+        }
+        return selector::evalAvailWith(engine, src, dst, probaMap, pathSets, minCutSets, pairStats);
+    }
+
+    std::vector<AvailTriple> evalAvailTopo(const Graph &graph, const NodePairs &nodePairs, const ProbabilityMap &probaMap,
+                                           Engine engine, size_t order, bool parallel, std::vector<stats::PairStats> *statsList)
+    {
+        // Check before the parallel region, an exception must not leave it
+        enumeration::checkLinkMap(graph, probaMap);
+
+        std::vector<AvailTriple> availList(nodePairs.size());
+        if (statsList)
+        {
+            statsList->assign(nodePairs.size(), {});
+        }
+
+        #pragma omp parallel for schedule(dynamic) if (parallel)
+        for (size_t i = 0; i < nodePairs.size(); ++i)
+        {
+            const auto &[src, dst] = nodePairs[i];
+            double availability = evalAvail(graph, src, dst, probaMap, engine, order, statsList ? &(*statsList)[i] : nullptr);
+            availList[i] = std::make_tuple(src, dst, availability);
+        }
+
+        return availList;
+    }
+
+} // namespace pyrbdpp::links
\ No newline at end of file
@@ -1,4 +1,6 @@
 #include <pyrbd_plusplus/mcs.hpp>
+#include <pyrbd_plusplus/stats.hpp>
+#include <pyrbd_plusplus/perf.hpp>
 #include <algorithm>
 #include <chrono>
 #include <omp.h>
@@ -47,6 +49,10 @@ namespace pyrbdpp::mcs
 
             minCutSets.clear();
 
+            // Measure the disjoint expansion time and the hardware counters if enabled
+            stats::ScopedTimer timer(&stats::PairStats::rcTime);
+            perf::ScopedCounters counters(perf::Stage::RC);
+
             for (const auto &set : remainingSets)
             {
                 // Create the disjoint sets from the selectedSet and each set in the remaining sets
@@ -55,8 +61,15 @@ namespace pyrbdpp::mcs
                 // Insert the disjoint sets to the minCutSet
                 minCutSets.insert(minCutSets.end(), disjointSets.begin(), disjointSets.end());
             }
+
+            // Count the expansion round and the size of the working list
+            stats::add(&stats::PairStats::decompositions, 1);
+            stats::add(&stats::PairStats::bytesAllocated, stats::bytesOf(minCutSets));
+            stats::raise(&stats::PairStats::queueHighWater, minCutSets.size());
         }
 
+        stats::add(&stats::PairStats::terms, probaSets.size());
+
         return probaSets;
     }
 
@@ -136,6 +149,10 @@ namespace pyrbdpp::mcs
 
     double probaSetToAvail(NodeID src, NodeID dst, const ProbabilityMap &probaMap, const ProbaSets &probaSet)
     {
+        // Measure the evaluation time and the hardware counters if enabled
+        stats::ScopedTimer timer(&stats::PairStats::evalTime);
+        perf::ScopedCounters counters(perf::Stage::Eval);
+
         // Save the final result
         double unavil = 0.0;
         for (const auto &set : probaSet)
@@ -156,8 +173,16 @@ namespace pyrbdpp::mcs
     }
 
     
-    double evalAvail(NodeID src, NodeID dst, const ProbabilityMap &probaMap, const MinCutSets &minCutSets)
+    double evalAvail(NodeID src, NodeID dst, const ProbabilityMap &probaMap, const MinCutSets &minCutSets, stats::PairStats *pairStats)
     {
+        // Collect the stats of the pair if requested
+        stats::Scope scope(pairStats);
+        if (pairStats)
+        {
+            pairStats->src = src;
+            pairStats->dst = dst;
+        }
+
         // Convert the minimal cut sets to the probability sets
         ProbaSets probaSets = toProbaSet(src, dst, minCutSets);
 
@@ -165,33 +190,47 @@ namespace pyrbdpp::mcs
         return probaSetToAvail(src, dst, probaMap, probaSets);
     }
 
-    std::vector<AvailTriple> evalAvailTopo(const NodePairs &nodePairs, const ProbabilityMap &probaMap, const std::vector<MinCutSets> &minCutSetsList)
+    std::vector<AvailTriple> evalAvailTopo(const NodePairs &nodePairs, const ProbabilityMap &probaMap, const std::vector<MinCutSets> &minCutSetsList,
+                                           std::vector<stats::PairStats> *statsList)
     {
         std::vector<AvailTriple> availList;
 
+        // Prepare one stats record per pair if requested
+        if (statsList)
+        {
+            statsList->assign(nodePairs.size(), {});
+        }
+
         for (size_t i = 0; i < nodePairs.size(); ++i)
         {   
             const auto &[src, dst] = nodePairs[i];
             const auto &minCutSets = minCutSetsList[i];
 
-            double availability = evalAvail(src, dst, probaMap, minCutSets);
+            double availability = evalAvail(src, dst, probaMap, minCutSets, statsList ? &(*statsList)[i] : nullptr);
             availList.emplace_back(src, dst, availability);
         }
 
         return availList;
     }
 
-    std::vector<AvailTriple> evalAvailTopoParallel(const NodePairs &nodePairs, const ProbabilityMap &probaMap, const std::vector<MinCutSets> &minCutSetsList)
+    std::vector<AvailTriple> evalAvailTopoParallel(const NodePairs &nodePairs, const ProbabilityMap &probaMap, const std::vector<MinCutSets> &minCutSetsList,
+                                                   std::vector<stats::PairStats> *statsList)
     {
         std::vector<AvailTriple> availList(nodePairs.size());
 
+        // Prepare one stats record per pair if requested
+        if (statsList)
+        {
+            statsList->assign(nodePairs.size(), {});
+        }
+
         #pragma omp parallel for schedule(dynamic)
         for (size_t i = 0; i < nodePairs.size(); ++i)
         {
             const auto &[src, dst] = nodePairs[i];
             const auto &minCutSets = minCutSetsList[i];
 
-            double availability = evalAvail(src, dst, probaMap, minCutSets);
+            double availability = evalAvail(src, dst, probaMap, minCutSets, statsList ? &(*statsList)[i] : nullptr);
             availList[i] = std::make_tuple(src, dst, availability);
         }
 
@@ -0,0 +1,227 @@
+#include <pyrbd_plusplus/modules.hpp>
+#include <pyrbd_plusplus/enumeration.hpp>
+#include <unordered_map>
+#include <omp.h>
+
+namespace pyrbdpp::modules
+{
+    using Column = std::vector<uint64_t>;
+
+    // Hash of a column bitset over the sets
+    struct ColumnHash
+    {
+        size_t operator()(const Column &column) const
+        {
+            size_t hash = column.size();
+            for (uint64_t word : column)
+            {
+                hash ^= std::hash<uint64_t>{}(word) + 0x9e3779b97f4a7c15ULL + (hash << 6) + (hash >> 2);
+            }
+            return hash;
+        }
+    };
+
+    // Collapse the modules of path sets (all members needed) or cut sets (all members must fail)
+    static ModularSets collapse(const std::vector<Set> &sets, NodeID src, NodeID dst, const ProbabilityMap &probaMap, bool cutSets)
+    {
+        ModularSets result;
+        result.members = {{}, {src}, {dst}};
+        result.availability[1] = probaMap[src];
+        result.availability[2] = probaMap[dst];
+
+        // A node is mandatory if it is on every path or if it is a cut on its own
+        auto isTerminal = [src, dst](NodeID node)
+        { return node == src || node == dst; };
+        auto isMandatorySet = [&](const Set &set)
+        { return cutSets && set.size() == 1 && !isTerminal(set[0]); };
+
+        // Build the column of every node over the sets, in the order of the first appearance
+        size_t numWords = (sets.size() + 63) / 64;
+        std::unordered_map<NodeID, size_t> columnOf;
+        std::vector<NodeID> nodes;
+        std::vector<Column> columns;
+        std::vector<size_t> counts;
+        for (size_t i = 0; i < sets.size(); ++i)
+        {
+            for (NodeID node : sets[i])
+            {
+                if (isTerminal(node))
+                {
+                    continue;
+                }
+                auto [it, inserted] = columnOf.emplace(node, nodes.size());
+                if (inserted)
+                {
+                    nodes.push_back(node);
+                    columns.emplace_back(numWords, 0);
+                    counts.push_back(0);
+                }
+                columns[it->second][i >> 6] |= uint64_t(1) << (i & 63);
+                ++counts[it->second];
+            }
+        }
+
+        std::vector<char> mandatory(nodes.size(), 0);
+        for (const auto &set : sets)
+        {
+            if (isMandatorySet(set))
+            {
+                mandatory[columnOf[set[0]]] = 1;
+            }
+        }
+
+        // Group the nodes with the same column into a literal
+        std::unordered_map<Column, NodeID, ColumnHash> literalOfColumn;
+        std::unordered_map<NodeID, NodeID> literalOf;
+        for (size_t k = 0; k < nodes.size(); ++k)
+        {
+            NodeID node = nodes[k];
+            double p = probaMap[node];
+            if (!cutSets && counts[k] == sets.size())
+            {
+                mandatory[k] = 1;
+            }
+            if (mandatory[k])
+            {
+                result.multiplier *= p;
+                ++result.mandatory;
+                continue;
+            }
+
+            auto [it, inserted] = literalOfColumn.emplace(std::move(columns[k]), static_cast<NodeID>(result.members.size()));
+            NodeID literal = it->second;
+            if (inserted)
+            {
+                result.members.emplace_back();
+                result.availability[literal] = cutSets ? 0.0 : 1.0;
+            }
+            result.members[literal].push_back(node);
+            literalOf[node] = literal;
+
+            // A path module works if all members work, a cut module fails if all members fail
+            if (cutSets)
+            {
+                result.availability[literal] = 1.0 - (1.0 - result.availability[literal]) * (1.0 - p);
+            }
+            else
+            {
+                result.availability[literal] *= p;
+            }
+        }
+
+        // Rewrite the sets over the literals, every literal once per set
+        result.sets.reserve(sets.size());
+        for (const auto &set : sets)
+        {
+            if (isMandatorySet(set))
+            {
+                continue;
+            }
+            Set literals;
+            for (NodeID node : set)
+            {
+                NodeID literal = node == src ? 1 : node == dst ? 2 : mandatory[columnOf[node]] ? 0 : literalOf[node];
+                if (literal && std::find(literals.begin(), literals.end(), literal) == literals.end())
+                {
+                    literals.push_back(literal);
+                }
+            }
+            result.sets.push_back(std::move(literals));
+        }
+
+        return result;
+    }
+
+    ModularSets collapsePathSets(const PathSets &pathSets, NodeID src, NodeID dst, const ProbabilityMap &probaMap)
+    {
+        return collapse(pathSets, src, dst, probaMap, false);
+    }
+
+    ModularSets collapseCutSets(const MinCutSets &minCutSets, NodeID src, NodeID dst, const ProbabilityMap &probaMap)
+    {
+        return collapse(minCutSets, src, dst, probaMap, true);
+    }
+
+    double evalAvailWith(Engine engine, NodeID src, NodeID dst, const ProbabilityMap &probaMap,
+                         const PathSets &pathSets, const MinCutSets &minCutSets, stats::PairStats *pairStats,
+                         ModularSets *modularSets)
+    {
+        bool cutSets = engine == Engine::MCS;
+        ModularSets collapsed = cutSets ? collapseCutSets(minCutSets, src, dst, probaMap) : collapsePathSets(pathSets, src, dst, probaMap);
+        ProbabilityMap literalMap(collapsed.availability);
+
+        // The engine runs on the literals, the source and destination are the literals 1 and 2
+        double availability = collapsed.multiplier * selector::evalAvailWith(engine, 1, 2, literalMap,
+                                                                             cutSets ? PathSets{} : collapsed.sets,
+                                                                             cutSets ? collapsed.sets : MinCutSets{}, pairStats);
+        if (pairStats)
+        {
+            pairStats->src = src;
+            pairStats->dst = dst;
+        }
+        if (modularSets)
+        {
+            *modularSets = std::move(collapsed);
+        }
+        return availability;
+    }
+
+    std::vector<AvailTriple> evalAvailTopo(const Graph &graph, const NodePairs &nodePairs, const ProbabilityMap &probaMap,
+                                           Engine engine, size_t order, bool parallel,
+                                           std::vector<stats::PairStats> *statsList, ModuleInfo *info)
+    {
+        std::vector<AvailTriple> availList(nodePairs.size());
+        if (statsList)
+        {
+            statsList->assign(nodePairs.size(), {});
+        }
+
+        size_t numNodes = 0;
+        size_t numLiterals = 0;
+        size_t numMandatory = 0;
+        size_t numPathSets = 0;
+
+        #pragma omp parallel for schedule(dynamic) reduction(+ : numNodes, numLiterals, numMandatory, numPathSets) if (parallel)
+        for (size_t i = 0; i < nodePairs.size(); ++i)
+        {
+            const auto &[src, dst] = nodePairs[i];
+            PathSets pathSets = enumeration::minimalPaths(graph, src, dst);
+            numPathSets += pathSets.size();
+
+            // Disconnected pairs are never available
+            double availability = 0.0;
+            if (!pathSets.empty())
+            {
+                MinCutSets minCutSets;
+                if (engine == Engine::MCS)
+                {
+                    minCutSets = enumeration::minimalCuts(pathSets, src, dst, order);
+                }
+
+                ModularSets collapsed;
+                availability = evalAvailWith(engine, src, dst, probaMap, pathSets, minCutSets,
+                                             statsList ? &(*statsList)[i] : nullptr, &collapsed);
+
+                numLiterals += collapsed.members.size() - 1;
+                numMandatory += collapsed.mandatory;
+                numNodes += collapsed.mandatory;
+                for (size_t literal = 1; literal < collapsed.members.size(); ++literal)
+                {
+                    numNodes += collapsed.members[literal].size();
+                }
+            }
+            availList[i] = std::make_tuple(src, dst, availability);
+        }
+
+        if (info)
+        {
+            info->nodes = numNodes;
+            info->literals = numLiterals;
+            info->mandatory = numMandatory;
+            info->pathSets = numPathSets;
+        }
+
+        return availList;
+    }
+
+} // namespace pyrbdpp::modules
\ No newline at end of file
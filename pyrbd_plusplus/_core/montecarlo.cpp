@@ -0,0 +1,402 @@
+#include <pyrbd_plusplus/montecarlo.hpp>
+#include <bit>
+#include <cmath>
+
+namespace pyrbdpp::montecarlo
+{
+    // Finalizer of SplitMix64, a bijective mix of the 64 bits
+    static inline uint64_t mix(uint64_t x)
+    {
+        x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+        return x ^ (x >> 31);
+    }
+
+    // Key of the random stream of a node, the stream of node 0 is free for other draws
+    static inline uint64_t streamKey(uint64_t seed, NodeID node)
+    {
+        return mix(seed ^ mix(static_cast<uint64_t>(node)));
+    }
+
+    // Random number of a lane of a batch in a stream
+    static inline uint64_t draw(uint64_t key, uint64_t batch, size_t lane)
+    {
+        return mix(key + (batch * LANES + lane) * 0x9E3779B97F4A7C15ULL);
+    }
+
+    Word sampleWord(uint64_t seed, NodeID node, uint64_t batch, double availability)
+    {
+        if (availability >= 1.0)
+        {
+            return ~Word(0);
+        }
+        if (availability <= 0.0)
+        {
+            return 0;
+        }
+
+        // A lane works if its random number is below availability * 2^64
+        const uint64_t threshold = static_cast<uint64_t>(std::ldexp(availability, 64));
+        const uint64_t key = streamKey(seed, node);
+
+        Word word = 0;
+        for (size_t lane = 0; lane < LANES; ++lane)
+        {
+            word |= Word(draw(key, batch, lane) < threshold) << lane;
+        }
+        return word;
+    }
+
+    // Wilson score interval of hits successes in samples trials
+    static std::pair<double, double> wilsonInterval(size_t hits, size_t samples, double z)
+    {
+        double n = static_cast<double>(samples);
+        double p = static_cast<double>(hits) / n;
+        double z2 = z * z;
+        double center = (p + z2 / (2.0 * n)) / (1.0 + z2 / n);
+        double half = z / (1.0 + z2 / n) * std::sqrt(p * (1.0 - p) / n + z2 / (4.0 * n * n));
+        return {std::max(0.0, center - half), std::min(1.0, center + half)};
+    }
+
+    static void wilson(Estimate &estimate, size_t hits, size_t samples, double z)
+    {
+        std::tie(estimate.lower, estimate.upper) = wilsonInterval(hits, samples, z);
+        estimate.availability = static_cast<double>(hits) / samples;
+        estimate.samples = samples;
+    }
+
+    // Sampled states and BFS buffers of a thread
+    struct Workspace
+    {
+        std::vector<Word> state; // working lanes of every node
+        std::vector<Word> reach; // lanes in which every node is reached from the source
+        std::vector<NodeID> queue;
+        std::vector<char> queued;
+
+        explicit Workspace(int numNodes)
+            : state(numNodes + 1), reach(numNodes + 1), queued(numNodes + 1)
+        {
+            queue.reserve(numNodes);
+        }
+    };
+
+    // Propagate the reached lanes from src until no word changes
+    static void reachFrom(const Graph &graph, NodeID src, Workspace &ws)
+    {
+        std::fill(ws.reach.begin(), ws.reach.end(), 0);
+        ws.reach[src] = ws.state[src];
+        if (!ws.reach[src])
+        {
+            return;
+        }
+
+        ws.queue.assign(1, src);
+        ws.queued[src] = 1;
+        for (size_t head = 0; head < ws.queue.size(); ++head)
+        {
+            NodeID node = ws.queue[head];
+            ws.queued[node] = 0;
+            Word reached = ws.reach[node];
+            for (const NodeID *it = graph.begin(node); it != graph.end(node); ++it)
+            {
+                NodeID neighbor = *it;
+                Word added = reached & ws.state[neighbor] & ~ws.reach[neighbor];
+                if (added)
+                {
+                    ws.reach[neighbor] |= added;
+                    if (!ws.queued[neighbor])
+                    {
+                        ws.queued[neighbor] = 1;
+                        ws.queue.push_back(neighbor);
+                    }
+                }
+            }
+        }
+    }
+
+    std::vector<Estimate> estimateAvailTopo(const Graph &graph, const NodePairs &nodePairs, const ProbabilityMap &probaMap,
+                                            const Options &options, bool parallel)
+    {
+        const int numNodes = graph.size();
+        std::vector<Estimate> estimates(nodePairs.size());
+        std::vector<size_t> hits(nodePairs.size(), 0);
+        std::vector<char> active(nodePairs.size(), 1);
+
+        // Group the pairs by source, one BFS per source counts all its pairs
+        std::vector<std::vector<size_t>> pairsOf(numNodes + 1);
+        for (size_t i = 0; i < nodePairs.size(); ++i)
+        {
+            const auto &[src, dst] = nodePairs[i];
+            estimates[i].src = src;
+            estimates[i].dst = dst;
+            pairsOf[src].push_back(i);
+        }
+
+        std::vector<NodeID> sources;
+        for (NodeID node = 1; node <= numNodes; ++node)
+        {
+            if (!pairsOf[node].empty())
+            {
+                sources.push_back(node);
+            }
+        }
+
+        std::vector<double> availability(numNodes + 1);
+        for (NodeID node = 1; node <= numNodes; ++node)
+        {
+            availability[node] = probaMap[node];
+        }
+
+        const size_t maxBatches = std::max<size_t>(1, (options.maxSamples + LANES - 1) / LANES);
+        size_t batches = 0;
+        while (batches < maxBatches && !sources.empty())
+        {
+            const size_t roundEnd = std::min(maxBatches, batches + ROUND_BATCHES);
+
+            #pragma omp parallel if (parallel)
+            {
+                Workspace ws(numNodes);
+                std::vector<size_t> threadHits(nodePairs.size(), 0);
+
+                #pragma omp for schedule(dynamic)
+                for (size_t batch = batches; batch < roundEnd; ++batch)
+                {
+                    // Sample every node in the lanes of the batch
+                    for (NodeID node = 1; node <= numNodes; ++node)
+                    {
+                        ws.state[node] = sampleWord(options.seed, node, batch, availability[node]);
+                    }
+
+                    // Count the connected lanes of the active pairs of every source
+                    for (NodeID src : sources)
+                    {
+                        reachFrom(graph, src, ws);
+                        for (size_t i : pairsOf[src])
+                        {
+                            if (active[i])
+                            {
+                                threadHits[i] += std::popcount(ws.reach[nodePairs[i].second]);
+                            }
+                        }
+                    }
+                }
+
+                // Integer counts, so the merge order does not change the result
+                #pragma omp critical
+                for (size_t i = 0; i < nodePairs.size(); ++i)
+                {
+                    hits[i] += threadHits[i];
+                }
+            }
+
+            // Update the intervals of the active pairs and stop the converged ones
+            size_t samples = (roundEnd - batches) * LANES;
+            batches = roundEnd;
+            for (size_t i = 0; i < nodePairs.size(); ++i)
+            {
+                if (!active[i])
+                {
+                    continue;
+                }
+                wilson(estimates[i], hits[i], estimates[i].samples + samples, options.z);
+                if (options.targetWidth > 0.0 && estimates[i].upper - estimates[i].lower <= options.targetWidth)
+                {
+                    estimates[i].converged = true;
+                    active[i] = 0;
+                }
+            }
+
+            // Skip the sources without active pairs
+            std::erase_if(sources, [&](NodeID src)
+                          { return std::none_of(pairsOf[src].begin(), pairsOf[src].end(), [&](size_t i)
+                                                { return active[i]; }); });
+        }
+
+        return estimates;
+    }
+
+    Estimate estimateAvail(const Graph &graph, NodeID src, NodeID dst, const ProbabilityMap &probaMap,
+                           const Options &options, bool parallel)
+    {
+        return estimateAvailTopo(graph, {{src, dst}}, probaMap, options, parallel).front();
+    }
+
+
+    // Weighted mean and interval of the importance samples from the histogram of the failed cut set counts
+    static void weighted(RareEstimate &estimate, const std::vector<size_t> &histogram, size_t samples, double total, double z)
+    {
+        // The weight of a sample with count failed cut sets is total / count
+        double sum = 0.0;
+        double sumSquares = 0.0;
+        for (size_t count = 1; count < histogram.size(); ++count)
+        {
+            sum += static_cast<double>(histogram[count]) / count;
+            sumSquares += static_cast<double>(histogram[count]) / (count * count);
+        }
+
+        double n = static_cast<double>(samples);
+        double mean = total * sum / n;
+        double variance = std::max(0.0, total * total * sumSquares / n - mean * mean);
+        double half = z * std::sqrt(variance / n);
+
+        // With rare overlaps no sample may fail two cut sets and the sample variance is 0. The weights only differ
+        // from total on the samples with count >= 2, by less than total * (1 - 1/m), so the Wilson interval of their
+        // fraction bounds the error of the mean even if none was seen
+        size_t overlaps = samples - histogram[1];
+        auto [lowFraction, highFraction] = wilsonInterval(overlaps, samples, z);
+        double fraction = static_cast<double>(overlaps) / n;
+        double spread = total * (1.0 - 1.0 / (histogram.size() - 1));
+        half = std::max(half, spread * std::max(highFraction - fraction, fraction - lowFraction));
+
+        estimate.unavailability = mean;
+        estimate.lower = std::max(0.0, mean - half);
+        estimate.upper = std::min(1.0, mean + half);
+        estimate.relError = half / mean;
+        estimate.samples = samples;
+    }
+
+    RareEstimate estimateUnavail(NodeID src, NodeID dst, const ProbabilityMap &probaMap, const MinCutSets &minCutSets,
+                                 const Options &options, bool parallel)
+    {
+        RareEstimate estimate;
+        estimate.src = src;
+        estimate.dst = dst;
+
+        // Only the nodes of the cut sets decide if a cut set fails, index them densely
+        std::vector<NodeID> nodes;
+        for (const auto &cutSet : minCutSets)
+        {
+            nodes.insert(nodes.end(), cutSet.begin(), cutSet.end());
+        }
+        std::sort(nodes.begin(), nodes.end());
+        nodes.erase(std::unique(nodes.begin(), nodes.end()), nodes.end());
+
+        auto indexOf = [&](NodeID node)
+        { return std::lower_bound(nodes.begin(), nodes.end(), node) - nodes.begin(); };
+
+        // Probability of every cut set to fail and their running sum, to choose the cut set of a sample
+        std::vector<std::vector<size_t>> cutSets;
+        std::vector<double> cumulative;
+        double total = 0.0;
+        for (const auto &cutSet : minCutSets)
+        {
+            double failure = 1.0;
+            std::vector<size_t> indices;
+            for (NodeID node : cutSet)
+            {
+                failure *= probaMap[-node];
+                indices.push_back(indexOf(node));
+            }
+            if (failure > 0.0)
+            {
+                total += failure;
+                cumulative.push_back(total);
+                cutSets.push_back(std::move(indices));
+            }
+        }
+
+        // No cut set can fail, the pair is always available
+        if (cutSets.empty())
+        {
+            estimate.converged = true;
+            return estimate;
+        }
+
+        std::vector<double> availability(nodes.size());
+        for (size_t k = 0; k < nodes.size(); ++k)
+        {
+            availability[k] = probaMap[nodes[k]];
+        }
+
+        // The stream of node 0 chooses the cut set of every lane
+        const uint64_t cutKey = streamKey(options.seed, 0);
+
+        // histogram[count] is the number of samples in which count cut sets failed
+        std::vector<size_t> histogram(cutSets.size() + 1, 0);
+
+        const size_t maxBatches = std::max<size_t>(1, (options.maxSamples + LANES - 1) / LANES);
+        size_t batches = 0;
+        while (batches < maxBatches && !estimate.converged)
+        {
+            const size_t roundEnd = std::min(maxBatches, batches + ROUND_BATCHES);
+
+            #pragma omp parallel if (parallel)
+            {
+                std::vector<Word> failed(nodes.size());
+                std::vector<size_t> counts(LANES);
+                std::vector<size_t> threadHistogram(histogram.size(), 0);
+
+                #pragma omp for schedule(dynamic)
+                for (size_t batch = batches; batch < roundEnd; ++batch)
+                {
+                    // Sample the failed lanes of every node
+                    for (size_t k = 0; k < nodes.size(); ++k)
+                    {
+                        failed[k] = ~sampleWord(options.seed, nodes[k], batch, availability[k]);
+                    }
+
+                    // Fail the nodes of the chosen cut set of every lane
+                    for (size_t lane = 0; lane < LANES; ++lane)
+                    {
+                        double random = std::ldexp(static_cast<double>(draw(cutKey, batch, lane) >> 11), -53) * total;
+                        size_t chosen = std::upper_bound(cumulative.begin(), cumulative.end(), random) - cumulative.begin();
+                        for (size_t k : cutSets[std::min(chosen, cutSets.size() - 1)])
+                        {
+                            failed[k] |= Word(1) << lane;
+                        }
+                    }
+
+                    // Count the failed cut sets of every lane, the chosen one included
+                    std::fill(counts.begin(), counts.end(), 0);
+                    for (const auto &cutSet : cutSets)
+                    {
+                        Word word = ~Word(0);
+                        for (size_t k : cutSet)
+                        {
+                            word &= failed[k];
+                        }
+                        while (word)
+                        {
+                            ++counts[__builtin_ctzll(word)];
+                            word &= word - 1;
+                        }
+                    }
+
+                    for (size_t count : counts)
+                    {
+                        ++threadHistogram[count];
+                    }
+                }
+
+                // Integer counts, so the merge order does not change the result
+                #pragma omp critical
+                for (size_t count = 0; count < histogram.size(); ++count)
+                {
+                    histogram[count] += threadHistogram[count];
+                }
+            }
+
+            batches = roundEnd;
+            weighted(estimate, histogram, batches * LANES, total, options.z);
+            estimate.converged = options.targetRelError > 0.0 && estimate.relError <= options.targetRelError;
+        }
+
+        return estimate;
+    }
+
+    std::vector<RareEstimate> estimateUnavailTopo(const NodePairs &nodePairs, const ProbabilityMap &probaMap,
+                                                  const std::vector<MinCutSets> &minCutSetsList, const Options &options,
+                                                  bool parallel)
+    {
+        std::vector<RareEstimate> estimates(nodePairs.size());
+
+        #pragma omp parallel for schedule(dynamic) if (parallel)
+        for (size_t i = 0; i < nodePairs.size(); ++i)
+        {
+            const auto &[src, dst] = nodePairs[i];
+            estimates[i] = estimateUnavail(src, dst, probaMap, minCutSetsList[i], options, false);
+        }
+
+        return estimates;
+    }
+} // namespace pyrbdpp::montecarlo
\ No newline at end of file
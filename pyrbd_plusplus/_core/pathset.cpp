@@ -1,4 +1,6 @@
 #include <pyrbd_plusplus/pathset.hpp>
+#include <pyrbd_plusplus/stats.hpp>
+#include <pyrbd_plusplus/perf.hpp>
 #include <algorithm>
 #include <chrono>
 #include <omp.h>
@@ -37,6 +39,10 @@ namespace pyrbdpp::pathset
 
             pathSets.clear();
 
+            // Measure the disjoint expansion time and the hardware counters if enabled
+            stats::ScopedTimer timer(&stats::PairStats::rcTime);
+            perf::ScopedCounters counters(perf::Stage::RC);
+
             for (const auto &set : remainingSets)
             {
                 // Create the disjoint sets from the selectedSet and each set in the remaining sets
@@ -45,8 +51,15 @@ namespace pyrbdpp::pathset
                 // Insert the disjoint sets to the pathSets
                 pathSets.insert(pathSets.end(), disjointSets.begin(), disjointSets.end());
             }
+
+            // Count the expansion round and the size of the working list
+            stats::add(&stats::PairStats::decompositions, 1);
+            stats::add(&stats::PairStats::bytesAllocated, stats::bytesOf(pathSets));
+            stats::raise(&stats::PairStats::queueHighWater, pathSets.size());
         }
 
+        stats::add(&stats::PairStats::terms, probaSets.size());
+
         return probaSets;
     }
 
@@ -112,6 +125,10 @@ namespace pyrbdpp::pathset
 
     double probaSetToAvail(NodeID src, NodeID dst, const ProbabilityMap &probaMap, const ProbaSets &probaSets)
     {
+        // Measure the evaluation time and the hardware counters if enabled
+        stats::ScopedTimer timer(&stats::PairStats::evalTime);
+        perf::ScopedCounters counters(perf::Stage::Eval);
+
         // Save the final result
         double avail = 0.0;
         for (const auto &set : probaSets)
@@ -129,8 +146,16 @@ namespace pyrbdpp::pathset
         return avail;
     }
 
-    double evalAvail(NodeID src, NodeID dst, const ProbabilityMap &probaMap, const PathSets &pathSets)
+    double evalAvail(NodeID src, NodeID dst, const ProbabilityMap &probaMap, const PathSets &pathSets, stats::PairStats *pairStats)
     {
+        // Collect the stats of the pair if requested
+        stats::Scope scope(pairStats);
+        if (pairStats)
+        {
+            pairStats->src = src;
+            pairStats->dst = dst;
+        }
+
         // Convert the path sets to the probability sets
         ProbaSets probaSets = toProbaSet(src, dst, pathSets);
 
@@ -138,37 +163,160 @@ namespace pyrbdpp::pathset
         return probaSetToAvail(src, dst, probaMap, probaSets);
     }
 
-    std::vector<AvailTriple> evalAvailTopo(const NodePairs &nodePairs, const ProbabilityMap &probaMap, const std::vector<PathSets> &pathsetsList)
+    std::vector<AvailTriple> evalAvailTopo(const NodePairs &nodePairs, const ProbabilityMap &probaMap, const std::vector<PathSets> &pathsetsList,
+                                           std::vector<stats::PairStats> *statsList)
     {
         std::vector<AvailTriple> availList;
 
+        // Prepare one stats record per pair if requested
+        if (statsList)
+        {
+            statsList->assign(nodePairs.size(), {});
+        }
+
         for (size_t i = 0; i < nodePairs.size(); ++i)
         {   
             const auto &[src, dst] = nodePairs[i];
             const auto &pathsets = pathsetsList[i];
 
-            double availability = evalAvail(src, dst, probaMap, pathsets);
+            double availability = evalAvail(src, dst, probaMap, pathsets, statsList ? &(*statsList)[i] : nullptr);
             availList.emplace_back(src, dst, availability);
         }
 
         return availList;
     }
 
-    std::vector<AvailTriple> evalAvailTopoParallel(const NodePairs &nodePairs, const ProbabilityMap &probaMap, const std::vector<PathSets> &pathsetsList)
+    std::vector<AvailTriple> evalAvailTopoParallel(const NodePairs &nodePairs, const ProbabilityMap &probaMap, const std::vector<PathSets> &pathsetsList,
+                                                   std::vector<stats::PairStats> *statsList)
     {
         std::vector<AvailTriple> availList(nodePairs.size());
 
+        // Prepare one stats record per pair if requested
+        if (statsList)
+        {
+            statsList->assign(nodePairs.size(), {});
+        }
+
         #pragma omp parallel for schedule(dynamic)
         for (size_t i = 0; i < nodePairs.size(); ++i)
         {
             const auto &[src, dst] = nodePairs[i];
             const auto &pathsets = pathsetsList[i];
 
-            double availability = evalAvail(src, dst, probaMap, pathsets);
+            double availability = evalAvail(src, dst, probaMap, pathsets, statsList ? &(*statsList)[i] : nullptr);
             availList[i] = std::make_tuple(src, dst, availability);
         }
 
         return availList;
     }
 
+    // Anytime evaluation of a pair, shared by the serial and topology versions
+    static AvailBounds evalBounds(NodeID src, NodeID dst, const ProbabilityMap &probaMap, const PathSets &pathSets,
+                                  const BoundsOptions &options, const BoundsCallback &callback,
+                                  BoundsTracker::Clock::time_point deadline)
+    {
+        BoundsTracker tracker(src, dst, options, callback, deadline);
+
+        // The availability is the sum of the selected sets plus the probability of the union of the working sets
+        PathSets workingSets = pathSets;
+        std::vector<double> probas;
+        double lower = 0.0;
+        size_t rounds = 0;
+
+        auto setProba = [&probaMap](const Set &set)
+        {
+            double temp = 1.0;
+            for (const auto &num : set)
+            {
+                temp *= probaMap[num];
+            }
+            return temp;
+        };
+
+        bool proceed = true;
+        while (proceed && !workingSets.empty())
+        {
+            // Select the most probable working set, any choice keeps the expansion disjoint
+            probas.resize(workingSets.size());
+            std::transform(workingSets.begin(), workingSets.end(), probas.begin(), setProba);
+            size_t best = std::max_element(probas.begin(), probas.end()) - probas.begin();
+
+            Set selectedSet = std::move(workingSets[best]);
+            lower += probas[best];
+            ++rounds;
+
+            PathSets remainingSets;
+            remainingSets.swap(workingSets);
+            remainingSets.erase(remainingSets.begin() + best);
+
+            {
+                // Measure the disjoint expansion time and the hardware counters if enabled
+                stats::ScopedTimer timer(&stats::PairStats::rcTime);
+                perf::ScopedCounters counters(perf::Stage::RC);
+
+                for (const auto &set : remainingSets)
+                {
+                    // Create the disjoint sets from the selectedSet and each set in the remaining sets
+                    DisjointSets disjointSets = makeDisjointSet(selectedSet, set);
+
+                    // Insert the disjoint sets to the working sets
+                    workingSets.insert(workingSets.end(), disjointSets.begin(), disjointSets.end());
+                }
+            }
+
+            // The union bound of the working sets limits the mass not evaluated yet
+            double remaining = 0.0;
+            for (const auto &set : workingSets)
+            {
+                remaining += setProba(set);
+            }
+
+            proceed = tracker.update(lower, remaining, rounds, rounds + workingSets.size());
+        }
+
+        return tracker.finish(workingSets.empty());
+    }
+
+    AvailBounds evalAvailBounds(NodeID src, NodeID dst, const ProbabilityMap &probaMap, const PathSets &pathSets,
+                                const BoundsOptions &options, const BoundsCallback &callback)
+    {
+        return evalBounds(src, dst, probaMap, pathSets, options, callback, BoundsTracker::deadlineOf(options));
+    }
+
+    std::vector<AvailBounds> evalAvailBoundsTopo(const NodePairs &nodePairs, const ProbabilityMap &probaMap,
+                                                 const std::vector<PathSets> &pathsetsList, const BoundsOptions &options)
+    {
+        std::vector<AvailBounds> boundsList;
+        boundsList.reserve(nodePairs.size());
+
+        // The deadline is shared by all pairs
+        auto deadline = BoundsTracker::deadlineOf(options);
+
+        for (size_t i = 0; i < nodePairs.size(); ++i)
+        {
+            const auto &[src, dst] = nodePairs[i];
+            boundsList.push_back(evalBounds(src, dst, probaMap, pathsetsList[i], options, {}, deadline));
+        }
+
+        return boundsList;
+    }
+
+    std::vector<AvailBounds> evalAvailBoundsTopoParallel(const NodePairs &nodePairs, const ProbabilityMap &probaMap,
+                                                         const std::vector<PathSets> &pathsetsList, const BoundsOptions &options)
+    {
+        std::vector<AvailBounds> boundsList(nodePairs.size());
+
+        // The deadline is shared by all pairs
+        auto deadline = BoundsTracker::deadlineOf(options);
+
+        #pragma omp parallel for schedule(dynamic)
+        for (size_t i = 0; i < nodePairs.size(); ++i)
+        {
+            const auto &[src, dst] = nodePairs[i];
+            boundsList[i] = evalBounds(src, dst, probaMap, pathsetsList[i], options, {}, deadline);
+        }
+
+        return boundsList;
+    }
+
 } // namespace pyrbdpp::pathset
\ No newline at end of file
@@ -0,0 +1,321 @@
+#include <pyrbd_plusplus/perf.hpp>
+#include <memory>
+#include <mutex>
+
+#ifdef __linux__
+#include <cerrno>
+#include <cstring>
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace pyrbdpp::perf
+{
+    std::atomic<bool> enabled{false};
+
+    namespace
+    {
+        // The collected counters of a thread, kept alive by the registry after the thread ended
+        struct ThreadData
+        {
+            std::mutex mutex;
+            ThreadReport report;
+        };
+
+        std::mutex registryMutex;
+        std::vector<std::shared_ptr<ThreadData>> registry;
+        std::string lastError;
+
+        void setError(const std::string &error)
+        {
+            std::lock_guard<std::mutex> lock(registryMutex);
+            lastError = error;
+        }
+
+        // The perf event group of a thread, opened on the first measurement
+        struct ThreadCounters
+        {
+            std::array<int, 4> fds{-1, -1, -1, -1};
+            bool tried = false;
+            bool ok = false;
+            std::shared_ptr<ThreadData> data;
+
+            ~ThreadCounters()
+            {
+#ifdef __linux__
+                for (int fd : fds)
+                {
+                    if (fd >= 0)
+                    {
+                        close(fd);
+                    }
+                }
+#endif
+            }
+        };
+
+        thread_local ThreadCounters threadCounters;
+
+#ifdef __linux__
+        long perfEventOpen(perf_event_attr *attr, pid_t pid, int cpu, int groupFd, unsigned long flags)
+        {
+            return syscall(SYS_perf_event_open, attr, pid, cpu, groupFd, flags);
+        }
+
+        std::string describeError(int error)
+        {
+            if (error == EACCES || error == EPERM)
+            {
+                return "perf_event_open: permission denied, lower /proc/sys/kernel/perf_event_paranoid or grant CAP_PERFMON";
+            }
+            if (error == ENOENT || error == EOPNOTSUPP || error == ENODEV)
+            {
+                return "perf_event_open: hardware events are not supported on this machine (e.g. a virtual machine without PMU)";
+            }
+            if (error == ENOSYS)
+            {
+                return "perf_event_open: the system call is not available";
+            }
+            return std::string("perf_event_open: ") + std::strerror(error);
+        }
+
+        // Open the group {cycles, instructions, LLC misses, branch misses} for the current thread on any CPU
+        bool openCounters(ThreadCounters &counters)
+        {
+            const std::array<uint64_t, 4> configs = {
+                PERF_COUNT_HW_CPU_CYCLES,
+                PERF_COUNT_HW_INSTRUCTIONS,
+                PERF_COUNT_HW_CACHE_MISSES,
+                PERF_COUNT_HW_BRANCH_MISSES,
+            };
+
+            for (size_t i = 0; i < configs.size(); ++i)
+            {
+                perf_event_attr attr;
+                std::memset(&attr, 0, sizeof(attr));
+                attr.size = sizeof(attr);
+                attr.type = PERF_TYPE_HARDWARE;
+                attr.config = configs[i];
+                attr.exclude_kernel = 1;
+                attr.exclude_hv = 1;
+                attr.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+                int groupFd = i == 0 ? -1 : counters.fds[0];
+                long fd = perfEventOpen(&attr, 0, -1, groupFd, 0);
+                if (fd < 0)
+                {
+                    setError(describeError(errno));
+                    for (int &openFd : counters.fds)
+                    {
+                        if (openFd >= 0)
+                        {
+                            close(openFd);
+                            openFd = -1;
+                        }
+                    }
+                    return false;
+                }
+                counters.fds[i] = static_cast<int>(fd);
+            }
+
+            return true;
+        }
+
+        // Read the scaled values of the group
+        bool readCounters(int groupFd, std::array<uint64_t, 4> &values)
+        {
+            struct
+            {
+                uint64_t nr;
+                uint64_t timeEnabled;
+                uint64_t timeRunning;
+                uint64_t values[4];
+            } buffer;
+
+            if (read(groupFd, &buffer, sizeof(buffer)) != static_cast<ssize_t>(sizeof(buffer)))
+            {
+                return false;
+            }
+
+            // Scale the values if the kernel multiplexed the group
+            double scale = 1.0;
+            if (buffer.timeRunning > 0 && buffer.timeRunning < buffer.timeEnabled)
+            {
+                scale = static_cast<double>(buffer.timeEnabled) / buffer.timeRunning;
+            }
+            for (size_t i = 0; i < values.size(); ++i)
+            {
+                values[i] = static_cast<uint64_t>(buffer.values[i] * scale);
+            }
+            return true;
+        }
+#endif
+
+        // Get the counters of the current thread, open and register them on the first call
+        ThreadCounters *currentCounters()
+        {
+            ThreadCounters &counters = threadCounters;
+            if (!counters.tried)
+            {
+                counters.tried = true;
+#ifdef __linux__
+                counters.ok = openCounters(counters);
+#else
+                setError("perf_event_open is only available on Linux");
+#endif
+                if (counters.ok)
+                {
+                    counters.data = std::make_shared<ThreadData>();
+#ifdef __linux__
+                    counters.data->report.tid = syscall(SYS_gettid);
+#endif
+                    std::lock_guard<std::mutex> lock(registryMutex);
+                    counters.data->report.threadIndex = registry.size();
+                    registry.push_back(counters.data);
+                }
+            }
+            return counters.ok ? &counters : nullptr;
+        }
+    } // namespace
+
+    const char *stageName(Stage stage)
+    {
+        switch (stage)
+        {
+        case Stage::Sort:
+            return "sort";
+        case Stage::RC:
+            return "rc";
+        case Stage::Absorb:
+            return "absorb";
+        case Stage::Eliminate:
+            return "eliminate";
+        case Stage::Decompose:
+            return "decompose";
+        case Stage::Eval:
+            return "eval";
+        default:
+            return "unknown";
+        }
+    }
+
+    Counters &Counters::operator+=(const Counters &other)
+    {
+        cycles += other.cycles;
+        instructions += other.instructions;
+        llcMisses += other.llcMisses;
+        branchMisses += other.branchMisses;
+        calls += other.calls;
+        return *this;
+    }
+
+    bool isAvailable()
+    {
+        return currentCounters() != nullptr;
+    }
+
+    std::string unavailableReason()
+    {
+        if (isAvailable())
+        {
+            return "";
+        }
+        std::lock_guard<std::mutex> lock(registryMutex);
+        return lastError;
+    }
+
+    bool enable()
+    {
+        // Keep the mode off if the counters can not be opened, so the stages do not retry on every call
+        if (!isAvailable())
+        {
+            return false;
+        }
+        enabled.store(true, std::memory_order_relaxed);
+        return true;
+    }
+
+    void disable()
+    {
+        enabled.store(false, std::memory_order_relaxed);
+    }
+
+    void reset()
+    {
+        std::lock_guard<std::mutex> lock(registryMutex);
+        for (auto &data : registry)
+        {
+            std::lock_guard<std::mutex> dataLock(data->mutex);
+            data->report.stages = {};
+        }
+    }
+
+    std::vector<ThreadReport> report()
+    {
+        std::vector<ThreadReport> reports;
+        std::lock_guard<std::mutex> lock(registryMutex);
+        for (auto &data : registry)
+        {
+            std::lock_guard<std::mutex> dataLock(data->mutex);
+
+            // Skip the threads without any measurement
+            bool measured = false;
+            for (const auto &counters : data->report.stages)
+            {
+                measured = measured || counters.calls > 0;
+            }
+            if (measured)
+            {
+                reports.push_back(data->report);
+            }
+        }
+        return reports;
+    }
+
+    std::array<Counters, NUM_STAGES> summary()
+    {
+        std::array<Counters, NUM_STAGES> stages{};
+        for (const auto &threadReport : report())
+        {
+            for (size_t s = 0; s < NUM_STAGES; ++s)
+            {
+                stages[s] += threadReport.stages[s];
+            }
+        }
+        return stages;
+    }
+
+    void ScopedCounters::begin()
+    {
+#ifdef __linux__
+        ThreadCounters *counters = currentCounters();
+        active = counters && readCounters(counters->fds[0], start);
+#endif
+    }
+
+    void ScopedCounters::end()
+    {
+#ifdef __linux__
+        ThreadCounters &counters = threadCounters;
+        std::array<uint64_t, 4> stop;
+        if (!readCounters(counters.fds[0], stop))
+        {
+            return;
+        }
+
+        // The scaled values of a multiplexed group may decrease slightly, clamp the difference at zero
+        auto diff = [&](size_t i) { return stop[i] > start[i] ? stop[i] - start[i] : 0; };
+
+        // Add the difference to the stage of the current thread
+        std::lock_guard<std::mutex> lock(counters.data->mutex);
+        Counters &stageCounters = counters.data->report.stages[static_cast<size_t>(stage)];
+        stageCounters.cycles += diff(0);
+        stageCounters.instructions += diff(1);
+        stageCounters.llcMisses += diff(2);
+        stageCounters.branchMisses += diff(3);
+        stageCounters.calls += 1;
+#endif
+    }
+
+} // namespace pyrbdpp::perf
\ No newline at end of file
@@ -0,0 +1,123 @@
+#include <pyrbd_plusplus/pipeline.hpp>
+#include <pyrbd_plusplus/enumeration.hpp>
+#include <thread>
+#include <omp.h>
+
+namespace pyrbdpp::pipeline
+{
+    // Sets of a pair on their way from the enumeration to the evaluation
+    struct PairItem
+    {
+        size_t index = 0;
+        std::vector<Set> pathSets;
+        std::vector<Set> minCutSets;
+    };
+
+    std::vector<AvailTriple> evalAvailTopo(const Graph &graph, const NodePairs &nodePairs, const ProbabilityMap &probaMap,
+                                           Engine engine, size_t capacity, size_t order, bool parallel,
+                                           std::vector<stats::PairStats> *statsList, PipelineInfo *info)
+    {
+        std::vector<AvailTriple> availList(nodePairs.size());
+
+        // Prepare one stats record per pair if requested
+        if (statsList)
+        {
+            statsList->assign(nodePairs.size(), {});
+        }
+
+        BoundedQueue<PairItem> queue(capacity);
+        std::atomic<size_t> nextPair{0};
+        std::atomic<size_t> evaluated{0};
+        std::atomic<size_t> pending{0};
+        std::atomic<size_t> peakPending{0};
+        std::atomic<size_t> fullWaits{0};
+
+        // Evaluate a pair and free its sets
+        auto consume = [&](PairItem &item)
+        {
+            pending.fetch_sub(1, std::memory_order_relaxed);
+            const auto &[src, dst] = nodePairs[item.index];
+            stats::PairStats *pairStats = statsList ? &(*statsList)[item.index] : nullptr;
+
+            // Disconnected pairs are never available
+            double availability = 0.0;
+            if (!item.pathSets.empty())
+            {
+                availability = selector::evalAvailWith(engine, src, dst, probaMap, item.pathSets, item.minCutSets, pairStats);
+            }
+            availList[item.index] = std::make_tuple(src, dst, availability);
+
+            item = PairItem{};
+            evaluated.fetch_add(1, std::memory_order_release);
+        };
+
+        // Enumerate the sets of a pair
+        auto produce = [&](size_t index)
+        {
+            const auto &[src, dst] = nodePairs[index];
+            PairItem item;
+            item.index = index;
+            item.pathSets = enumeration::minimalPaths(graph, src, dst);
+            if (engine == Engine::MCS && !item.pathSets.empty())
+            {
+                item.minCutSets = enumeration::minimalCuts(item.pathSets, src, dst, order);
+            }
+            return item;
+        };
+
+        #pragma omp parallel if (parallel)
+        {
+            PairItem item;
+            while (evaluated.load(std::memory_order_acquire) < nodePairs.size())
+            {
+                // Drain the queue first, evaluation frees memory
+                if (queue.tryPop(item))
+                {
+                    consume(item);
+                    continue;
+                }
+
+                size_t index = nextPair.fetch_add(1, std::memory_order_relaxed);
+                if (index >= nodePairs.size())
+                {
+                    // Nothing left to produce, wait for the pairs in progress of the other threads
+                    std::this_thread::yield();
+                    continue;
+                }
+
+                PairItem produced = produce(index);
+
+                // Record the peak number of enumerated pairs waiting for the evaluation
+                size_t depth = pending.fetch_add(1, std::memory_order_relaxed) + 1;
+                size_t peak = peakPending.load(std::memory_order_relaxed);
+                while (depth > peak && !peakPending.compare_exchange_weak(peak, depth, std::memory_order_relaxed))
+                {
+                }
+
+                // The queue is full, help the consumers until the pair fits
+                while (!queue.tryPush(produced))
+                {
+                    fullWaits.fetch_add(1, std::memory_order_relaxed);
+                    if (queue.tryPop(item))
+                    {
+                        consume(item);
+                    }
+                    else
+                    {
+                        std::this_thread::yield();
+                    }
+                }
+            }
+        }
+
+        if (info)
+        {
+            info->capacity = queue.capacity();
+            info->peakPending = peakPending.load();
+            info->fullWaits = fullWaits.load();
+        }
+
+        return availList;
+    }
+
+} // namespace pyrbdpp::pipeline
\ No newline at end of file
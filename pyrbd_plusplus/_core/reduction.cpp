@@ -0,0 +1,203 @@
+#include <pyrbd_plusplus/reduction.hpp>
+#include <pyrbd_plusplus/enumeration.hpp>
+#include <omp.h>
+
+namespace pyrbdpp::reduction
+{
+    ReducedPair reducePair(const Graph &graph, NodeID src, NodeID dst, const ProbabilityMap &probaMap)
+    {
+        int numNodes = graph.size();
+        std::vector<Set> adjacency(numNodes + 1);
+        std::vector<double> avail(numNodes + 1, 0.0);
+        std::vector<Set> members(numNodes + 1);
+        std::vector<char> alive(numNodes + 1, 0);
+
+        // Keep the component of src only
+        Set stack{src};
+        alive[src] = 1;
+        while (!stack.empty())
+        {
+            NodeID node = stack.back();
+            stack.pop_back();
+            for (const NodeID *it = graph.begin(node); it != graph.end(node); ++it)
+            {
+                if (!alive[*it])
+                {
+                    alive[*it] = 1;
+                    stack.push_back(*it);
+                }
+            }
+        }
+        for (NodeID node = 1; node <= numNodes; ++node)
+        {
+            if (alive[node])
+            {
+                adjacency[node].assign(graph.begin(node), graph.end(node));
+                avail[node] = probaMap[node];
+                members[node] = {node};
+            }
+        }
+
+        auto isTerminal = [src, dst](NodeID node)
+        { return node == src || node == dst; };
+        auto contains = [](const Set &set, NodeID node)
+        { return std::find(set.begin(), set.end(), node) != set.end(); };
+        auto replace = [](Set &set, NodeID from, NodeID to)
+        { *std::find(set.begin(), set.end(), from) = to; };
+        auto removeNode = [&](NodeID node)
+        {
+            for (NodeID neighbor : adjacency[node])
+            {
+                auto &list = adjacency[neighbor];
+                list.erase(std::find(list.begin(), list.end(), node));
+            }
+            adjacency[node].clear();
+            alive[node] = 0;
+        };
+        auto fold = [&](NodeID into, NodeID node)
+        {
+            members[into].insert(members[into].end(), members[node].begin(), members[node].end());
+            members[node].clear();
+        };
+
+        bool changed = alive[dst];
+        while (changed)
+        {
+            changed = false;
+
+            // Dangling, shortcut and series rules
+            for (NodeID node = 1; node <= numNodes; ++node)
+            {
+                if (!alive[node] || isTerminal(node))
+                {
+                    continue;
+                }
+                if (adjacency[node].size() <= 1)
+                {
+                    removeNode(node);
+                    changed = true;
+                    continue;
+                }
+                if (adjacency[node].size() != 2)
+                {
+                    continue;
+                }
+
+                NodeID a = adjacency[node][0];
+                NodeID b = adjacency[node][1];
+                if (contains(adjacency[a], b))
+                {
+                    removeNode(node);
+                    changed = true;
+                    continue;
+                }
+
+                // Fold the node into a neighbor of the same chain, the neighbor takes its place between a and b
+                NodeID into = !isTerminal(a) && adjacency[a].size() == 2 ? a : !isTerminal(b) && adjacency[b].size() == 2 ? b : 0;
+                if (into)
+                {
+                    NodeID other = into == a ? b : a;
+                    avail[into] *= avail[node];
+                    fold(into, node);
+                    replace(adjacency[into], node, other);
+                    replace(adjacency[other], node, into);
+                    adjacency[node].clear();
+                    alive[node] = 0;
+                    changed = true;
+                }
+            }
+
+            // Parallel rule, the nodes are grouped by their sorted neighbors
+            std::map<Set, NodeID> twinOf;
+            for (NodeID node = 1; node <= numNodes; ++node)
+            {
+                if (!alive[node] || isTerminal(node))
+                {
+                    continue;
+                }
+                Set key = adjacency[node];
+                std::sort(key.begin(), key.end());
+                auto [it, inserted] = twinOf.emplace(std::move(key), node);
+                if (!inserted)
+                {
+                    NodeID twin = it->second;
+                    avail[twin] = 1.0 - (1.0 - avail[twin]) * (1.0 - avail[node]);
+                    fold(twin, node);
+                    removeNode(node);
+                    changed = true;
+                }
+            }
+        }
+
+        // Relabel the remaining nodes to 1..k in the original order
+        std::vector<NodeID> reducedID(numNodes + 1, 0);
+        ReducedPair reduced;
+        reduced.members.emplace_back();
+        for (NodeID node = 1; node <= numNodes; ++node)
+        {
+            if (alive[node])
+            {
+                reducedID[node] = static_cast<NodeID>(reduced.members.size());
+                reduced.availability[reducedID[node]] = avail[node];
+                reduced.members.push_back(std::move(members[node]));
+            }
+        }
+
+        std::vector<Set> reducedAdjacency(reduced.members.size());
+        for (NodeID node = 1; node <= numNodes; ++node)
+        {
+            for (NodeID neighbor : adjacency[node])
+            {
+                reducedAdjacency[reducedID[node]].push_back(reducedID[neighbor]);
+            }
+        }
+        reduced.graph = Graph(reducedAdjacency);
+        reduced.src = reducedID[src];
+        reduced.dst = reducedID[dst];
+
+        return reduced;
+    }
+
+    std::vector<AvailTriple> evalAvailTopo(const Graph &graph, const NodePairs &nodePairs, const ProbabilityMap &probaMap,
+                                           Engine engine, bool parallel, ReductionInfo *info)
+    {
+        std::vector<AvailTriple> availList(nodePairs.size());
+        size_t reducedNodes = 0;
+        size_t numPathSets = 0;
+
+        #pragma omp parallel for schedule(dynamic) reduction(+ : reducedNodes, numPathSets) if (parallel)
+        for (size_t i = 0; i < nodePairs.size(); ++i)
+        {
+            const auto &[src, dst] = nodePairs[i];
+            ReducedPair reduced = reducePair(graph, src, dst, probaMap);
+            reducedNodes += reduced.graph.size();
+
+            // Disconnected pairs are never available
+            double availability = 0.0;
+            if (reduced.dst)
+            {
+                ProbabilityMap reducedMap(reduced.availability);
+                enumeration::PathSets pathSets = enumeration::minimalPaths(reduced.graph, reduced.src, reduced.dst);
+                numPathSets += pathSets.size();
+
+                enumeration::MinCutSets minCutSets;
+                if (engine == Engine::MCS)
+                {
+                    minCutSets = enumeration::minimalCuts(pathSets, reduced.src, reduced.dst, enumeration::cutOrder(reduced.graph.size()));
+                }
+                availability = selector::evalAvailWith(engine, reduced.src, reduced.dst, reducedMap, pathSets, minCutSets);
+            }
+            availList[i] = std::make_tuple(src, dst, availability);
+        }
+
+        if (info)
+        {
+            info->originalNodes = nodePairs.size() * graph.size();
+            info->reducedNodes = reducedNodes;
+            info->pathSets = numPathSets;
+        }
+
+        return availList;
+    }
+
+} // namespace pyrbdpp::reduction
\ No newline at end of file
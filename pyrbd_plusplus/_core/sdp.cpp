@@ -1,5 +1,7 @@
 #include <pyrbd_plusplus/sdp.hpp>
 #include <pyrbd_plusplus/utils.hpp>
+#include <pyrbd_plusplus/stats.hpp>
+#include <pyrbd_plusplus/perf.hpp>
 #include <numeric>
 #include <chrono>
 #include <mutex>
@@ -9,6 +11,7 @@
 #include <iostream>
 #include <fstream>
 #include <set>
+#include <omp.h>
 
 #define DEBUG_OUTPUT 0
 
@@ -28,6 +31,10 @@ namespace pyrbdpp::sdp
 
     SDPSets eliminateSDPSet(SDPSets &sdpSets)
     {   
+        // Measure the elimination time and the hardware counters if enabled
+        stats::ScopedTimer timer(&stats::PairStats::eliminateTime);
+        perf::ScopedCounters counters(perf::Stage::Eliminate);
+
         DEBUG_COUT << "Eliminating SDP sets: " << toString(sdpSets) << std::endl;
 
         // Sort the sdp sets, non-complementary sets first, then complementary sets
@@ -78,6 +85,10 @@ namespace pyrbdpp::sdp
 
     SDPSets absorbSDPSet(SDPSets sdpSets)
     {   
+        // Measure the absorption time and the hardware counters if enabled
+        stats::ScopedTimer timer(&stats::PairStats::absorbTime);
+        perf::ScopedCounters counters(perf::Stage::Absorb);
+
         // Initialize a vector to store the absorbed SDPs and reserve space for it
         SDPSets absorbedSDPs;
         absorbedSDPs.reserve(sdpSets.size());        
@@ -126,6 +137,10 @@ namespace pyrbdpp::sdp
 
     std::vector<SDPSets> decomposeSDPSet(SDPSets sdpSets)
     {   
+        // Measure the decomposition time and the hardware counters if enabled
+        stats::ScopedTimer timer(&stats::PairStats::decomposeTime);
+        perf::ScopedCounters counters(perf::Stage::Decompose);
+
         // Vector to store the results of the decomposition
         std::vector<SDPSets> results;
 
@@ -257,9 +272,14 @@ namespace pyrbdpp::sdp
             DEBUG_COUT << "Absorbed Decomposed1: " << toString(decomposed1) << std::endl;
             DEBUG_COUT << "Absorbed Decomposed2: " << toString(decomposed2) << std::endl;
 
+            // Count the decomposition and the memory of the two new SDP sets
+            stats::add(&stats::PairStats::decompositions, 1);
+            stats::add(&stats::PairStats::bytesAllocated, stats::bytesOf(decomposed1) + stats::bytesOf(decomposed2));
+
             // Add it to the queue for further decomposition
             queue.push(std::move(decomposed1));
             queue.push(std::move(decomposed2));
+            stats::raise(&stats::PairStats::queueHighWater, queue.size());
         
         }
         
@@ -269,6 +289,10 @@ namespace pyrbdpp::sdp
 
     PathSets sortPathSet(PathSets pathSets)
     {   
+        // Measure the sorting time and the hardware counters if enabled
+        stats::ScopedTimer timer(&stats::PairStats::sortTime);
+        perf::ScopedCounters counters(perf::Stage::Sort);
+
         // If the pathSets is empty, return an empty vector
         if (pathSets.empty())
         {
@@ -400,23 +424,30 @@ namespace pyrbdpp::sdp
             DEBUG_COUT << "Current resultSDPs: " << toString(resultSDPs) << std::endl;
 
             // Iterate over the previous sets in sortedPathSet
-            for (size_t j = 0; j < i; ++j)
-            {   
-                // Create the RC set: elements in precedingSet but not in currentSet
-                std::vector<int> RC;
-                const auto &precedingSet = sortedPathSet[j]; 
-                // DEBUG
-                DEBUG_COUT << "Comparing with preceding set: " << toString(precedingSet) << std::endl;
-                std::set_difference(precedingSet.begin(), precedingSet.end(),
-                                    currentSet.begin(), currentSet.end(),
-                                    std::back_inserter(RC));
-                if (!RC.empty())
+            {
+                // Measure the RC generation time and the hardware counters if enabled
+                stats::ScopedTimer timer(&stats::PairStats::rcTime);
+                perf::ScopedCounters counters(perf::Stage::RC);
+
+                for (size_t j = 0; j < i; ++j)
                 {   
+                    // Create the RC set: elements in precedingSet but not in currentSet
+                    std::vector<int> RC;
+                    const auto &precedingSet = sortedPathSet[j]; 
                     // DEBUG
-                    DEBUG_COUT << "Adding RC set: " << toString(RC) << std::endl;
-                    resultSDPs.emplace_back(true, std::move(RC));
+                    DEBUG_COUT << "Comparing with preceding set: " << toString(precedingSet) << std::endl;
+                    std::set_difference(precedingSet.begin(), precedingSet.end(),
+                                        currentSet.begin(), currentSet.end(),
+                                        std::back_inserter(RC));
+                    if (!RC.empty())
+                    {   
+                        // DEBUG
+                        DEBUG_COUT << "Adding RC set: " << toString(RC) << std::endl;
+                        resultSDPs.emplace_back(true, std::move(RC));
+                    }
                 }
             }
+            stats::add(&stats::PairStats::bytesAllocated, stats::bytesOf(resultSDPs));
 
             // Absorb the resultSDPs to remove any redundant sets
             resultSDPs = absorbSDPSet(std::move(resultSDPs));
@@ -447,9 +478,59 @@ namespace pyrbdpp::sdp
             }
         }
 
+        stats::add(&stats::PairStats::terms, finalSDPs.size());
+
         return finalSDPs;
     }
 
+    std::vector<SDPSets> pathSetToSDPSet(const PathSets &sortedPathSet, size_t i)
+    {
+        // The first set is not complementary to any other set
+        const auto &currentSet = sortedPathSet[i];
+        if (i == 0)
+        {
+            return {{{false, currentSet}}};
+        }
+
+        // Initialize the result SDPs with the current set as a non-complementary SDP
+        SDPSets resultSDPs;
+        resultSDPs.emplace_back(false, currentSet);
+
+        // Iterate over the previous sets in sortedPathSet
+        {
+            // Measure the RC generation time and the hardware counters if enabled
+            stats::ScopedTimer timer(&stats::PairStats::rcTime);
+            perf::ScopedCounters counters(perf::Stage::RC);
+
+            for (size_t j = 0; j < i; ++j)
+            {   
+                // Create the RC set: elements in precedingSet but not in currentSet
+                std::vector<int> RC;
+                const auto &precedingSet = sortedPathSet[j];
+                std::set_difference(precedingSet.begin(), precedingSet.end(),
+                                    currentSet.begin(), currentSet.end(),
+                                    std::back_inserter(RC));
+                if (!RC.empty())
+                {
+                    resultSDPs.emplace_back(true, std::move(RC));
+                }
+            }
+        }
+        stats::add(&stats::PairStats::bytesAllocated, stats::bytesOf(resultSDPs));
+
+        // Absorb the resultSDPs to remove any redundant sets
+        resultSDPs = absorbSDPSet(std::move(resultSDPs));
+
+        // Decompose the resultSDPs if it has common elements
+        if (hasCommonElement(resultSDPs))
+        {
+            return decomposeSDPSet(std::move(resultSDPs));
+        }
+
+        // If there are no common elements, the resultSDPs is already a single disjoint term
+        return {std::move(resultSDPs)};
+    }
+
     std::vector<SDPSets> toSDPSetParallel(NodeID src, NodeID dst, PathSets pathSets)
     {   
         // Check if the pathSets size is less than 200
@@ -471,44 +552,26 @@ namespace pyrbdpp::sdp
         // Initialize the first thread result with the non-complementary first set in the sorted pathSet
         threadResults[0] = {{{false, sortedPathSet.front()}}};
 
-        // Iterate over the sorted pathSet starting from the second set
-        #pragma omp parallel for schedule(dynamic)
-        for (size_t i = 1; i < sortedPathSet.size(); ++i)
-        {   
-            // Save the result for the current SDP
-            SDPSets resultSDPs;
-
-            // Initialize the result SDPs with the current set as a non-complementary SDP
-            const auto &currentSet = sortedPathSet[i];
-            resultSDPs.emplace_back(false, currentSet);
+        // The stats are thread local, so every thread collects its own stats and merges them at the end
+        stats::PairStats *parentStats = stats::current();
 
-            // Iterate over the previous sets in sortedPathSet
-            for (size_t j = 0; j < i; ++j)
-            {   
-                // Create the RC set: elements in precedingSet but not in currentSet
-                std::vector<int> RC;
-                const auto &precedingSet = sortedPathSet[j];
-                std::set_difference(precedingSet.begin(), precedingSet.end(),
-                                    currentSet.begin(), currentSet.end(),
-                                    std::back_inserter(RC));
-                if (!RC.empty())
-                {
-                    resultSDPs.emplace_back(true, std::move(RC));
-                }
-            }
-
-            // Absorb the resultSDPs to remove any redundant sets
-            resultSDPs = absorbSDPSet(std::move(resultSDPs));
+        #pragma omp parallel
+        {
+            stats::PairStats threadStats;
+            stats::Scope scope(parentStats ? &threadStats : nullptr);
 
-            // Decompose the resultSDPs if it has common elements
-            if (hasCommonElement(resultSDPs))
+            // Iterate over the sorted pathSet starting from the second set
+            #pragma omp for schedule(dynamic)
+            for (size_t i = 1; i < sortedPathSet.size(); ++i)
             {
-                threadResults[i] = decomposeSDPSet(std::move(resultSDPs));
+                threadResults[i] = pathSetToSDPSet(sortedPathSet, i);
             }
-            else
+
+            // Merge the stats of the thread into the stats of the pair
+            if (parentStats)
             {
-                // If there are no common elements, just add the resultSDPs to the threadResults
-                threadResults[i] = {std::move(resultSDPs)};
+                #pragma omp critical
+                stats::merge(*parentStats, threadStats);
             }
         }
 
@@ -519,11 +582,17 @@ namespace pyrbdpp::sdp
             std::move(threadResult.begin(), threadResult.end(), std::back_inserter(finalSDPs));
         }
 
+        stats::add(&stats::PairStats::terms, finalSDPs.size());
+
         return finalSDPs;
     }
 
     double SDPSetToAvail(const ProbabilityMap &probaMap, const std::vector<SDPSets> &sdpSets)
     {
+        // Measure the evaluation time and the hardware counters if enabled
+        stats::ScopedTimer timer(&stats::PairStats::evalTime);
+        perf::ScopedCounters counters(perf::Stage::Eval);
+
         double availability = 0.0;
 
         // Iterate over each set in the SDP set
@@ -564,8 +633,16 @@ namespace pyrbdpp::sdp
         return availability;
     }
 
-    double evalAvail(NodeID src, NodeID dst, const ProbabilityMap &probaMap, PathSets &pathSets)
+    double evalAvail(NodeID src, NodeID dst, const ProbabilityMap &probaMap, PathSets &pathSets, stats::PairStats *pairStats)
     {
+        // Collect the stats of the pair if requested
+        stats::Scope scope(pairStats);
+        if (pairStats)
+        {
+            pairStats->src = src;
+            pairStats->dst = dst;
+        }
+
         // Convert the pathSets to the SDP set
         std::vector<SDPSets> SDPs = toSDPSet(src, dst, pathSets);
 
@@ -575,8 +652,16 @@ namespace pyrbdpp::sdp
         return availability;
     }
 
-    double evalAvailParallel(NodeID src, NodeID dst, const ProbabilityMap &probaMap, PathSets &pathSets)
+    double evalAvailParallel(NodeID src, NodeID dst, const ProbabilityMap &probaMap, PathSets &pathSets, stats::PairStats *pairStats)
     {
+        // Collect the stats of the pair if requested
+        stats::Scope scope(pairStats);
+        if (pairStats)
+        {
+            pairStats->src = src;
+            pairStats->dst = dst;
+        }
+
         // Convert the pathSets to the SDP set
         std::vector<SDPSets> SDPs = toSDPSetParallel(src, dst, pathSets);
 
@@ -586,37 +671,233 @@ namespace pyrbdpp::sdp
         return availability;
     }
 
-    std::vector<AvailTriple> evalAvailTopo(const NodePairs &nodePairs, const ProbabilityMap &probaMap, std::vector<PathSets> &pathsetsList)
+    std::vector<AvailTriple> evalAvailTopo(const NodePairs &nodePairs, const ProbabilityMap &probaMap, std::vector<PathSets> &pathsetsList,
+                                           std::vector<stats::PairStats> *statsList)
     {
         std::vector<AvailTriple> availList;
 
+        // Prepare one stats record per pair if requested
+        if (statsList)
+        {
+            statsList->assign(nodePairs.size(), {});
+        }
+
         for (size_t i = 0; i < nodePairs.size(); ++i)
         {   
             const auto &[src, dst] = nodePairs[i];
             auto &pathSets = pathsetsList[i];
 
-            double availability = evalAvail(src, dst, probaMap, pathSets);
+            double availability = evalAvail(src, dst, probaMap, pathSets, statsList ? &(*statsList)[i] : nullptr);
             availList.emplace_back(src, dst, availability);
         }
 
         return availList;
     }
 
-    std::vector<AvailTriple> evalAvailTopoParallel(const NodePairs &nodePairs, const ProbabilityMap &probaMap, std::vector<PathSets> &pathsetsList)
+    std::vector<AvailTriple> evalAvailTopoParallel(const NodePairs &nodePairs, const ProbabilityMap &probaMap, std::vector<PathSets> &pathsetsList,
+                                                   std::vector<stats::PairStats> *statsList)
     {
         std::vector<AvailTriple> availList(nodePairs.size());
 
+        // Prepare one stats record per pair if requested
+        if (statsList)
+        {
+            statsList->assign(nodePairs.size(), {});
+        }
+
         #pragma omp parallel for schedule(dynamic)
         for (size_t i = 0; i < nodePairs.size(); ++i)
         {
             const auto &[src, dst] = nodePairs[i];
             auto &pathSets = pathsetsList[i];
 
-            double availability = evalAvail(src, dst, probaMap, pathSets);
+            double availability = evalAvail(src, dst, probaMap, pathSets, statsList ? &(*statsList)[i] : nullptr);
             availList[i] = std::make_tuple(src, dst, availability);
         }
 
         return availList;
     }
 
+    // Upper bound of the probability mass of the terms of the i-th path set:
+    // P(A_i) * prod(1 - P(RC_j)) over preceding sets j whose RC sets are pairwise disjoint, so the factors are independent.
+    // The scratch vector is indexed by node ID, bit 1 marks the nodes of the current set and bit 2 the nodes of the used RC sets.
+    static double termBound(const ProbabilityMap &probaMap, const PathSets &sortedPathSet, size_t i, std::vector<char> &scratch)
+    {
+        const auto &currentSet = sortedPathSet[i];
+        double bound = 1.0;
+        for (NodeID node : currentSet)
+        {
+            bound *= probaMap[node];
+            scratch[node] = 1;
+        }
+
+        std::vector<NodeID> used;
+        for (size_t j = 0; j < i && bound > 0.0; ++j)
+        {
+            // Skip the RC sets overlapping with an already used RC set
+            double rcProba = 1.0;
+            bool empty = true, overlaps = false;
+            for (NodeID node : sortedPathSet[j])
+            {
+                if (scratch[node] & 1)
+                {
+                    continue;
+                }
+                empty = false;
+                overlaps = overlaps || (scratch[node] & 2);
+                rcProba *= probaMap[node];
+            }
+
+            // A preceding subset absorbs the current set completely
+            if (empty)
+            {
+                bound = 0.0;
+            }
+            else if (!overlaps)
+            {
+                bound *= 1.0 - rcProba;
+                for (NodeID node : sortedPathSet[j])
+                {
+                    if (!(scratch[node] & 1))
+                    {
+                        scratch[node] |= 2;
+                        used.push_back(node);
+                    }
+                }
+            }
+        }
+
+        // Reset the scratch vector for the next call
+        for (NodeID node : currentSet)
+        {
+            scratch[node] = 0;
+        }
+        for (NodeID node : used)
+        {
+            scratch[node] = 0;
+        }
+        return bound;
+    }
+
+    // Anytime evaluation of a pair, shared by the serial, parallel and topology versions
+    static AvailBounds evalBounds(NodeID src, NodeID dst, const ProbabilityMap &probaMap, const PathSets &pathSets,
+                                  const BoundsOptions &options, const BoundsCallback &callback,
+                                  BoundsTracker::Clock::time_point deadline, bool parallel)
+    {
+        BoundsTracker tracker(src, dst, options, callback, deadline);
+
+        PathSets sortedPathSet = sortPathSet(pathSets);
+        size_t numSets = sortedPathSet.size();
+        if (numSets == 0)
+        {
+            return tracker.finish(true);
+        }
+
+        // Estimate the mass of every path set
+        NodeID maxNode = 0;
+        for (const auto &set : sortedPathSet)
+        {
+            maxNode = std::max(maxNode, *std::max_element(set.begin(), set.end()));
+        }
+        std::vector<double> estimates(numSets);
+        #pragma omp parallel if (parallel)
+        {
+            std::vector<char> scratch(maxNode + 1, 0);
+            #pragma omp for schedule(dynamic)
+            for (size_t i = 0; i < numSets; ++i)
+            {
+                estimates[i] = termBound(probaMap, sortedPathSet, i, scratch);
+            }
+        }
+
+        // Evaluate the path sets with the largest estimated mass first
+        std::vector<size_t> order(numSets);
+        std::iota(order.begin(), order.end(), 0);
+        std::stable_sort(order.begin(), order.end(), [&estimates](size_t a, size_t b)
+                         { return estimates[a] > estimates[b]; });
+
+        // remaining[k] is the estimated mass of the path sets order[k..], summed from the smallest for accuracy
+        std::vector<double> remaining(numSets + 1, 0.0);
+        for (size_t k = numSets; k-- > 0;)
+        {
+            remaining[k] = remaining[k + 1] + estimates[order[k]];
+        }
+
+        // The parallel version evaluates a batch of path sets between two checks of the stop criteria
+        size_t batch = parallel ? 4 * static_cast<size_t>(omp_get_max_threads()) : 1;
+        std::vector<double> masses(batch);
+
+        double lower = 0.0;
+        size_t k = 0;
+        bool proceed = tracker.update(lower, remaining[0], 0, numSets);
+        while (proceed && k < numSets)
+        {
+            size_t end = std::min(numSets, k + batch);
+
+            #pragma omp parallel for schedule(dynamic) if (parallel)
+            for (size_t m = k; m < end; ++m)
+            {
+                masses[m - k] = SDPSetToAvail(probaMap, pathSetToSDPSet(sortedPathSet, order[m]));
+            }
+
+            for (size_t m = k; m < end; ++m)
+            {
+                lower += masses[m - k];
+            }
+            k = end;
+
+            proceed = tracker.update(lower, remaining[k], k, numSets);
+        }
+
+        return tracker.finish(k == numSets);
+    }
+
+    AvailBounds evalAvailBounds(NodeID src, NodeID dst, const ProbabilityMap &probaMap, const PathSets &pathSets,
+                                const BoundsOptions &options, const BoundsCallback &callback)
+    {
+        return evalBounds(src, dst, probaMap, pathSets, options, callback, BoundsTracker::deadlineOf(options), false);
+    }
+
+    AvailBounds evalAvailBoundsParallel(NodeID src, NodeID dst, const ProbabilityMap &probaMap, const PathSets &pathSets,
+                                        const BoundsOptions &options, const BoundsCallback &callback)
+    {
+        return evalBounds(src, dst, probaMap, pathSets, options, callback, BoundsTracker::deadlineOf(options), true);
+    }
+
+    std::vector<AvailBounds> evalAvailBoundsTopo(const NodePairs &nodePairs, const ProbabilityMap &probaMap,
+                                                 const std::vector<PathSets> &pathsetsList, const BoundsOptions &options)
+    {
+        std::vector<AvailBounds> boundsList;
+        boundsList.reserve(nodePairs.size());
+
+        // The deadline is shared by all pairs
+        auto deadline = BoundsTracker::deadlineOf(options);
+
+        for (size_t i = 0; i < nodePairs.size(); ++i)
+        {
+            const auto &[src, dst] = nodePairs[i];
+            boundsList.push_back(evalBounds(src, dst, probaMap, pathsetsList[i], options, {}, deadline, false));
+        }
+
+        return boundsList;
+    }
+
+    std::vector<AvailBounds> evalAvailBoundsTopoParallel(const NodePairs &nodePairs, const ProbabilityMap &probaMap,
+                                                         const std::vector<PathSets> &pathsetsList, const BoundsOptions &options)
+    {
+        std::vector<AvailBounds> boundsList(nodePairs.size());
+
+        // The deadline is shared by all pairs
+        auto deadline = BoundsTracker::deadlineOf(options);
+
+        #pragma omp parallel for schedule(dynamic)
+        for (size_t i = 0; i < nodePairs.size(); ++i)
+        {
+            const auto &[src, dst] = nodePairs[i];
+            boundsList[i] = evalBounds(src, dst, probaMap, pathsetsList[i], options, {}, deadline, false);
+        }
+
+        return boundsList;
+    }
+
 } // namespace pyrbdpp::sdp
\ No newline at end of file
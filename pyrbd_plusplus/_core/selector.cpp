@@ -0,0 +1,411 @@
+#include <pyrbd_plusplus/selector.hpp>
+#include <pyrbd_plusplus/enumeration.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <unordered_set>
+#include <omp.h>
+
+namespace pyrbdpp::selector
+{
+    // The minimal cut sets of a pair, or no cut sets if the list is not given
+    static const MinCutSets &cutSetsAt(const std::vector<MinCutSets> &minCutSetsList, size_t i)
+    {
+        static const MinCutSets noCutSets;
+        return minCutSetsList.empty() ? noCutSets : minCutSetsList[i];
+    }
+
+    SetStats computeSetStats(const std::vector<Set> &sets)
+    {
+        SetStats stats;
+        stats.count = sets.size();
+
+        // Check if the sets are empty
+        if (sets.empty())
+        {
+            return stats;
+        }
+
+        size_t totalWidth = 0;
+        for (const auto &set : sets)
+        {
+            totalWidth += set.size();
+            stats.maxWidth = std::max(stats.maxWidth, set.size());
+        }
+        stats.avgWidth = static_cast<double>(totalWidth) / sets.size();
+
+        return stats;
+    }
+
+    // Predicted cost of MCS from the statistics of the minimal cut sets
+    static double mcsCost(const CostModel &model, const SetStats &cutStats)
+    {
+        // The sets {src} and {dst} are removed by mcs::toProbaSet(), so they are not counted
+        double C = static_cast<double>(cutStats.count > 2 ? cutStats.count - 2 : 0);
+        double wc = cutStats.avgWidth;
+
+        return model.mcsOverhead + model.mcsCoeff * C * C * C * wc;
+    }
+
+    CostEstimate estimateCost(const CostModel &model, const PathSets &pathSets, const MinCutSets &minCutSets)
+    {
+        CostEstimate estimate;
+
+        // Both path set engines share the same input statistics
+        SetStats pathStats = computeSetStats(pathSets);
+        double P = static_cast<double>(pathStats.count);
+        double w = pathStats.avgWidth;
+
+        estimate.sdp = model.sdpOverhead + model.sdpCoeff * P * P * w;
+        estimate.pathset = model.pathsetOverhead + model.pathsetCoeff * P * P * w * w;
+
+        // MCS is only possible if the cut sets are given
+        if (minCutSets.empty())
+        {
+            estimate.mcs = std::numeric_limits<double>::infinity();
+            return estimate;
+        }
+
+        estimate.mcs = mcsCost(model, computeSetStats(minCutSets));
+
+        return estimate;
+    }
+
+    SetStats estimateCutStats(NodeID src, NodeID dst, const PathSets &pathSets)
+    {
+        SetStats stats;
+        if (pathSets.empty())
+        {
+            return stats;
+        }
+
+        // Shortest path sets first
+        std::vector<size_t> order(pathSets.size());
+        std::iota(order.begin(), order.end(), 0);
+        std::stable_sort(order.begin(), order.end(), [&pathSets](size_t a, size_t b)
+                         { return pathSets[a].size() < pathSets[b].size(); });
+
+        // Pick the path sets whose inner nodes are not used by a picked one
+        std::unordered_set<NodeID> used;
+        size_t picked = 0;
+        size_t longest = 0;
+        for (size_t i : order)
+        {
+            const Set &pathSet = pathSets[i];
+            bool disjoint = std::none_of(pathSet.begin(), pathSet.end(), [&](NodeID node)
+                                         { return node != src && node != dst && used.count(node); });
+            if (!disjoint)
+            {
+                continue;
+            }
+            size_t inner = 0;
+            for (NodeID node : pathSet)
+            {
+                if (node != src && node != dst)
+                {
+                    used.insert(node);
+                    ++inner;
+                }
+            }
+            longest = std::max(longest, inner);
+            ++picked;
+        }
+
+        // Same layout as the statistics of the cut sets, {src} and {dst} included
+        stats.count = longest + 2;
+        stats.maxWidth = std::max<size_t>(picked, 1);
+        stats.avgWidth = static_cast<double>(longest * picked + 2) / static_cast<double>(longest + 2);
+
+        return stats;
+    }
+
+    bool mcsCandidate(const CostModel &model, NodeID src, NodeID dst, const PathSets &pathSets)
+    {
+        if (pathSets.empty())
+        {
+            return false;
+        }
+
+        CostEstimate estimate = estimateCost(model, pathSets, {});
+        double mcs = mcsCost(model, estimateCutStats(src, dst, pathSets));
+
+        return mcs <= std::min(estimate.sdp, estimate.pathset);
+    }
+
+    Engine selectEngine(const CostModel &model, const PathSets &pathSets, const MinCutSets &minCutSets)
+    {
+        CostEstimate estimate = estimateCost(model, pathSets, minCutSets);
+
+        // Ties are resolved in favour of SDP, which has the best worst case behaviour
+        Engine engine = Engine::SDP;
+        double best = estimate.sdp;
+
+        if (estimate.pathset < best)
+        {
+            engine = Engine::PathSet;
+            best = estimate.pathset;
+        }
+        if (estimate.mcs < best)
+        {
+            engine = Engine::MCS;
+        }
+
+        return engine;
+    }
+
+    double evalAvailWith(Engine engine, NodeID src, NodeID dst, const ProbabilityMap &probaMap,
+                         const PathSets &pathSets, const MinCutSets &minCutSets, stats::PairStats *pairStats)
+    {
+        // Collect the stats of the pair if requested
+        stats::Scope scope(pairStats);
+        if (pairStats)
+        {
+            pairStats->src = src;
+            pairStats->dst = dst;
+        }
+
+        switch (engine)
+        {
+        case Engine::MCS:
+            return mcs::evalAvail(src, dst, probaMap, minCutSets);
+        case Engine::PathSet:
+            return pathset::evalAvail(src, dst, probaMap, pathSets);
+        case Engine::SDP:
+        default:
+            return sdp::SDPSetToAvail(probaMap, sdp::toSDPSet(src, dst, pathSets));
+        }
+    }
+
+    // Pick up to samples pairs where every engine is predicted within the budget, evenly spread over the predicted SDP cost
+    static std::vector<size_t> pickSamples(const std::vector<PathSets> &pathsetsList, const std::vector<CostEstimate> &estimates,
+                                           size_t samples, double budget)
+    {
+        // Save the candidates for the calibration with their predicted SDP cost
+        std::vector<std::pair<double, size_t>> candidates;
+        for (size_t i = 0; i < estimates.size(); ++i)
+        {
+            const CostEstimate &estimate = estimates[i];
+
+            // Skip the trivial pairs, they only measure the call overhead
+            if (pathsetsList[i].size() < 2)
+            {
+                continue;
+            }
+
+            // Skip the pairs where any engine is predicted to exceed the budget, MCS only runs on the pairs with cut sets
+            if (estimate.sdp > budget || estimate.pathset > budget || (std::isfinite(estimate.mcs) && estimate.mcs > budget))
+            {
+                continue;
+            }
+            candidates.emplace_back(estimate.sdp, i);
+        }
+
+        std::vector<size_t> picked;
+        if (candidates.empty() || samples == 0)
+        {
+            return picked;
+        }
+
+        std::sort(candidates.begin(), candidates.end());
+        size_t numPicked = std::min(samples, candidates.size());
+        for (size_t k = 0; k < numPicked; ++k)
+        {
+            size_t idx = numPicked == 1 ? candidates.size() - 1 : k * (candidates.size() - 1) / (numPicked - 1);
+            picked.push_back(candidates[idx].second);
+        }
+        return picked;
+    }
+
+    // Run every engine on the picked pairs and fit each coefficient as the median of measured / predicted time
+    static CostModel fitModel(const NodePairs &nodePairs, const ProbabilityMap &probaMap,
+                              const std::vector<PathSets> &pathsetsList, const std::vector<MinCutSets> &minCutSetsList,
+                              const std::vector<size_t> &picked)
+    {
+        CostModel model;
+
+        // Measure the time of a single engine run
+        auto measure = [&](Engine engine, size_t i)
+        {
+            const auto &[src, dst] = nodePairs[i];
+            const MinCutSets &minCutSets = cutSetsAt(minCutSetsList, i);
+            auto start = std::chrono::steady_clock::now();
+            volatile double avail = evalAvailWith(engine, src, dst, probaMap, pathsetsList[i], minCutSets);
+            (void)avail;
+            std::chrono::duration<double> duration = std::chrono::steady_clock::now() - start;
+            return duration.count();
+        };
+
+        // Median of the measured / predicted ratios
+        auto median = [](std::vector<double> ratios, double fallback)
+        {
+            if (ratios.empty())
+            {
+                return fallback;
+            }
+            std::nth_element(ratios.begin(), ratios.begin() + ratios.size() / 2, ratios.end());
+            return ratios[ratios.size() / 2];
+        };
+
+        std::vector<double> sdpRatios, pathsetRatios, mcsRatios;
+        for (size_t i : picked)
+        {
+            // Predicted cost without the coefficient (coefficient = 1, no overhead)
+            CostModel unit{1.0, 1.0, 1.0, 0.0, 0.0, 0.0};
+            const MinCutSets &minCutSets = cutSetsAt(minCutSetsList, i);
+            CostEstimate shape = estimateCost(unit, pathsetsList[i], minCutSets);
+
+            if (shape.sdp > 0)
+            {
+                sdpRatios.push_back(measure(Engine::SDP, i) / shape.sdp);
+            }
+            if (shape.pathset > 0)
+            {
+                pathsetRatios.push_back(measure(Engine::PathSet, i) / shape.pathset);
+            }
+            if (!minCutSets.empty() && shape.mcs > 0)
+            {
+                mcsRatios.push_back(measure(Engine::MCS, i) / shape.mcs);
+            }
+        }
+
+        model.sdpCoeff = median(sdpRatios, model.sdpCoeff);
+        model.pathsetCoeff = median(pathsetRatios, model.pathsetCoeff);
+        model.mcsCoeff = median(mcsRatios, model.mcsCoeff);
+
+        return model;
+    }
+
+    CostModel calibrate(const NodePairs &nodePairs, const ProbabilityMap &probaMap,
+                        const std::vector<PathSets> &pathsetsList, const std::vector<MinCutSets> &minCutSetsList,
+                        size_t samples, double budget)
+    {
+        CostModel model;
+
+        // Step 1: Predict the cost of every pair with the default model
+        std::vector<CostEstimate> estimates(nodePairs.size());
+        for (size_t i = 0; i < nodePairs.size(); ++i)
+        {
+            estimates[i] = estimateCost(model, pathsetsList[i], cutSetsAt(minCutSetsList, i));
+        }
+
+        // Step 2: Pick the samples and fit the coefficients on them
+        return fitModel(nodePairs, probaMap, pathsetsList, minCutSetsList, pickSamples(pathsetsList, estimates, samples, budget));
+    }
+
+    CostModel calibrateFromPaths(const NodePairs &nodePairs, const ProbabilityMap &probaMap,
+                                 const std::vector<PathSets> &pathsetsList, size_t order, size_t samples, double budget)
+    {
+        CostModel model;
+
+        // Step 1: Predict the cost of every pair with the default model, MCS from the estimated cut sets
+        std::vector<CostEstimate> estimates(nodePairs.size());
+        for (size_t i = 0; i < nodePairs.size(); ++i)
+        {
+            const auto &[src, dst] = nodePairs[i];
+            estimates[i] = estimateCost(model, pathsetsList[i], {});
+            if (!pathsetsList[i].empty())
+            {
+                estimates[i].mcs = mcsCost(model, estimateCutStats(src, dst, pathsetsList[i]));
+            }
+        }
+
+        // Step 2: Pick the samples and enumerate the cut sets of the picked pairs only
+        std::vector<size_t> picked = pickSamples(pathsetsList, estimates, samples, budget);
+        NodePairs sampledPairs;
+        std::vector<PathSets> sampledPathSets;
+        std::vector<MinCutSets> sampledCutSets;
+        for (size_t i : picked)
+        {
+            const auto &[src, dst] = nodePairs[i];
+            sampledPairs.push_back(nodePairs[i]);
+            sampledPathSets.push_back(pathsetsList[i]);
+            sampledCutSets.push_back(enumeration::minimalCuts(pathsetsList[i], src, dst, order));
+        }
+
+        // Step 3: Fit the coefficients on the samples
+        std::vector<size_t> samplesIdx(picked.size());
+        std::iota(samplesIdx.begin(), samplesIdx.end(), 0);
+        return fitModel(sampledPairs, probaMap, sampledPathSets, sampledCutSets, samplesIdx);
+    }
+
+    AutoTriple evalAvail(NodeID src, NodeID dst, const ProbabilityMap &probaMap,
+                         const PathSets &pathSets, const MinCutSets &minCutSets, const CostModel &model,
+                         stats::PairStats *pairStats)
+    {
+        Engine engine = selectEngine(model, pathSets, minCutSets);
+        double availability = evalAvailWith(engine, src, dst, probaMap, pathSets, minCutSets, pairStats);
+        return {src, dst, availability, engine};
+    }
+
+    std::vector<AutoTriple> evalAvailTopo(const NodePairs &nodePairs, const ProbabilityMap &probaMap,
+                                          const std::vector<PathSets> &pathsetsList, const std::vector<MinCutSets> &minCutSetsList,
+                                          const CostModel &model, std::vector<stats::PairStats> *statsList)
+    {
+        std::vector<AutoTriple> availList;
+        availList.reserve(nodePairs.size());
+
+        // Prepare one stats record per pair if requested
+        if (statsList)
+        {
+            statsList->assign(nodePairs.size(), {});
+        }
+
+        for (size_t i = 0; i < nodePairs.size(); ++i)
+        {
+            const auto &[src, dst] = nodePairs[i];
+            const MinCutSets &minCutSets = cutSetsAt(minCutSetsList, i);
+
+            availList.push_back(evalAvail(src, dst, probaMap, pathsetsList[i], minCutSets, model,
+                                          statsList ? &(*statsList)[i] : nullptr));
+        }
+
+        return availList;
+    }
+
+    std::vector<AutoTriple> evalAvailTopoParallel(const NodePairs &nodePairs, const ProbabilityMap &probaMap,
+                                                  const std::vector<PathSets> &pathsetsList, const std::vector<MinCutSets> &minCutSetsList,
+                                                  const CostModel &model, std::vector<stats::PairStats> *statsList)
+    {
+        std::vector<AutoTriple> availList(nodePairs.size());
+
+        // Prepare one stats record per pair if requested
+        if (statsList)
+        {
+            statsList->assign(nodePairs.size(), {});
+        }
+
+        // Select the engine of each pair and remember its predicted cost
+        std::vector<Engine> engines(nodePairs.size());
+        std::vector<double> costs(nodePairs.size());
+        for (size_t i = 0; i < nodePairs.size(); ++i)
+        {
+            const MinCutSets &minCutSets = cutSetsAt(minCutSetsList, i);
+            CostEstimate estimate = estimateCost(model, pathsetsList[i], minCutSets);
+            engines[i] = selectEngine(model, pathsetsList[i], minCutSets);
+            costs[i] = std::min({estimate.sdp, estimate.pathset, estimate.mcs});
+        }
+
+        // Schedule the most expensive pairs first
+        std::vector<size_t> order(nodePairs.size());
+        std::iota(order.begin(), order.end(), 0);
+        std::stable_sort(order.begin(), order.end(), [&costs](size_t a, size_t b)
+                         { return costs[a] > costs[b]; });
+
+        #pragma omp parallel for schedule(dynamic)
+        for (size_t k = 0; k < order.size(); ++k)
+        {
+            size_t i = order[k];
+            const auto &[src, dst] = nodePairs[i];
+            const MinCutSets &minCutSets = cutSetsAt(minCutSetsList, i);
+
+            double availability = evalAvailWith(engines[i], src, dst, probaMap, pathsetsList[i], minCutSets,
+                                                statsList ? &(*statsList)[i] : nullptr);
+            availList[i] = std::make_tuple(src, dst, availability, engines[i]);
+        }
+
+        return availList;
+    }
+
+} // namespace pyrbdpp::selector
\ No newline at end of file
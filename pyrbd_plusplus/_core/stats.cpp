@@ -0,0 +1,42 @@
+#include <pyrbd_plusplus/stats.hpp>
+#include <algorithm>
+
+namespace pyrbdpp::stats
+{
+    thread_local PairStats *activeStats = nullptr;
+
+    void merge(PairStats &into, const PairStats &other)
+    {
+        into.sortTime += other.sortTime;
+        into.rcTime += other.rcTime;
+        into.absorbTime += other.absorbTime;
+        into.eliminateTime += other.eliminateTime;
+        into.decomposeTime += other.decomposeTime;
+        into.evalTime += other.evalTime;
+
+        into.queueHighWater = std::max(into.queueHighWater, other.queueHighWater);
+        into.decompositions += other.decompositions;
+        into.terms += other.terms;
+        into.bytesAllocated += other.bytesAllocated;
+    }
+
+    Scope::Scope(PairStats *record) : previous(activeStats), record(record)
+    {
+        if (record)
+        {
+            activeStats = record;
+            start = std::chrono::steady_clock::now();
+        }
+    }
+
+    Scope::~Scope()
+    {
+        if (record)
+        {
+            std::chrono::duration<double> duration = std::chrono::steady_clock::now() - start;
+            record->totalTime += duration.count();
+            activeStats = previous;
+        }
+    }
+
+} // namespace pyrbdpp::stats
\ No newline at end of file
@@ -0,0 +1,398 @@
+#include <pyrbd_plusplus/symmetry.hpp>
+#include <pyrbd_plusplus/enumeration.hpp>
+#include <numeric>
+#include <unordered_map>
+#include <omp.h>
+
+namespace pyrbdpp::symmetry
+{
+    using PathSets = std::vector<Set>;
+    using MinCutSets = std::vector<Set>;
+    using Coloring = std::vector<int>; // color of every node, index 0 is unused
+
+    // Union-find with path halving, the root is the smallest element
+    struct UnionFind
+    {
+        std::vector<size_t> parent;
+
+        explicit UnionFind(size_t size) : parent(size) { std::iota(parent.begin(), parent.end(), 0); }
+
+        size_t find(size_t x)
+        {
+            while (parent[x] != x)
+            {
+                parent[x] = parent[parent[x]];
+                x = parent[x];
+            }
+            return x;
+        }
+
+        void unite(size_t a, size_t b)
+        {
+            a = find(a);
+            b = find(b);
+            if (a != b)
+            {
+                parent[std::max(a, b)] = std::min(a, b);
+            }
+        }
+    };
+
+    // Refine the coloring to the coarsest equitable partition, the colors are renumbered 0..k-1 in an invariant order
+    static Coloring refine(const Graph &graph, Coloring colors)
+    {
+        int numNodes = graph.size();
+        std::vector<NodeID> order(numNodes);
+        std::iota(order.begin(), order.end(), 1);
+        size_t numColors = 0;
+
+        std::vector<std::vector<int>> signatures(numNodes + 1);
+        while (true)
+        {
+            // The signature of a node is its color followed by the sorted colors of its neighbors
+            for (NodeID node = 1; node <= numNodes; ++node)
+            {
+                auto &signature = signatures[node];
+                signature.assign(1, colors[node]);
+                for (const NodeID *it = graph.begin(node); it != graph.end(node); ++it)
+                {
+                    signature.push_back(colors[*it]);
+                }
+                std::sort(signature.begin() + 1, signature.end());
+            }
+
+            std::sort(order.begin(), order.end(), [&](NodeID a, NodeID b)
+                      { return signatures[a] < signatures[b]; });
+
+            Coloring refined(numNodes + 1, 0);
+            int color = 0;
+            for (size_t k = 0; k < order.size(); ++k)
+            {
+                if (k > 0 && signatures[order[k]] != signatures[order[k - 1]])
+                {
+                    ++color;
+                }
+                refined[order[k]] = color;
+            }
+
+            // The partition only splits, so it is stable once the number of colors stops growing
+            size_t refinedColors = numNodes > 0 ? color + 1 : 0;
+            colors = std::move(refined);
+            if (refinedColors == numColors)
+            {
+                break;
+            }
+            numColors = refinedColors;
+        }
+        return colors;
+    }
+
+    // Give the node a color of its own and refine
+    static Coloring individualize(const Graph &graph, const Coloring &colors, NodeID node)
+    {
+        Coloring split(colors.size());
+        for (size_t other = 1; other < colors.size(); ++other)
+        {
+            split[other] = 2 * colors[other] + (static_cast<NodeID>(other) != node);
+        }
+        return refine(graph, std::move(split));
+    }
+
+    // Nodes of the first non-singleton cell in the order of the colors, empty if the coloring is discrete
+    static std::vector<NodeID> targetCell(const Coloring &colors)
+    {
+        std::vector<size_t> sizes(colors.size(), 0);
+        for (size_t node = 1; node < colors.size(); ++node)
+        {
+            ++sizes[colors[node]];
+        }
+
+        auto it = std::find_if(sizes.begin(), sizes.end(), [](size_t size)
+                               { return size > 1; });
+        std::vector<NodeID> cell;
+        if (it == sizes.end())
+        {
+            return cell;
+        }
+        int target = static_cast<int>(it - sizes.begin());
+        for (size_t node = 1; node < colors.size(); ++node)
+        {
+            if (colors[node] == target)
+            {
+                cell.push_back(static_cast<NodeID>(node));
+            }
+        }
+        return cell;
+    }
+
+    // Size of every cell in the order of the colors, equal for the partitions an automorphism maps onto each other
+    static std::vector<size_t> cellSizes(const Coloring &colors)
+    {
+        std::vector<size_t> sizes(colors.size(), 0);
+        for (size_t node = 1; node < colors.size(); ++node)
+        {
+            ++sizes[colors[node]];
+        }
+        return sizes;
+    }
+
+    // Search of the automorphisms from the first path of the search tree
+    class Searcher
+    {
+    public:
+        Searcher(const Graph &graph, size_t budget) : graph_(graph), budget_(budget) {}
+
+        Automorphisms run(const Coloring &initial)
+        {
+            int numNodes = graph_.size();
+            Automorphisms result;
+            UnionFind orbits(numNodes + 1);
+
+            // Step 1: Follow the first path down to the reference leaf
+            std::vector<Coloring> path{refine(graph_, initial)};
+            std::vector<std::vector<NodeID>> cells;
+            while (true)
+            {
+                pathSizes_.push_back(cellSizes(path.back()));
+                std::vector<NodeID> cell = targetCell(path.back());
+                if (cell.empty())
+                {
+                    break;
+                }
+                path.push_back(individualize(graph_, path.back(), cell.front()));
+                cells.push_back(std::move(cell));
+            }
+            leaf_ = path.back();
+
+            // Step 2: Bottom-up, map the first node of every level to the other nodes of its cell
+            for (size_t level = cells.size(); level-- > 0;)
+            {
+                // The generators found so far fix the first nodes of the levels above, their orbits are exact here
+                UnionFind stabilizerOrbits(numNodes + 1);
+                for (const auto &generator : result.generators)
+                {
+                    for (NodeID node = 1; node <= numNodes; ++node)
+                    {
+                        stabilizerOrbits.unite(node, generator[node]);
+                    }
+                }
+
+                NodeID first = cells[level].front();
+                for (NodeID node : cells[level])
+                {
+                    if (stabilizerOrbits.find(node) == stabilizerOrbits.find(first))
+                    {
+                        continue;
+                    }
+
+                    std::vector<NodeID> generator;
+                    if (explore(individualize(graph_, path[level], node), level + 1, generator))
+                    {
+                        for (NodeID other = 1; other <= numNodes; ++other)
+                        {
+                            stabilizerOrbits.unite(other, generator[other]);
+                            orbits.unite(other, generator[other]);
+                        }
+                        result.generators.push_back(std::move(generator));
+                    }
+                    if (exhausted_)
+                    {
+                        break;
+                    }
+                }
+                if (exhausted_)
+                {
+                    break;
+                }
+            }
+
+            result.complete = !exhausted_;
+            result.orbitOf.assign(numNodes + 1, 0);
+            for (NodeID node = 1; node <= numNodes; ++node)
+            {
+                result.orbitOf[node] = static_cast<NodeID>(orbits.find(node));
+            }
+            return result;
+        }
+
+    private:
+        // Depth-first search of a leaf equivalent to the reference leaf, the automorphism is stored in generator
+        bool explore(const Coloring &colors, size_t depth, std::vector<NodeID> &generator)
+        {
+            if (++visited_ > budget_)
+            {
+                exhausted_ = true;
+                return false;
+            }
+            if (depth >= pathSizes_.size() || cellSizes(colors) != pathSizes_[depth])
+            {
+                return false;
+            }
+
+            std::vector<NodeID> cell = targetCell(colors);
+            if (cell.empty())
+            {
+                return isAutomorphism(colors, generator);
+            }
+            for (NodeID node : cell)
+            {
+                if (explore(individualize(graph_, colors, node), depth + 1, generator) || exhausted_)
+                {
+                    return !exhausted_;
+                }
+            }
+            return false;
+        }
+
+        // Map the reference leaf onto the leaf and check that every edge is kept
+        bool isAutomorphism(const Coloring &colors, std::vector<NodeID> &generator) const
+        {
+            int numNodes = graph_.size();
+            std::vector<NodeID> nodeOfColor(numNodes, 0);
+            for (NodeID node = 1; node <= numNodes; ++node)
+            {
+                nodeOfColor[colors[node]] = node;
+            }
+
+            std::vector<NodeID> mapping(numNodes + 1, 0);
+            for (NodeID node = 1; node <= numNodes; ++node)
+            {
+                mapping[node] = nodeOfColor[leaf_[node]];
+            }
+
+            for (NodeID node = 1; node <= numNodes; ++node)
+            {
+                const NodeMask &image = graph_.neighborMask(mapping[node]);
+                for (const NodeID *it = graph_.begin(node); it != graph_.end(node); ++it)
+                {
+                    if (!image.test(mapping[*it]))
+                    {
+                        return false;
+                    }
+                }
+            }
+
+            generator = std::move(mapping);
+            return true;
+        }
+
+        const Graph &graph_;
+        size_t budget_;
+        size_t visited_ = 0;
+        bool exhausted_ = false;
+        std::vector<std::vector<size_t>> pathSizes_;
+        Coloring leaf_;
+    };
+
+    Automorphisms automorphisms(const Graph &graph, const ProbabilityMap &probaMap, size_t budget)
+    {
+        // The initial colors are the ranks of the distinct availabilities
+        int numNodes = graph.size();
+        std::vector<double> values;
+        for (NodeID node = 1; node <= numNodes; ++node)
+        {
+            values.push_back(probaMap[node]);
+        }
+        std::sort(values.begin(), values.end());
+        values.erase(std::unique(values.begin(), values.end()), values.end());
+
+        Coloring initial(numNodes + 1, 0);
+        for (NodeID node = 1; node <= numNodes; ++node)
+        {
+            initial[node] = static_cast<int>(std::lower_bound(values.begin(), values.end(), probaMap[node]) - values.begin());
+        }
+
+        return Searcher(graph, budget).run(initial);
+    }
+
+    std::vector<size_t> pairOrbits(const NodePairs &nodePairs, const Automorphisms &automorphisms)
+    {
+        // Index of every unordered pair in the list
+        auto key = [](NodeID a, NodeID b)
+        { return (static_cast<uint64_t>(std::min(a, b)) << 32) | static_cast<uint32_t>(std::max(a, b)); };
+        std::unordered_map<uint64_t, size_t> indexOf;
+        for (size_t i = 0; i < nodePairs.size(); ++i)
+        {
+            indexOf.emplace(key(nodePairs[i].first, nodePairs[i].second), i);
+        }
+
+        // Join every pair with its images that are in the list, the root is the first pair of the orbit
+        UnionFind orbits(nodePairs.size());
+        for (size_t i = 0; i < nodePairs.size(); ++i)
+        {
+            const auto &[src, dst] = nodePairs[i];
+            for (const auto &generator : automorphisms.generators)
+            {
+                auto it = indexOf.find(key(generator[src], generator[dst]));
+                if (it != indexOf.end())
+                {
+                    orbits.unite(i, it->second);
+                }
+            }
+        }
+
+        std::vector<size_t> representatives(nodePairs.size());
+        for (size_t i = 0; i < nodePairs.size(); ++i)
+        {
+            representatives[i] = orbits.find(i);
+        }
+        return representatives;
+    }
+
+    std::vector<AvailTriple> evalAvailTopo(const Graph &graph, const NodePairs &nodePairs, const ProbabilityMap &probaMap,
+                                           Engine engine, size_t order, bool parallel, size_t budget, SymmetryInfo *info)
+    {
+        // Step 1: Group the pairs into orbits
+        Automorphisms group = automorphisms(graph, probaMap, budget);
+        std::vector<size_t> representatives = pairOrbits(nodePairs, group);
+
+        std::vector<size_t> orbitPairs;
+        for (size_t i = 0; i < nodePairs.size(); ++i)
+        {
+            if (representatives[i] == i)
+            {
+                orbitPairs.push_back(i);
+            }
+        }
+
+        // Step 2: Evaluate the representatives
+        std::vector<double> availability(nodePairs.size(), 0.0);
+
+        #pragma omp parallel for schedule(dynamic) if (parallel)
+        for (size_t k = 0; k < orbitPairs.size(); ++k)
+        {
+            size_t i = orbitPairs[k];
+            const auto &[src, dst] = nodePairs[i];
+            PathSets pathSets = enumeration::minimalPaths(graph, src, dst);
+
+            // Disconnected pairs are never available
+            if (pathSets.empty())
+            {
+                continue;
+            }
+            MinCutSets minCutSets;
+            if (engine == Engine::MCS)
+            {
+                minCutSets = enumeration::minimalCuts(pathSets, src, dst, order);
+            }
+            availability[i] = selector::evalAvailWith(engine, src, dst, probaMap, pathSets, minCutSets, nullptr);
+        }
+
+        // Step 3: Copy the availability of the representative to the orbit
+        std::vector<AvailTriple> availList(nodePairs.size());
+        for (size_t i = 0; i < nodePairs.size(); ++i)
+        {
+            availList[i] = std::make_tuple(nodePairs[i].first, nodePairs[i].second, availability[representatives[i]]);
+        }
+
+        if (info)
+        {
+            info->generators = group.generators.size();
+            info->orbits = orbitPairs.size();
+            info->complete = group.complete;
+        }
+
+        return availList;
+    }
+
+} // namespace pyrbdpp::symmetry
\ No newline at end of file
@@ -0,0 +1,61 @@
+#include <pyrbd_plusplus/truncated.hpp>
+#include <omp.h>
+
+namespace pyrbdpp::truncated
+{
+    AvailBounds evalAvail(const Graph &graph, NodeID src, NodeID dst, const ProbabilityMap &probaMap, Engine engine,
+                          double epsilon, size_t maxPaths, size_t order, stats::PairStats *pairStats)
+    {
+        BoundsOptions options;
+        options.epsilon = epsilon;
+        BoundsCallback noCallback;
+        BoundsTracker tracker(src, dst, options, noCallback, BoundsTracker::Clock::time_point::max());
+
+        // Step 1: Enumerate the most probable path sets
+        enumeration::ProbablePaths probable = enumeration::probablePaths(graph, src, dst, probaMap, epsilon, maxPaths);
+
+        // Step 2: Evaluate the kept path sets, no path set keeps the lower bound at 0
+        double lower = 0.0;
+        if (pairStats)
+        {
+            pairStats->src = src;
+            pairStats->dst = dst;
+        }
+        if (!probable.pathSets.empty())
+        {
+            enumeration::MinCutSets minCutSets;
+            if (engine == Engine::MCS)
+            {
+                minCutSets = enumeration::minimalCuts(probable.pathSets, src, dst, order);
+            }
+            lower = selector::evalAvailWith(engine, src, dst, probaMap, probable.pathSets, minCutSets, pairStats);
+        }
+
+        // Step 3: The upper bound adds the bound of the paths left out
+        size_t kept = probable.pathSets.size();
+        tracker.update(lower, probable.remaining, kept, kept + probable.open);
+        return tracker.finish(probable.complete);
+    }
+
+    std::vector<AvailBounds> evalAvailTopo(const Graph &graph, const NodePairs &nodePairs, const ProbabilityMap &probaMap,
+                                           Engine engine, double epsilon, size_t maxPaths, size_t order, bool parallel,
+                                           std::vector<stats::PairStats> *statsList)
+    {
+        std::vector<AvailBounds> boundsList(nodePairs.size());
+        if (statsList)
+        {
+            statsList->assign(nodePairs.size(), {});
+        }
+
+        #pragma omp parallel for schedule(dynamic) if (parallel)
+        for (size_t i = 0; i < nodePairs.size(); ++i)
+        {
+            const auto &[src, dst] = nodePairs[i];
+            boundsList[i] = evalAvail(graph, src, dst, probaMap, engine, epsilon, maxPaths, order,
+                                      statsList ? &(*statsList)[i] : nullptr);
+        }
+
+        return boundsList;
+    }
+
+} // namespace pyrbdpp::truncated
\ No newline at end of file
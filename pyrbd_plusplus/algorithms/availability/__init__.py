@@ -4,4 +4,27 @@ __all__ = [
     'to_boolean_expression',
     'eval_single_pair',
     'eval_topology',
+    'eval_topology_pipeline',
+    'eval_topology_blockcut',
+    'eval_topology_reduced',
+    'eval_topology_modules',
+    'eval_topology_bounded_paths',
+    'eval_topology_symmetric',
+    'eval_topology_hybrid',
+    'eval_topology_bdd',
+    'eval_topology_matrix',
+    'eval_topology_demand',
+    'eval_single_pair_bounds',
+    'eval_topology_bounds',
+    'eval_single_pair_truncated',
+    'eval_topology_truncated',
+    'eval_single_pair_montecarlo',
+    'eval_topology_montecarlo',
+    'eval_single_pair_importance',
+    'eval_topology_importance',
+    'eval_reliability',
+    'eval_reliability_sets',
+    'eval_single_pair_links',
+    'eval_topology_links',
+    'IncrementalTopology',
 ]
\ No newline at end of file
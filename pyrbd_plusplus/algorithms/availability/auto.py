@@ -0,0 +1,13 @@
+from .engine import eval_single_pair, eval_topology
+
+def eval_avail_auto(G, A_dict, src, dst, stats=False):
+    """Evaluate the availability for a single source-destination pair with the predicted fastest engine."""
+    return eval_single_pair(G, A_dict, src, dst, 'auto', stats=stats)
+
+def eval_avail_topo_auto(G, A_dict, calibrate=False, stats=False):
+    """Evaluate the availability for the entire topology with the predicted fastest engine per pair."""
+    return eval_topology(G, A_dict, 'auto', calibrate=calibrate, stats=stats)
+
+def eval_avail_topo_auto_parallel(G, A_dict, calibrate=False, stats=False):
+    """Evaluate the availability for the entire topology in parallel with the predicted fastest engine per pair."""
+    return eval_topology(G, A_dict, 'auto', parallel=True, calibrate=calibrate, stats=stats)
\ No newline at end of file
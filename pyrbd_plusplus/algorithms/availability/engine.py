@@ -1,34 +1,75 @@
 from itertools import combinations
 from loguru import logger
+import numpy as np
 
-from ...algorithms.sets import minimalcuts_optimized, minimalpaths
+from ...algorithms.sets import minimalcuts_native, minimalpaths_native, to_native_graph
 from ...utils import relabel_graph_A_dict, relabel_boolexpr_to_str, sdp_boolexpr_to_str
-from .pyrbd import eval_avail_pyrbd, eval_avail_topo_pyrbd, eval_avail_topo_pyrbd_parallel
 import pyrbd_plusplus._core.pyrbd_plusplus_cpp as cpp
 
+def _cut_order(G, algorithm, links=False):
+    """Get the order limit of the minimal cut sets of an algorithm, 0 if it does not enumerate cut sets.
+    MCS keeps the default of the baseline minimalcuts(), the cut sets of at most half of the components that can fail:
+    the nodes, or with link failures the nodes and the edges."""
+    if algorithm != 'mcs':
+        return 0
+    return cpp.mcs.cut_order(G.number_of_nodes() + (G.number_of_edges() if links else 0))
+
+def auto_problem_sets(G, src, dst):
+    """Get the path sets of a pair and its minimal cut sets if MCS can still be the fastest engine.
+    The cut sets are only enumerated if the default cost model, the one eval_single_pair() selects with, predicts MCS at
+    most as expensive as SDP and PathSet with the cut sets estimated from the path sets, otherwise they are empty and the
+    selector chooses between the path set engines. eval_topology() does the same for all pairs on one native graph."""
+    graph, nodes, index = to_native_graph(G)
+    paths = cpp.enumeration.minimal_paths(graph, index[src], index[dst])
+    path_sets = [[nodes[i - 1] for i in path] for path in paths]
+    if not cpp.selector.mcs_candidate(cpp.selector.CostModel(), index[src], index[dst], paths):
+        return path_sets, []
+
+    # The cut sets start with the source and the destination
+    cuts = cpp.mcs.minimal_cuts(paths, index[src], index[dst], _cut_order(G, 'mcs'))
+    return path_sets, [[nodes[i - 1] for i in cut] for cut in cuts]
+
 # Algorithm Configuration
 ALGORITHM_CONFIG = {
     'mcs': {
         'cpp_module': 'mcs',
-        'problem_set_func': minimalcuts_optimized,
+        'problem_set_func': minimalcuts_native,
         'bool_expr_func': relabel_boolexpr_to_str,
         'to_set_func': 'to_probaset',
     },
     'pathset': {
         'cpp_module': 'pathset', 
-        'problem_set_func': minimalpaths,
+        'problem_set_func': minimalpaths_native,
         'bool_expr_func': relabel_boolexpr_to_str,
         'to_set_func': 'to_probaset',
     },
     'sdp': {
         'cpp_module': 'sdp',
-        'problem_set_func': minimalpaths,  # SDP is based on pathsets
+        'problem_set_func': minimalpaths_native,  # SDP is based on pathsets
         'bool_expr_func': sdp_boolexpr_to_str,
         'to_set_func': 'to_sdp_set',
     },
+    'bdd': {
+        'cpp_module': 'bdd',
+        'problem_set_func': minimalpaths_native,  # the graph evaluation compiles the BDD without the path sets
+        'bool_expr_func': None,
+        'to_set_func': None,
+    },
+    'auto': {
+        'cpp_module': 'selector',
+        'problem_set_func': auto_problem_sets,  # the selector compares pathset based and cut set based engines
+        'bool_expr_func': None,
+        'to_set_func': None,
+    },
     'pyrbd': {
-        'cpp_module': None,
-        'problem_set_func': None,
+        'cpp_module': 'factoring',
+        'problem_set_func': None,  # the factoring engine works on the graph, no set is enumerated
+        'bool_expr_func': None,
+        'to_set_func': None,
+    },
+    'exhaustive': {
+        'cpp_module': 'exhaustive',
+        'problem_set_func': None,  # every state of the components is enumerated, no set is enumerated
         'bool_expr_func': None,
         'to_set_func': None,
     }
@@ -51,6 +92,15 @@ def to_boolean_expression(G, src, dst, algorithm='mcs'):
     
     if algorithm == 'pyrbd':
         raise NotImplementedError("Boolean expression generation for PyRBD is not implemented.")
+
+    if algorithm == 'auto':
+        raise NotImplementedError("Boolean expression generation for the automatic selection is not implemented, choose an algorithm.")
+
+    if algorithm == 'bdd':
+        raise NotImplementedError("Boolean expression generation for the BDD is not implemented, choose a set based algorithm.")
+
+    if algorithm == 'exhaustive':
+        raise NotImplementedError("Boolean expression generation for the exhaustive enumeration is not implemented, choose a set based algorithm.")
     
     # Get algorithm configuration
     config = ALGORITHM_CONFIG[algorithm]
@@ -71,7 +121,17 @@ def to_boolean_expression(G, src, dst, algorithm='mcs'):
     # Convert to boolean expression
     return config['bool_expr_func'](result_set)
 
-def eval_single_pair(G, A_dict, src, dst, algorithm='sdp', parallel=False):
+def _relabel_stats(stats_list, reverse_mapping):
+    """Convert the stats records of the C++ core to dicts with the original node labels."""
+    stats_dicts = []
+    for pair_stats in stats_list:
+        stats_dict = pair_stats.to_dict()
+        stats_dict['src'] = reverse_mapping[pair_stats.src]
+        stats_dict['dst'] = reverse_mapping[pair_stats.dst]
+        stats_dicts.append(stats_dict)
+    return stats_dicts
+
+def eval_single_pair(G, A_dict, src, dst, algorithm='sdp', parallel=False, stats=False):
     """Evaluate the availability of a source and destination pair in the topology using SDP.
     
     Args:
@@ -79,103 +139,1055 @@ def eval_single_pair(G, A_dict, src, dst, algorithm='sdp', parallel=False):
         A_dict (dict): A dictionary mapping nodes to their availability.
         src (int): The source node index.
         dst (int): The destination node index.
-        algorithm (str): The algorithm to use for evaluation ('mcs', 'pathset', or 'sdp').
-        parallel (bool): Whether to use parallel evaluation if available.
+        algorithm (str): The algorithm to use for evaluation ('mcs', 'pathset', 'sdp', 'bdd', 'pyrbd', 'exhaustive' or 'auto').
+            'pyrbd' runs the native factoring engine, with the same result as eval_avail_pyrbd().
+            'exhaustive' enumerates every state of the nodes on the paths of the pair, at most 30 nodes.
+        parallel (bool): Whether to use parallel evaluation if available, for 'pyrbd' the branches run as parallel tasks
+            and for 'exhaustive' the blocks of states.
+        stats (bool): Whether to collect the instrumentation counters of the evaluation.
     
     Raises:
-        ValueError: If the specified algorithm does not support parallel evaluation.
+        ValueError: If the specified algorithm does not support parallel evaluation or stats.
     
     Returns:
-        tuple: (src, dst, availability)
+        tuple: (src, dst, availability), for 'auto' (src, dst, availability, engine).
+            With stats=True the tuple (result, stats_dict) is returned.
     """
     # Validate algorithm
     if algorithm not in ALGORITHM_CONFIG:
         raise ValueError(f"Unsupported algorithm: {algorithm}. Choose from {list(ALGORITHM_CONFIG.keys())}.")
     
-    if algorithm == 'pyrbd':
-        return eval_avail_pyrbd(G, src, dst, A_dict)
-    
     # Get algorithm configuration
     config = ALGORITHM_CONFIG[algorithm]
     cpp_module = getattr(cpp, config['cpp_module'])
     
     # Relabel
     G_relabel, A_dict_relabeled, relabel_mapping = relabel_graph_A_dict(G, A_dict)
+    reverse_mapping = {v: k for k, v in relabel_mapping.items()}
     src_relabel = relabel_mapping[src]
     dst_relabel = relabel_mapping[dst]
+
+    if algorithm in ('pyrbd', 'exhaustive'):
+        # Evaluate the native graph directly, same result as eval_avail_pyrbd()
+        graph, _, _ = to_native_graph(G_relabel)
+        output = cpp_module.eval_avail(graph, src_relabel, dst_relabel, A_dict_relabeled, parallel=parallel, stats=stats)
+        availability, pair_stats = output if stats else (output, None)
+        result = (src, dst, availability)
+        if stats:
+            return result, _relabel_stats([pair_stats], reverse_mapping)[0]
+        return result
     
     # Get problem sets
     problem_sets = config['problem_set_func'](G_relabel, src_relabel, dst_relabel)
-    
-    # Choose evaluation method
-    if parallel:
-        if hasattr(cpp_module, 'eval_avail_parallel'):
-            availability = cpp_module.eval_avail_parallel(
-                src_relabel, dst_relabel, A_dict_relabeled, problem_sets
-            )
-        else:
-            raise ValueError(f"Parallel evaluation not available for {algorithm} algorithm.")
-    else:
-        availability = cpp_module.eval_avail(
-            src_relabel, dst_relabel, A_dict_relabeled, problem_sets
+
+    if algorithm == 'auto':
+        path_sets, min_cut_sets = problem_sets
+        output = cpp_module.eval_avail(
+            src_relabel, dst_relabel, A_dict_relabeled, path_sets, min_cut_sets, stats=stats
         )
-    
-    return (src, dst, availability)
+        (_, _, availability, engine), pair_stats = output if stats else (output, None)
+        result = (src, dst, availability, engine.name)
+    else:
+        # Choose evaluation method
+        if parallel:
+            if hasattr(cpp_module, 'eval_avail_parallel'):
+                output = cpp_module.eval_avail_parallel(
+                    src_relabel, dst_relabel, A_dict_relabeled, problem_sets, stats=stats
+                )
+            else:
+                raise ValueError(f"Parallel evaluation not available for {algorithm} algorithm.")
+        else:
+            output = cpp_module.eval_avail(
+                src_relabel, dst_relabel, A_dict_relabeled, problem_sets, stats=stats
+            )
+        availability, pair_stats = output if stats else (output, None)
+        result = (src, dst, availability)
 
-def eval_topology(G, A_dict, algorithm='sdp', parallel=False):
+    if stats:
+        return result, _relabel_stats([pair_stats], reverse_mapping)[0]
+    return result
+
+def eval_topology(G, A_dict, algorithm='sdp', parallel=False, calibrate=False, stats=False):
     """Evaluate the availability for all pairs of nodes in the topology using SDP.
 
+    The native variants that replace the evaluation of the graph have their own entry points: eval_topology_pipeline(),
+    eval_topology_blockcut(), eval_topology_reduced(), eval_topology_modules(), eval_topology_bounded_paths(),
+    eval_topology_symmetric(), eval_topology_hybrid() and eval_topology_demand().
+
     Args:
         G (networkx.Graph): The graph representation.
         A_dict (dict): A dictionary mapping nodes to their availability.
-        algorithm (str): The algorithm to use for evaluation ('mcs', 'pathset', or 'sdp').
+        algorithm (str): The algorithm to use for evaluation ('mcs', 'pathset', 'sdp', 'bdd', 'pyrbd', 'exhaustive' or 'auto').
+            'bdd' compiles a binary decision diagram of every pair directly from the graph.
+            'pyrbd' runs the native factoring engine on the graph, with the same results as eval_avail_topo_pyrbd().
+            'exhaustive' enumerates every state of the nodes on the paths of each pair, at most 30 nodes per pair.
         parallel (bool): Whether to use parallel evaluation if available.
-        
+        calibrate (bool): Only for 'auto', calibrate the cost model with a small run on the topology before the evaluation.
+        stats (bool): Whether to collect the instrumentation counters of every pair.
+
     Raises:
-        ValueError: If the specified algorithm does not support parallel evaluation.
-    
+        ValueError: If the specified algorithm is not supported.
+
     Returns:
         List[tuple]: A list of tuples, each containing (src, dst, availability).
+            For 'auto' each tuple contains (src, dst, availability, engine).
+            With stats=True the tuple (results, stats_dicts) is returned, one stats dict per pair.
     """
     # Validate algorithm
     if algorithm not in ALGORITHM_CONFIG:
         raise ValueError(f"Unsupported algorithm: {algorithm}. Choose from {list(ALGORITHM_CONFIG.keys())}.")
-    
-    if algorithm == 'pyrbd':
-        return eval_avail_topo_pyrbd(G, A_dict) if not parallel else eval_avail_topo_pyrbd_parallel(G, A_dict)
-    
+
     # Get algorithm configuration
     config = ALGORITHM_CONFIG[algorithm]
     cpp_module = getattr(cpp, config['cpp_module'])
-    
+
+    if algorithm == 'auto':
+        # The automatic selection compares the engines on the problem sets of every pair
+        G_relabel, A_dict_relabeled, relabel_mapping = relabel_graph_A_dict(G, A_dict)
+        reverse_mapping = {v: k for k, v in relabel_mapping.items()}
+        node_pairs = list(combinations(G_relabel.nodes(), 2))
+        return _eval_topology_auto(G_relabel, node_pairs, A_dict_relabeled, reverse_mapping, parallel, calibrate, stats)
+
+    if algorithm in ('pyrbd', 'exhaustive'):
+        # Evaluate the native graph directly, same results as eval_avail_topo_pyrbd()
+        def evaluate(graph, node_pairs, A_dict_relabeled, order):
+            return cpp_module.eval_avail_topo(graph, node_pairs, A_dict_relabeled, parallel=parallel, stats=stats)
+    else:
+        # Enumerate the sets in C++ with one DFS per source without passing them through Python
+        eval_func = cpp_module.eval_avail_topo_graph_parallel if parallel else cpp_module.eval_avail_topo_graph
+        def evaluate(graph, node_pairs, A_dict_relabeled, order):
+            if algorithm == 'mcs':
+                return eval_func(graph, node_pairs, A_dict_relabeled, order=order, stats=stats)
+            return eval_func(graph, node_pairs, A_dict_relabeled, stats=stats)
+    return _eval_topology_native(G, A_dict, algorithm, stats, evaluate)
+
+def _native_engine(algorithm, evaluation):
+    """Get the selector engine of an algorithm for the native evaluations that dispatch to mcs, pathset or sdp."""
+    if algorithm not in ('mcs', 'pathset', 'sdp'):
+        raise ValueError(f"{evaluation} not available for {algorithm} algorithm. Choose from ['mcs', 'pathset', 'sdp'].")
+    return getattr(cpp.selector.Engine, algorithm)
+
+def _eval_topology_native(G, A_dict, algorithm, stats, evaluate, weight=None):
+    """Evaluate all pairs of nodes on the native graph and relabel the results.
+    evaluate(graph, node_pairs, A_dict_relabeled, order) runs the native evaluation, with the cut order of the algorithm.
+    The edge attribute weight, if given, is passed to the native graph as the edge lengths."""
     # Relabel
     G_relabel, A_dict_relabeled, relabel_mapping = relabel_graph_A_dict(G, A_dict)
     reverse_mapping = {v: k for k, v in relabel_mapping.items()}
-    
-    # Get all pairs
     node_pairs = list(combinations(G_relabel.nodes(), 2))
-    
-    # Get all problem sets
-    problem_sets_list = [
-        config['problem_set_func'](G_relabel, src, dst)
-        for src, dst in node_pairs
+
+    # The relabelled nodes are 1..n in the order of G.nodes(), which are also the node IDs of the native graph
+    graph, _, _ = to_native_graph(G_relabel, weight)
+    output = evaluate(graph, node_pairs, A_dict_relabeled, _cut_order(G_relabel, algorithm))
+    availability_lst, stats_list = output if stats else (output, None)
+
+    # Relabel results
+    results = [
+        (reverse_mapping[src], reverse_mapping[dst], availability)
+        for src, dst, availability in availability_lst
+    ]
+
+    if stats:
+        return results, _relabel_stats(stats_list, reverse_mapping)
+    return results
+
+def eval_topology_pipeline(G, A_dict, queue_capacity, algorithm='sdp', parallel=False, stats=False):
+    """Evaluate all pairs with the enumeration and the evaluation overlapped through a bounded queue.
+
+    The pairs are enumerated one by one and handed to the evaluation, so only the sets of the queued pairs are held
+    in memory.
+
+    Args:
+        G (networkx.Graph): The graph representation.
+        A_dict (dict): A dictionary mapping nodes to their availability.
+        queue_capacity (int): Maximal number of enumerated pairs waiting for their evaluation.
+        algorithm (str): The algorithm to use for evaluation ('mcs', 'pathset' or 'sdp').
+        parallel (bool): Whether to evaluate the pairs in parallel.
+        stats (bool): Whether to collect the instrumentation counters of every pair.
+
+    Raises:
+        ValueError: If the specified algorithm is not supported.
+
+    Returns:
+        List[tuple]: A list of tuples, each containing (src, dst, availability).
+            With stats=True the tuple (results, stats_dicts) is returned, one stats dict per pair.
+    """
+    engine = _native_engine(algorithm, 'Pipelined evaluation')
+
+    def evaluate(graph, node_pairs, A_dict_relabeled, order):
+        return cpp.pipeline.eval_avail_topo(
+            graph, node_pairs, A_dict_relabeled, engine=engine, capacity=queue_capacity, order=order,
+            parallel=parallel, stats=stats
+        )
+    return _eval_topology_native(G, A_dict, algorithm, stats, evaluate)
+
+def eval_topology_blockcut(G, A_dict, algorithm='sdp', parallel=False):
+    """Evaluate all pairs by factoring them along the block-cut tree.
+
+    The path sets are only enumerated inside the biconnected blocks and every pair is the product of the blocks and
+    the cut vertices on its way through the tree.
+
+    Args:
+        G (networkx.Graph): The graph representation.
+        A_dict (dict): A dictionary mapping nodes to their availability.
+        algorithm (str): The algorithm to use for the blocks ('mcs', 'pathset' or 'sdp').
+        parallel (bool): Whether to evaluate the pairs in parallel.
+
+    Raises:
+        ValueError: If the specified algorithm is not supported.
+
+    Returns:
+        List[tuple]: A list of tuples, each containing (src, dst, availability).
+    """
+    engine = _native_engine(algorithm, 'Block-cut decomposition')
+
+    def evaluate(graph, node_pairs, A_dict_relabeled, order):
+        info = cpp.blockcut.DecompositionInfo()
+        output = cpp.blockcut.eval_avail_topo(graph, node_pairs, A_dict_relabeled, engine=engine, parallel=parallel, info=info)
+        logger.debug(f"Block-cut tree decomposition: {info}")
+        return output
+    return _eval_topology_native(G, A_dict, algorithm, False, evaluate)
+
+def eval_topology_reduced(G, A_dict, algorithm='sdp', parallel=False):
+    """Evaluate all pairs on their series-parallel reduced graphs.
+
+    The degree-2 chains and the parallel nodes of every pair are folded into super-components before the sets of the
+    reduced graph are enumerated.
+
+    Args:
+        G (networkx.Graph): The graph representation.
+        A_dict (dict): A dictionary mapping nodes to their availability.
+        algorithm (str): The algorithm to use for the reduced graphs ('mcs', 'pathset' or 'sdp').
+        parallel (bool): Whether to evaluate the pairs in parallel.
+
+    Raises:
+        ValueError: If the specified algorithm is not supported.
+
+    Returns:
+        List[tuple]: A list of tuples, each containing (src, dst, availability).
+    """
+    engine = _native_engine(algorithm, 'Series-parallel reduction')
+
+    def evaluate(graph, node_pairs, A_dict_relabeled, order):
+        info = cpp.reduction.ReductionInfo()
+        output = cpp.reduction.eval_avail_topo(graph, node_pairs, A_dict_relabeled, engine=engine, parallel=parallel, info=info)
+        logger.debug(f"Series-parallel reduction: {info}")
+        return output
+    return _eval_topology_native(G, A_dict, algorithm, False, evaluate)
+
+def eval_topology_modules(G, A_dict, algorithm='sdp', parallel=False, stats=False):
+    """Evaluate all pairs with the modules of their sets collapsed.
+
+    The nodes that always appear together in the sets of a pair are collapsed into one literal and the nodes on
+    every path are factored out.
+
+    Args:
+        G (networkx.Graph): The graph representation.
+        A_dict (dict): A dictionary mapping nodes to their availability.
+        algorithm (str): The algorithm to use for evaluation ('mcs', 'pathset' or 'sdp').
+        parallel (bool): Whether to evaluate the pairs in parallel.
+        stats (bool): Whether to collect the instrumentation counters of every pair.
+
+    Raises:
+        ValueError: If the specified algorithm is not supported.
+
+    Returns:
+        List[tuple]: A list of tuples, each containing (src, dst, availability).
+            With stats=True the tuple (results, stats_dicts) is returned, one stats dict per pair.
+    """
+    engine = _native_engine(algorithm, 'Module detection')
+
+    def evaluate(graph, node_pairs, A_dict_relabeled, order):
+        info = cpp.modules.ModuleInfo()
+        output = cpp.modules.eval_avail_topo(
+            graph, node_pairs, A_dict_relabeled, engine=engine, order=order, parallel=parallel, info=info, stats=stats
+        )
+        logger.debug(f"Module detection: {info}")
+        return output
+    return _eval_topology_native(G, A_dict, algorithm, stats, evaluate)
+
+def eval_topology_bounded_paths(G, A_dict, algorithm='sdp', parallel=False, max_hops=None, max_length=None,
+                                weight='weight', stats=False):
+    """Evaluate all pairs counting only the paths within a hop or length limit.
+
+    Args:
+        G (networkx.Graph): The graph representation.
+        A_dict (dict): A dictionary mapping nodes to their availability.
+        algorithm (str): The algorithm to use for evaluation ('mcs', 'pathset' or 'sdp').
+        parallel (bool): Whether to evaluate the pairs in parallel.
+        max_hops (int, optional): Only count the paths with at most this many edges.
+        max_length (float, optional): Only count the paths whose edge lengths sum to at most this value.
+        weight (str): Edge attribute with the length of an edge for max_length, edges without it have the length 1.
+        stats (bool): Whether to collect the instrumentation counters of every pair.
+
+    Raises:
+        ValueError: If the specified algorithm is not supported.
+
+    Returns:
+        List[tuple]: A list of tuples, each containing (src, dst, availability).
+            With stats=True the tuple (results, stats_dicts) is returned, one stats dict per pair.
+    """
+    _native_engine(algorithm, 'Bounded path evaluation')
+    cpp_module = getattr(cpp, ALGORITHM_CONFIG[algorithm]['cpp_module'])
+    eval_func = cpp_module.eval_avail_topo_bounded_parallel if parallel else cpp_module.eval_avail_topo_bounded
+
+    def evaluate(graph, node_pairs, A_dict_relabeled, order):
+        return eval_func(
+            graph, node_pairs, A_dict_relabeled, max_hops=max_hops or 0, max_length=max_length or 0.0, order=order,
+            stats=stats
+        )
+    return _eval_topology_native(G, A_dict, algorithm, stats, evaluate, weight if max_length is not None else None)
+
+def eval_topology_symmetric(G, A_dict, algorithm='sdp', parallel=False):
+    """Evaluate one pair per automorphism orbit and copy its result to the orbit.
+
+    The pairs are grouped into orbits under the automorphisms of the graph that keep the availabilities.
+
+    Args:
+        G (networkx.Graph): The graph representation.
+        A_dict (dict): A dictionary mapping nodes to their availability.
+        algorithm (str): The algorithm to use for evaluation ('mcs', 'pathset' or 'sdp').
+        parallel (bool): Whether to evaluate the orbits in parallel.
+
+    Raises:
+        ValueError: If the specified algorithm is not supported.
+
+    Returns:
+        List[tuple]: A list of tuples, each containing (src, dst, availability).
+    """
+    engine = _native_engine(algorithm, 'Symmetry reduction')
+
+    def evaluate(graph, node_pairs, A_dict_relabeled, order):
+        info = cpp.symmetry.SymmetryInfo()
+        output = cpp.symmetry.eval_avail_topo(
+            graph, node_pairs, A_dict_relabeled, engine=engine, order=order, parallel=parallel, info=info
+        )
+        logger.debug(f"Automorphism orbits: {info}")
+        return output
+    return _eval_topology_native(G, A_dict, algorithm, False, evaluate)
+
+def eval_topology_hybrid(G, A_dict, exhaustive_threshold, algorithm='sdp', parallel=False):
+    """Evaluate the small pairs by enumerating all their states and the others with their sets.
+
+    Args:
+        G (networkx.Graph): The graph representation.
+        A_dict (dict): A dictionary mapping nodes to their availability.
+        exhaustive_threshold (int): Evaluate the pairs with at most this many nodes on their paths by enumerating all
+            their states, without enumerating their sets.
+        algorithm (str): The algorithm to use for the other pairs ('mcs', 'pathset' or 'sdp').
+        parallel (bool): Whether to evaluate the pairs in parallel.
+
+    Raises:
+        ValueError: If the specified algorithm is not supported.
+
+    Returns:
+        List[tuple]: A list of tuples, each containing (src, dst, availability).
+    """
+    engine = _native_engine(algorithm, 'Hybrid exhaustive evaluation')
+
+    def evaluate(graph, node_pairs, A_dict_relabeled, order):
+        info = cpp.exhaustive.ExhaustiveInfo()
+        output = cpp.exhaustive.eval_avail_topo_graph(
+            graph, node_pairs, A_dict_relabeled, engine=engine, threshold=exhaustive_threshold, order=order,
+            parallel=parallel, info=info
+        )
+        logger.debug(f"Exhaustive enumeration: {info}")
+        return output
+    return _eval_topology_native(G, A_dict, algorithm, False, evaluate)
+
+def eval_topology_demand(G, A_dict, demand, algorithm='sdp', parallel=False, reductions=('mean', 'min'), worst=10):
+    """Evaluate the pairs with a positive traffic demand and reduce their availability over the demands in C++.
+
+    Only the pairs with a demand are evaluated and the per-pair results are not returned, e.g. for the availability
+    seen by the traffic of a large topology.
+
+    Args:
+        G (networkx.Graph): The graph representation.
+        A_dict (dict): A dictionary mapping nodes to their availability.
+        demand (dict or numpy.ndarray): The traffic between the nodes as a {(src, dst): weight} dict or an (n, n)
+            matrix in the order of G.nodes().
+        algorithm (str): The algorithm to use for evaluation ('mcs', 'pathset' or 'sdp').
+        parallel (bool): Whether to evaluate the pairs in parallel.
+        reductions (iterable): The reductions to compute: 'mean' (demand-weighted mean availability), 'min' (least
+            available pair), 'worst' (the worst least available pairs) and 'per_source' (demand-weighted mean
+            availability of the demands of every source).
+        worst (int): The number of least available pairs of the 'worst' reduction.
+
+    Raises:
+        ValueError: If the algorithm or a reduction is not supported.
+
+    Returns:
+        dict: 'demands' (number of positive demands), 'pairs' (number of distinct pairs evaluated), 'total_demand',
+            and for the requested reductions 'weighted_mean', 'minimum' (a (src, dst, availability) tuple), 'worst'
+            (the tuples in increasing availability) and 'per_source' (a {src: weighted mean} dict).
+    """
+    engine = _native_engine(algorithm, 'Demand evaluation')
+    unknown = set(reductions) - {'mean', 'min', 'worst', 'per_source'}
+    if unknown:
+        raise ValueError(f"Unsupported reductions: {sorted(unknown)}. Choose from ['mean', 'min', 'worst', 'per_source'].")
+
+    # Relabel
+    G_relabel, A_dict_relabeled, relabel_mapping = relabel_graph_A_dict(G, A_dict)
+    reverse_mapping = {v: k for k, v in relabel_mapping.items()}
+
+    # The rows and columns of the matrix are the nodes in the order of G.nodes(), the relabelled IDs 1..n
+    if isinstance(demand, dict):
+        demands = [(relabel_mapping[src], relabel_mapping[dst], weight) for (src, dst), weight in demand.items()]
+    else:
+        demands = cpp.demand.demands_from_matrix(np.asarray(demand, dtype=np.float64))
+
+    order = _cut_order(G_relabel, algorithm)
+
+    graph, _, _ = to_native_graph(G_relabel)
+    summary = cpp.demand.eval_avail_topo(
+        graph, demands, A_dict_relabeled, mean='mean' in reductions, minimum='min' in reductions,
+        worst=worst if 'worst' in reductions else 0, per_source='per_source' in reductions,
+        engine=engine, order=order, parallel=parallel
+    )
+    logger.debug(f"Demand-weighted evaluation: {summary}")
+
+    def relabel(triple):
+        return reverse_mapping[triple[0]], reverse_mapping[triple[1]], triple[2]
+
+    result = {'demands': summary.demands, 'pairs': summary.pairs, 'total_demand': summary.total_demand}
+    if 'mean' in reductions:
+        result['weighted_mean'] = summary.weighted_mean
+    if 'min' in reductions and summary.pairs:
+        result['minimum'] = relabel(summary.minimum)
+    if 'worst' in reductions:
+        result['worst'] = [relabel(triple) for triple in summary.worst]
+    if 'per_source' in reductions:
+        result['per_source'] = {reverse_mapping[src]: mean for src, mean in summary.per_source}
+    return result
+
+def eval_topology_bdd(G, A_dicts, parallel=False, ordering='bfs'):
+    """Evaluate the availability for all pairs of nodes for several availability dicts with one BDD compilation.
+
+    The binary decision diagram of every pair only depends on the topology, so it is compiled once and every
+    availability dict is a single bottom-up pass over the diagrams, e.g. for what-if or sensitivity sweeps.
+
+    Args:
+        G (networkx.Graph): The graph representation.
+        A_dicts (List[dict]): Dictionaries mapping nodes to their availability.
+        parallel (bool): Whether to compile and evaluate the pairs in parallel.
+        ordering (str): Variable ordering heuristic ('bfs' or 'frequency').
+
+    Returns:
+        List[List[tuple]]: For every availability dict a list of tuples, each containing (src, dst, availability).
+    """
+    # Relabel
+    G_relabel, _, relabel_mapping = relabel_graph_A_dict(G, {})
+    reverse_mapping = {v: k for k, v in relabel_mapping.items()}
+    node_pairs = list(combinations(G_relabel.nodes(), 2))
+
+    # Compile the diagrams once for all availability dicts
+    graph, _, _ = to_native_graph(G_relabel)
+    diagrams = cpp.bdd.compile_topo(graph, node_pairs, ordering=getattr(cpp.bdd.Ordering, ordering), parallel=parallel)
+    logger.debug(f"Compiled {len(diagrams)} diagrams with {sum(diagram.size() for diagram in diagrams)} nodes")
+
+    results = []
+    for A_dict in A_dicts:
+        A_dict_relabeled = {relabel_mapping[node]: availability for node, availability in A_dict.items()}
+        availability_lst = cpp.bdd.eval_diagrams(diagrams, A_dict_relabeled, parallel=parallel)
+        results.append([
+            (reverse_mapping[src], reverse_mapping[dst], availability)
+            for src, dst, availability in availability_lst
+        ])
+    return results
+
+def _eval_topology_auto(G_relabel, node_pairs, A_dict_relabeled, reverse_mapping, parallel, calibrate, stats):
+    """Evaluate all pairs with the predicted fastest engine per pair and relabel the results.
+    The path sets of all pairs are enumerated on one native graph, the cost model is calibrated on them if requested,
+    and the same model decides which pairs need their cut sets and then selects the engine of every pair."""
+    graph, _, _ = to_native_graph(G_relabel)
+    enumerate_func = (
+        cpp.enumeration.minimal_paths_topo_from_sources_parallel if parallel else cpp.enumeration.minimal_paths_topo_from_sources
+    )
+    pathsets_list = enumerate_func(graph, node_pairs)
+    order = _cut_order(G_relabel, 'mcs')
+
+    # Fit the cost model on this topology, otherwise use the default coefficients
+    if calibrate:
+        model = cpp.selector.calibrate_from_paths(node_pairs, A_dict_relabeled, pathsets_list, order)
+        logger.debug(
+            f"Calibrated cost model: sdp={model.sdp_coeff:.3e}, pathset={model.pathset_coeff:.3e}, mcs={model.mcs_coeff:.3e}"
+        )
+    else:
+        model = cpp.selector.CostModel()
+
+    # Only enumerate the cut sets of the pairs where MCS can still be the fastest engine
+    min_cut_sets_list = [
+        cpp.mcs.minimal_cuts(path_sets, src, dst, order) if cpp.selector.mcs_candidate(model, src, dst, path_sets) else []
+        for (src, dst), path_sets in zip(node_pairs, pathsets_list)
+    ]
+
+    eval_func = cpp.selector.eval_avail_topo_parallel if parallel else cpp.selector.eval_avail_topo
+    output = eval_func(node_pairs, A_dict_relabeled, pathsets_list, min_cut_sets_list, model, stats=stats)
+    availability_lst, stats_list = output if stats else (output, None)
+
+    # Relabel results
+    results = [
+        (reverse_mapping[src], reverse_mapping[dst], availability, engine.name)
+        for src, dst, availability, engine in availability_lst
     ]
 
+    if stats:
+        return results, _relabel_stats(stats_list, reverse_mapping)
+    return results
+
+def _relabel_bounds(bounds, reverse_mapping):
+    """Convert the bounds of the C++ core to a dict with the original node labels."""
+    bounds_dict = bounds.to_dict()
+    bounds_dict['src'] = reverse_mapping[bounds.src]
+    bounds_dict['dst'] = reverse_mapping[bounds.dst]
+    return bounds_dict
+
+def eval_single_pair_bounds(G, A_dict, src, dst, algorithm='sdp', parallel=False, epsilon=1e-9, deadline=0.0,
+                            callback=None, report_interval=0.0):
+    """Anytime evaluation of the availability bounds of a source and destination pair.
+
+    The work is ordered by its estimated probability mass, so the bounds tighten quickly.
+    The evaluation stops when upper - lower < epsilon, the deadline passes or the callback returns False.
+
+    Args:
+        G (networkx.Graph): The graph representation.
+        A_dict (dict): A dictionary mapping nodes to their availability.
+        src (int): The source node index.
+        dst (int): The destination node index.
+        algorithm (str): The algorithm to use for evaluation ('pathset' or 'sdp').
+        parallel (bool): Whether to use parallel evaluation if available.
+        epsilon (float): Stop when the gap between the bounds is below epsilon.
+        deadline (float): Stop after this many seconds, 0 for no deadline.
+        callback (callable): Called with the intermediate bounds dict, returning False stops the evaluation.
+        report_interval (float): Minimal seconds between two callback calls.
+
+    Raises:
+        ValueError: If the specified algorithm does not support the anytime evaluation.
+
+    Returns:
+        dict: The final bounds with the keys src, dst, lower, upper, processed, total, elapsed and converged.
+    """
+    if algorithm not in ('pathset', 'sdp'):
+        raise ValueError(f"Anytime evaluation not available for {algorithm} algorithm. Choose from ['pathset', 'sdp'].")
+
+    # Get algorithm configuration
+    config = ALGORITHM_CONFIG[algorithm]
+    cpp_module = getattr(cpp, config['cpp_module'])
+
+    # Relabel
+    G_relabel, A_dict_relabeled, relabel_mapping = relabel_graph_A_dict(G, A_dict)
+    reverse_mapping = {v: k for k, v in relabel_mapping.items()}
+    src_relabel = relabel_mapping[src]
+    dst_relabel = relabel_mapping[dst]
+
+    # Get problem sets
+    problem_sets = config['problem_set_func'](G_relabel, src_relabel, dst_relabel)
+
+    # Report the intermediate bounds with the original labels
+    relabel_callback = None
+    if callback is not None:
+        relabel_callback = lambda bounds: callback(_relabel_bounds(bounds, reverse_mapping))
+
     # Choose evaluation method
     if parallel:
-        if hasattr(cpp_module, 'eval_avail_topo_parallel'):
-            availability_lst = cpp_module.eval_avail_topo_parallel(
-                node_pairs, A_dict_relabeled, problem_sets_list
-            )
+        if hasattr(cpp_module, 'eval_avail_bounds_parallel'):
+            eval_func = cpp_module.eval_avail_bounds_parallel
         else:
             raise ValueError(f"Parallel evaluation not available for {algorithm} algorithm.")
     else:
-        availability_lst = cpp_module.eval_avail_topo(
-            node_pairs, A_dict_relabeled, problem_sets_list
-        )
-    
+        eval_func = cpp_module.eval_avail_bounds
+
+    bounds = eval_func(
+        src_relabel, dst_relabel, A_dict_relabeled, problem_sets,
+        epsilon=epsilon, deadline=deadline, callback=relabel_callback, report_interval=report_interval
+    )
+    return _relabel_bounds(bounds, reverse_mapping)
+
+def eval_topology_bounds(G, A_dict, algorithm='sdp', parallel=False, epsilon=1e-9, deadline=0.0):
+    """Anytime evaluation of the availability bounds for all pairs of nodes in the topology.
+
+    All pairs share the deadline, the pairs not finished in time keep their intermediate bounds.
+
+    Args:
+        G (networkx.Graph): The graph representation.
+        A_dict (dict): A dictionary mapping nodes to their availability.
+        algorithm (str): The algorithm to use for evaluation ('pathset' or 'sdp').
+        parallel (bool): Whether to evaluate the pairs in parallel.
+        epsilon (float): Stop a pair when the gap between its bounds is below epsilon.
+        deadline (float): Stop all pairs after this many seconds, 0 for no deadline.
+
+    Raises:
+        ValueError: If the specified algorithm does not support the anytime evaluation.
+
+    Returns:
+        List[dict]: The bounds of every pair, see eval_single_pair_bounds().
+    """
+    if algorithm not in ('pathset', 'sdp'):
+        raise ValueError(f"Anytime evaluation not available for {algorithm} algorithm. Choose from ['pathset', 'sdp'].")
+
+    # Get algorithm configuration
+    config = ALGORITHM_CONFIG[algorithm]
+    cpp_module = getattr(cpp, config['cpp_module'])
+
+    # Relabel
+    G_relabel, A_dict_relabeled, relabel_mapping = relabel_graph_A_dict(G, A_dict)
+    reverse_mapping = {v: k for k, v in relabel_mapping.items()}
+
+    # Get all pairs and their problem sets
+    node_pairs = list(combinations(G_relabel.nodes(), 2))
+    problem_sets_list = [
+        config['problem_set_func'](G_relabel, src, dst)
+        for src, dst in node_pairs
+    ]
+
+    eval_func = cpp_module.eval_avail_bounds_topo_parallel if parallel else cpp_module.eval_avail_bounds_topo
+    bounds_list = eval_func(node_pairs, A_dict_relabeled, problem_sets_list, epsilon=epsilon, deadline=deadline)
+
     # Relabel results
-    return [
+    return [_relabel_bounds(bounds, reverse_mapping) for bounds in bounds_list]
+
+def eval_single_pair_truncated(G, A_dict, src, dst, algorithm='sdp', epsilon=1e-9, max_paths=0, stats=False):
+    """Evaluate the availability bounds of a source and destination pair from its most probable path sets only.
+
+    The minimal path sets are enumerated best-first in decreasing order of their probability and the enumeration
+    stops once the paths left out can contribute less than epsilon. The kept path sets give the lower bound and the
+    upper bound adds a rigorous bound of the paths left out.
+
+    Args:
+        G (networkx.Graph): The graph representation.
+        A_dict (dict): A dictionary mapping nodes to their availability.
+        src (int): The source node index.
+        dst (int): The destination node index.
+        algorithm (str): The algorithm evaluating the kept path sets ('mcs', 'pathset' or 'sdp').
+        epsilon (float): Stop the enumeration once the bound of the paths left out is below epsilon.
+        max_paths (int): Stop the enumeration once this many path sets are kept, 0 for no limit.
+        stats (bool): Whether to collect the instrumentation counters of the evaluation.
+
+    Raises:
+        ValueError: If the specified algorithm does not evaluate path sets.
+
+    Returns:
+        dict: The bounds with the keys src, dst, lower, upper, processed (kept path sets), total, elapsed and converged.
+            With stats=True the tuple (bounds_dict, stats_dict) is returned.
+    """
+    if algorithm not in ('mcs', 'pathset', 'sdp'):
+        raise ValueError(f"Truncated evaluation not available for {algorithm} algorithm. Choose from ['mcs', 'pathset', 'sdp'].")
+
+    # Relabel
+    G_relabel, A_dict_relabeled, relabel_mapping = relabel_graph_A_dict(G, A_dict)
+    reverse_mapping = {v: k for k, v in relabel_mapping.items()}
+
+    graph, _, _ = to_native_graph(G_relabel)
+    output = cpp.truncated.eval_avail(
+        graph, relabel_mapping[src], relabel_mapping[dst], A_dict_relabeled, engine=getattr(cpp.selector.Engine, algorithm),
+        epsilon=epsilon, max_paths=max_paths, stats=stats
+    )
+    bounds, pair_stats = output if stats else (output, None)
+    if stats:
+        return _relabel_bounds(bounds, reverse_mapping), _relabel_stats([pair_stats], reverse_mapping)[0]
+    return _relabel_bounds(bounds, reverse_mapping)
+
+def eval_topology_truncated(G, A_dict, algorithm='sdp', epsilon=1e-9, max_paths=0, parallel=True):
+    """Evaluate the availability bounds for all pairs of nodes from their most probable path sets only.
+
+    Args:
+        G (networkx.Graph): The graph representation.
+        A_dict (dict): A dictionary mapping nodes to their availability.
+        algorithm (str): The algorithm evaluating the kept path sets ('mcs', 'pathset' or 'sdp').
+        epsilon (float): Stop the enumeration of a pair once the bound of its paths left out is below epsilon.
+        max_paths (int): Stop the enumeration of a pair once this many path sets are kept, 0 for no limit.
+        parallel (bool): Whether to process the pairs in parallel.
+
+    Raises:
+        ValueError: If the specified algorithm does not evaluate path sets.
+
+    Returns:
+        List[dict]: The bounds of every pair, see eval_single_pair_truncated().
+    """
+    if algorithm not in ('mcs', 'pathset', 'sdp'):
+        raise ValueError(f"Truncated evaluation not available for {algorithm} algorithm. Choose from ['mcs', 'pathset', 'sdp'].")
+
+    # Relabel
+    G_relabel, A_dict_relabeled, relabel_mapping = relabel_graph_A_dict(G, A_dict)
+    reverse_mapping = {v: k for k, v in relabel_mapping.items()}
+    node_pairs = list(combinations(G_relabel.nodes(), 2))
+
+    order = _cut_order(G_relabel, algorithm)
+
+    graph, _, _ = to_native_graph(G_relabel)
+    bounds_list = cpp.truncated.eval_avail_topo(
+        graph, node_pairs, A_dict_relabeled, engine=getattr(cpp.selector.Engine, algorithm), epsilon=epsilon,
+        max_paths=max_paths, order=order, parallel=parallel
+    )
+    return [_relabel_bounds(bounds, reverse_mapping) for bounds in bounds_list]
+
+
+def _relabel_estimate(estimate, reverse_mapping):
+    """Convert the Monte Carlo or importance sampling estimate of the C++ core to a dict with the original node labels."""
+    estimate_dict = estimate.to_dict()
+    estimate_dict['src'] = reverse_mapping[estimate.src]
+    estimate_dict['dst'] = reverse_mapping[estimate.dst]
+    return estimate_dict
+
+def eval_single_pair_montecarlo(G, A_dict, src, dst, samples=1 << 20, target_width=0.0, z=1.96, seed=0, parallel=False):
+    """Estimate the availability of a source and destination pair by Monte Carlo sampling.
+
+    For topologies too large for the exact algorithms. 64 scenarios are sampled at once as bit words and the
+    connectivity of all of them is checked with one bit-parallel BFS. The random streams are counter-based,
+    so the same seed gives the same estimate for any number of threads.
+
+    Args:
+        G (networkx.Graph): The graph representation.
+        A_dict (dict): A dictionary mapping nodes to their availability.
+        src (int): The source node index.
+        dst (int): The destination node index.
+        samples (int): Maximal number of sampled scenarios.
+        target_width (float): Stop once the confidence interval is narrower than this, 0 samples all scenarios.
+        z (float): Standard normal quantile of the confidence level, 1.96 for 95%.
+        seed (int): Seed of the random streams.
+        parallel (bool): Whether to sample in parallel.
+
+    Returns:
+        dict: The estimate with the keys src, dst, availability, lower, upper, samples and converged.
+    """
+    # Relabel
+    G_relabel, A_dict_relabeled, relabel_mapping = relabel_graph_A_dict(G, A_dict)
+    reverse_mapping = {v: k for k, v in relabel_mapping.items()}
+
+    graph, _, _ = to_native_graph(G_relabel)
+    estimate = cpp.montecarlo.estimate_avail(
+        graph, relabel_mapping[src], relabel_mapping[dst], A_dict_relabeled, samples=samples,
+        target_width=target_width, z=z, seed=seed, parallel=parallel
+    )
+    return _relabel_estimate(estimate, reverse_mapping)
+
+def eval_topology_montecarlo(G, A_dict, samples=1 << 20, target_width=0.0, z=1.96, seed=0, parallel=True):
+    """Estimate the availability for all pairs of nodes from the same sampled scenarios.
+
+    One bit-parallel BFS per source and batch of 64 scenarios counts all pairs of the source.
+    A pair stops once its confidence interval is narrower than target_width.
+
+    Args:
+        G (networkx.Graph): The graph representation.
+        A_dict (dict): A dictionary mapping nodes to their availability.
+        samples (int): Maximal number of sampled scenarios.
+        target_width (float): Stop a pair once its confidence interval is narrower than this, 0 samples all scenarios.
+        z (float): Standard normal quantile of the confidence level, 1.96 for 95%.
+        seed (int): Seed of the random streams.
+        parallel (bool): Whether to sample in parallel.
+
+    Returns:
+        List[dict]: The estimate of every pair, see eval_single_pair_montecarlo().
+    """
+    # Relabel
+    G_relabel, A_dict_relabeled, relabel_mapping = relabel_graph_A_dict(G, A_dict)
+    reverse_mapping = {v: k for k, v in relabel_mapping.items()}
+    node_pairs = list(combinations(G_relabel.nodes(), 2))
+
+    graph, _, _ = to_native_graph(G_relabel)
+    estimates = cpp.montecarlo.estimate_avail_topo(
+        graph, node_pairs, A_dict_relabeled, samples=samples, target_width=target_width, z=z, seed=seed,
+        parallel=parallel
+    )
+    return [_relabel_estimate(estimate, reverse_mapping) for estimate in estimates]
+
+def eval_single_pair_importance(G, A_dict, src, dst, samples=1 << 24, relative_error=0.01, z=1.96, seed=0, parallel=False):
+    """Estimate the unavailability of a high-nines source and destination pair by importance sampling.
+
+    Every sample fails the nodes of a minimal cut set chosen by its failure probability and is reweighted,
+    so the estimate keeps a bounded relative error however rare the disconnection is.
+
+    Args:
+        G (networkx.Graph): The graph representation.
+        A_dict (dict): A dictionary mapping nodes to their availability.
+        src (int): The source node index.
+        dst (int): The destination node index.
+        samples (int): Maximal number of sampled scenarios.
+        relative_error (float): Stop once the half-width of the confidence interval divided by the estimate is below this.
+        z (float): Standard normal quantile of the confidence level, 1.96 for 95%.
+        seed (int): Seed of the random streams.
+        parallel (bool): Whether to sample in parallel.
+
+    Returns:
+        dict: The estimate with the keys src, dst, unavailability, lower, upper, rel_error, samples and converged.
+    """
+    # Relabel
+    G_relabel, A_dict_relabeled, relabel_mapping = relabel_graph_A_dict(G, A_dict)
+    reverse_mapping = {v: k for k, v in relabel_mapping.items()}
+    src_relabel = relabel_mapping[src]
+    dst_relabel = relabel_mapping[dst]
+
+    min_cut_sets = minimalcuts_native(G_relabel, src_relabel, dst_relabel)
+    estimate = cpp.montecarlo.estimate_unavail(
+        src_relabel, dst_relabel, A_dict_relabeled, min_cut_sets, samples=samples, relative_error=relative_error,
+        z=z, seed=seed, parallel=parallel
+    )
+    return _relabel_estimate(estimate, reverse_mapping)
+
+def eval_topology_importance(G, A_dict, samples=1 << 24, relative_error=0.01, z=1.96, seed=0, parallel=True):
+    """Estimate the unavailability for all pairs of nodes by importance sampling on their minimal cut sets.
+
+    Args:
+        G (networkx.Graph): The graph representation.
+        A_dict (dict): A dictionary mapping nodes to their availability.
+        samples (int): Maximal number of sampled scenarios per pair.
+        relative_error (float): Stop a pair once its relative error is below this.
+        z (float): Standard normal quantile of the confidence level, 1.96 for 95%.
+        seed (int): Seed of the random streams.
+        parallel (bool): Whether to process the pairs in parallel.
+
+    Returns:
+        List[dict]: The estimate of every pair, see eval_single_pair_importance().
+    """
+    # Relabel
+    G_relabel, A_dict_relabeled, relabel_mapping = relabel_graph_A_dict(G, A_dict)
+    reverse_mapping = {v: k for k, v in relabel_mapping.items()}
+    node_pairs = list(combinations(G_relabel.nodes(), 2))
+
+    min_cut_sets_list = [minimalcuts_native(G_relabel, src, dst) for src, dst in node_pairs]
+    estimates = cpp.montecarlo.estimate_unavail_topo(
+        node_pairs, A_dict_relabeled, min_cut_sets_list, samples=samples, relative_error=relative_error, z=z,
+        seed=seed, parallel=parallel
+    )
+    return [_relabel_estimate(estimate, reverse_mapping) for estimate in estimates]
+
+def eval_reliability(G, A_dict, terminals=None, parallel=False):
+    """Evaluate the probability that all terminal nodes work and are connected (k-terminal reliability).
+
+    The nodes are decided in BFS order and the states of the frontier (the partition of the decided nodes with an
+    undecided neighbor into components) are merged with their probabilities, so the whole terminal set is answered
+    in one computation instead of combining the availability of its pairs.
+
+    Args:
+        G (networkx.Graph): The graph representation.
+        A_dict (dict): A dictionary mapping nodes to their availability.
+        terminals (list, optional): The terminal nodes, None for all nodes (all-terminal reliability).
+        parallel (bool): Whether to expand the large frontier levels in parallel.
+
+    Returns:
+        float: The reliability, equal to the availability of the pair for two terminals.
+    """
+    # Relabel
+    G_relabel, A_dict_relabeled, relabel_mapping = relabel_graph_A_dict(G, A_dict)
+    terminals = list(G.nodes()) if terminals is None else terminals
+
+    graph, _, _ = to_native_graph(G_relabel)
+    info = cpp.kterminal.FrontierInfo()
+    reliability = cpp.kterminal.eval_reliability(
+        graph, [relabel_mapping[node] for node in terminals], A_dict_relabeled, parallel=parallel, info=info
+    )
+    logger.debug(f"Frontier-based k-terminal reliability: {info}")
+    return reliability
+
+def eval_reliability_sets(G, A_dict, terminal_sets, parallel=True):
+    """Evaluate the k-terminal reliability of several terminal sets, see eval_reliability().
+
+    Args:
+        G (networkx.Graph): The graph representation.
+        A_dict (dict): A dictionary mapping nodes to their availability.
+        terminal_sets (list): A list of terminal node lists, None in the list for all nodes.
+        parallel (bool): Whether to process the terminal sets in parallel.
+
+    Returns:
+        List[float]: The reliability of every terminal set in the order of the sets.
+    """
+    # Relabel
+    G_relabel, A_dict_relabeled, relabel_mapping = relabel_graph_A_dict(G, A_dict)
+    terminal_sets = [list(G.nodes()) if terminals is None else terminals for terminals in terminal_sets]
+
+    graph, _, _ = to_native_graph(G_relabel)
+    return cpp.kterminal.eval_reliability_topo(
+        graph, [[relabel_mapping[node] for node in terminals] for terminals in terminal_sets], A_dict_relabeled,
+        parallel=parallel
+    )
+
+def _edge_probabilities(graph, E_dict, reverse_mapping):
+    """Availability of every edge ID of the native graph, the edges missing in E_dict never fail."""
+    edge_probabilities = []
+    for edge in range(graph.size() + 1, graph.size() + graph.num_edges() + 1):
+        u, v = (reverse_mapping[node] for node in graph.edge_ends(edge))
+        edge_probabilities.append(E_dict.get((u, v), E_dict.get((v, u), 1.0)))
+    return edge_probabilities
+
+def eval_single_pair_links(G, A_dict, E_dict, src, dst, algorithm='sdp', stats=False):
+    """Evaluate the availability of a source and destination pair with node and link (edge) failures.
+
+    The edges are components of their own instead of extra nodes of a subdivided graph: the path sets hold the node
+    literals and the literals of the failing edges, and the perfect edges (missing in E_dict or of availability 1)
+    add no literal.
+
+    Args:
+        G (networkx.Graph): The graph representation.
+        A_dict (dict): A dictionary mapping nodes to their availability.
+        E_dict (dict): A dictionary mapping edges (u, v) to their availability, in either direction.
+        src (int): The source node index.
+        dst (int): The destination node index.
+        algorithm (str): The algorithm to use for evaluation ('mcs', 'pathset' or 'sdp').
+        stats (bool): Whether to collect the instrumentation counters of the evaluation.
+
+    Raises:
+        ValueError: If the specified algorithm does not evaluate path sets.
+
+    Returns:
+        float: The availability. With stats=True the tuple (availability, stats_dict) is returned.
+    """
+    if algorithm not in ('mcs', 'pathset', 'sdp'):
+        raise ValueError(f"Link failures not available for {algorithm} algorithm. Choose from ['mcs', 'pathset', 'sdp'].")
+
+    # Relabel
+    G_relabel, A_dict_relabeled, relabel_mapping = relabel_graph_A_dict(G, A_dict)
+    reverse_mapping = {v: k for k, v in relabel_mapping.items()}
+
+    order = _cut_order(G_relabel, algorithm, links=True)
+
+    graph, _, _ = to_native_graph(G_relabel)
+    output = cpp.links.eval_avail(
+        graph, relabel_mapping[src], relabel_mapping[dst], A_dict_relabeled, _edge_probabilities(graph, E_dict, reverse_mapping),
+        engine=getattr(cpp.selector.Engine, algorithm), order=order, stats=stats
+    )
+    availability, pair_stats = output if stats else (output, None)
+    if stats:
+        return availability, _relabel_stats([pair_stats], reverse_mapping)[0]
+    return availability
+
+def eval_topology_links(G, A_dict, E_dict, algorithm='sdp', parallel=True, stats=False):
+    """Evaluate the availability for all pairs of nodes with node and link (edge) failures, see eval_single_pair_links().
+
+    Args:
+        G (networkx.Graph): The graph representation.
+        A_dict (dict): A dictionary mapping nodes to their availability.
+        E_dict (dict): A dictionary mapping edges (u, v) to their availability, in either direction.
+        algorithm (str): The algorithm to use for evaluation ('mcs', 'pathset' or 'sdp').
+        parallel (bool): Whether to process the pairs in parallel.
+        stats (bool): Whether to collect the instrumentation counters of every pair.
+
+    Raises:
+        ValueError: If the specified algorithm does not evaluate path sets.
+
+    Returns:
+        List[tuple]: A list of tuples, each containing (src, dst, availability).
+            With stats=True the tuple (results, stats_dicts) is returned, one stats dict per pair.
+    """
+    if algorithm not in ('mcs', 'pathset', 'sdp'):
+        raise ValueError(f"Link failures not available for {algorithm} algorithm. Choose from ['mcs', 'pathset', 'sdp'].")
+
+    # Relabel
+    G_relabel, A_dict_relabeled, relabel_mapping = relabel_graph_A_dict(G, A_dict)
+    reverse_mapping = {v: k for k, v in relabel_mapping.items()}
+    node_pairs = list(combinations(G_relabel.nodes(), 2))
+
+    order = _cut_order(G_relabel, algorithm, links=True)
+
+    graph, _, _ = to_native_graph(G_relabel)
+    output = cpp.links.eval_avail_topo(
+        graph, node_pairs, A_dict_relabeled, _edge_probabilities(graph, E_dict, reverse_mapping),
+        engine=getattr(cpp.selector.Engine, algorithm), order=order, parallel=parallel, stats=stats
+    )
+    availability_lst, stats_list = output if stats else (output, None)
+    results = [
         (reverse_mapping[src], reverse_mapping[dst], availability)
         for src, dst, availability in availability_lst
     ]
+    if stats:
+        return results, _relabel_stats(stats_list, reverse_mapping)
+    return results
+
+def eval_topology_matrix(G, A_dict, algorithm='sdp', parallel=True):
+    """Evaluate the availability for all pairs of nodes in a single native call.
+
+    Relabelling, path set (and cut set) enumeration and evaluation run in C++ without the GIL,
+    the sets of all pairs are never held in Python.
+
+    Args:
+        G (networkx.Graph): The graph representation.
+        A_dict (dict): A dictionary mapping nodes to their availability.
+        algorithm (str): The algorithm to use for evaluation ('mcs', 'pathset' or 'sdp').
+        parallel (bool): Whether to evaluate the sources in parallel.
+
+    Raises:
+        ValueError: If the specified algorithm is not supported by the native all-pairs evaluation.
+
+    Returns:
+        tuple: (matrix, nodes), matrix[i, j] is the availability between nodes[i] and nodes[j].
+            The diagonal is the availability of the node and disconnected pairs are 0.
+    """
+    if algorithm not in ('mcs', 'pathset', 'sdp'):
+        raise ValueError(f"Native all-pairs evaluation not available for {algorithm} algorithm. Choose from ['mcs', 'pathset', 'sdp'].")
+
+    nodes = list(G.nodes())
+
+    # Integer labels are relabelled in C++, other labels are passed as their position
+    if all(isinstance(node, (int, np.integer)) for node in nodes):
+        labels = nodes
+        edges = np.array(list(G.edges()), dtype=np.int64).reshape(-1, 2)
+    else:
+        index = {node: i for i, node in enumerate(nodes)}
+        labels = list(range(len(nodes)))
+        edges = np.array([(index[u], index[v]) for u, v in G.edges()], dtype=np.int64).reshape(-1, 2)
+    probabilities = np.array([A_dict[node] for node in nodes], dtype=np.float64)
+
+    engine = getattr(cpp.selector.Engine, algorithm)
+    matrix = cpp.allpairs.eval_avail_matrix(edges, probabilities, labels, engine=engine, parallel=parallel)
+    return matrix, nodes
+
+
+class IncrementalTopology:
+    """Keep the availability of all pairs of nodes up to date while the topology is edited.
+
+    Every edit only marks the pairs it can change dirty: removing an edge the pairs with a path set using it,
+    adding an edge the pairs with a simple path through it, and changing an availability the pairs with a path set
+    containing the node. results() refreshes the dirty pairs in parallel and keeps the others. The node set is fixed,
+    the edits use the node labels of G.
+
+    Args:
+        G (networkx.Graph): The initial graph, it is not modified by the edits.
+        A_dict (dict): A dictionary mapping nodes to their availability.
+        algorithm (str): The algorithm to use for evaluation ('mcs', 'pathset' or 'sdp').
+        node_pairs (list, optional): The pairs to keep up to date, None for all pairs of nodes.
+        parallel (bool): Whether to refresh the dirty pairs in parallel.
+
+    Raises:
+        ValueError: If the specified algorithm does not evaluate path sets.
+    """
+
+    def __init__(self, G, A_dict, algorithm='sdp', node_pairs=None, parallel=True):
+        if algorithm not in ('mcs', 'pathset', 'sdp'):
+            raise ValueError(f"Incremental evaluation not available for {algorithm} algorithm. Choose from ['mcs', 'pathset', 'sdp'].")
+
+        # Relabel
+        G_relabel, A_dict_relabeled, self._relabel_mapping = relabel_graph_A_dict(G, A_dict)
+        self._reverse_mapping = {v: k for k, v in self._relabel_mapping.items()}
+        if node_pairs is None:
+            node_pairs = list(combinations(G_relabel.nodes(), 2))
+        else:
+            node_pairs = [(self._relabel_mapping[src], self._relabel_mapping[dst]) for src, dst in node_pairs]
+        self._node_pairs = [(self._reverse_mapping[src], self._reverse_mapping[dst]) for src, dst in node_pairs]
+
+        order = _cut_order(G_relabel, algorithm)
+
+        self._topology = cpp.incremental.IncrementalTopology(
+            G_relabel.number_of_nodes(), list(G_relabel.edges()), A_dict_relabeled, node_pairs,
+            engine=getattr(cpp.selector.Engine, algorithm), order=order, parallel=parallel
+        )
+
+    def add_edge(self, u, v):
+        """Add the edge (u, v), return the number of pairs newly marked dirty."""
+        return self._topology.add_edge(self._relabel_mapping[u], self._relabel_mapping[v])
+
+    def remove_edge(self, u, v):
+        """Remove the edge (u, v), return the number of pairs newly marked dirty."""
+        return self._topology.remove_edge(self._relabel_mapping[u], self._relabel_mapping[v])
+
+    def set_availability(self, node, availability):
+        """Change the availability of a node, return the number of pairs newly marked dirty."""
+        return self._topology.set_availability(self._relabel_mapping[node], availability)
+
+    def dirty_pairs(self):
+        """The pairs refreshed by the next results()."""
+        return [self._node_pairs[i] for i in self._topology.dirty_pairs()]
+
+    def results(self):
+        """Refresh the dirty pairs and return the (src, dst, availability) tuples of all pairs, disconnected pairs are 0."""
+        avail_list = self._topology.evaluate()
+        logger.debug(f"Incremental evaluation: {self._topology.info()}")
+        return [(self._reverse_mapping[src], self._reverse_mapping[dst], avail) for src, dst, avail in avail_list]
@@ -4,14 +4,14 @@ def mcs_to_boolexpr(G, src, dst):
     """Convert a Minimal Cut Set (MCS) to a Boolean expression."""
     return to_boolean_expression(G, src, dst, 'mcs')
 
-def eval_avail_mcs(G, A_dict, src, dst):
+def eval_avail_mcs(G, A_dict, src, dst, stats=False):
     """Evaluate the availability of a Minimal Cut Set (MCS) for a single source-destination pair."""
-    return eval_single_pair(G, A_dict, src, dst, 'mcs')
+    return eval_single_pair(G, A_dict, src, dst, 'mcs', stats=stats)
 
-def eval_avail_topo_mcs(G, A_dict):
+def eval_avail_topo_mcs(G, A_dict, stats=False):
     """Evaluate the availability of a Minimal Cut Set (MCS) for the entire topology."""
-    return eval_topology(G, A_dict, 'mcs')
+    return eval_topology(G, A_dict, 'mcs', stats=stats)
 
-def eval_avail_topo_mcs_parallel(G, A_dict):
+def eval_avail_topo_mcs_parallel(G, A_dict, stats=False):
     """Evaluate the availability of a Minimal Cut Set (MCS) for the entire topology in parallel."""
-    return eval_topology(G, A_dict, 'mcs', parallel=True)
\ No newline at end of file
+    return eval_topology(G, A_dict, 'mcs', parallel=True, stats=stats)
\ No newline at end of file
@@ -4,14 +4,14 @@ def pathset_to_boolexpr(G, src, dst):
     """Convert a pathset to a Boolean expression."""
     return to_boolean_expression(G, src, dst, 'pathset')
 
-def eval_avail_pathset(G, A_dict, src, dst):
+def eval_avail_pathset(G, A_dict, src, dst, stats=False):
     """Evaluate the availability of a pathset for a single source-destination pair."""
-    return eval_single_pair(G, A_dict, src, dst, 'pathset')
+    return eval_single_pair(G, A_dict, src, dst, 'pathset', stats=stats)
 
-def eval_avail_topo_pathset(G, A_dict):
+def eval_avail_topo_pathset(G, A_dict, stats=False):
     """Evaluate the availability of a pathset for the entire topology."""
-    return eval_topology(G, A_dict, 'pathset')
+    return eval_topology(G, A_dict, 'pathset', stats=stats)
 
-def eval_avail_topo_pathset_parallel(G, A_dict):
+def eval_avail_topo_pathset_parallel(G, A_dict, stats=False):
     """Evaluate the availability of a pathset for the entire topology in parallel."""
-    return eval_topology(G, A_dict, 'pathset', parallel=True)
+    return eval_topology(G, A_dict, 'pathset', parallel=True, stats=stats)
@@ -1,9 +1,12 @@
-from .cutsets import minimalcuts, minimalcuts_optimized
-from .pathsets import minimalpaths
+from .cutsets import minimalcuts, minimalcuts_optimized, minimalcuts_native
+from .pathsets import minimalpaths, minimalpaths_native, boundedpaths_native, to_native_graph
 
 
 __all__ = [
     "minimalcuts",
     "minimalcuts_optimized",
+    "minimalcuts_native",
     "minimalpaths",
+    "minimalpaths_native",
+    "boundedpaths_native",
 ]
\ No newline at end of file
@@ -2,7 +2,8 @@ import networkx as nx
 from itertools import combinations, islice
 import numpy as np
 import math
-from .pathsets import minimalpaths
+from .pathsets import minimalpaths_native, to_native_graph
+import pyrbd_plusplus._core.pyrbd_plusplus_cpp as cpp
 
 
 def successpaths(H, source, target, weight="weight"):
@@ -90,7 +91,7 @@ def minimalcuts_optimized(H, src_, dst_, order=None):
         # this method is slower than the one below
         # paths = successpaths(H, src_, dst_)
         # paths = remove_unnecessary_loops(paths, H)
-        paths = minimalpaths(H, src_, dst_)
+        paths = minimalpaths_native(H, src_, dst_)
     
         # get all nodes in the graph except source and destination
         nodes = np.array(H.nodes)
@@ -232,3 +233,30 @@ def minimalcuts_optimized(H, src_, dst_, order=None):
     minimal.insert(0, [src_])
 
     return minimal
+
+
+# Native version of minimalcuts_optimized(), same minimal cut sets in the same order
+def minimalcuts_native(H, src_, dst_, order=None, parallel=False):
+    # set the order of the minimal cut set, can be modified here
+    if order is None:
+        order = math.ceil(len(H.nodes) / 2)
+
+    # enumerate the path sets and the minimal hitting sets on the native node IDs
+    graph, nodes, index = to_native_graph(H)
+    paths = cpp.enumeration.minimal_paths(graph, index[src_], index[dst_])
+    if not paths:
+        raise nx.NetworkXNoPath(f"No path between {src_} and {dst_}.")
+    cut_func = cpp.mcs.minimal_cuts_parallel if parallel else cpp.mcs.minimal_cuts
+    cuts = cut_func(paths, index[src_], index[dst_], order)
+
+    # relabel the cut sets, the first two are the source and destination
+    minimal = [[nodes[i - 1] for i in cut] for cut in cuts[2:]]
+
+    # sort the minimal cut sets by length and lexicographically
+    minimal = sorted(minimal, key=lambda x: (len(x), x))
+
+    # add source and destination to the minimal cut sets
+    minimal.insert(0, [dst_])
+    minimal.insert(0, [src_])
+
+    return minimal
@@ -1,4 +1,5 @@
 import networkx as nx
+import pyrbd_plusplus._core.pyrbd_plusplus_cpp as cpp
 
 # Function to get nodes that should not be visited again
 def get_dontgo(G, visited):
@@ -31,4 +32,33 @@ def all_simple_paths(G, source, target):
                 
 # Function to get all minimal paths between source and destination
 def minimalpaths(G, src, dst):
-    return list(all_simple_paths(G, src, dst))
\ No newline at end of file
+    return list(all_simple_paths(G, src, dst))
+
+
+# Function to build the CSR graph of the C++ core, the nodes are indexed 1..n in the order of G.nodes()
+def to_native_graph(G, weight=None):
+    nodes = list(G.nodes())
+    index = {node: i + 1 for i, node in enumerate(nodes)}
+    adjacency = [[]] + [[index[neighbor] for neighbor in G[node]] for node in nodes]
+    if weight is None:
+        return cpp.enumeration.Graph(adjacency), nodes, index
+
+    # Edge lengths for the length-bounded enumeration, edges without the attribute have the length 1
+    lengths = [[]] + [[G[node][neighbor].get(weight, 1.0) for neighbor in G[node]] for node in nodes]
+    return cpp.enumeration.Graph(adjacency, lengths), nodes, index
+
+
+# Native version of minimalpaths(), same path sets in the same order
+def minimalpaths_native(G, src, dst, parallel=False):
+    graph, nodes, index = to_native_graph(G)
+    enumerate_func = cpp.enumeration.minimal_paths_parallel if parallel else cpp.enumeration.minimal_paths
+    paths = enumerate_func(graph, index[src], index[dst])
+    return [[nodes[i - 1] for i in path] for path in paths]
+
+
+# Minimal path sets within at most max_hops edges or a total edge length of max_length, 0 disables a limit
+def boundedpaths_native(G, src, dst, max_hops=0, max_length=0.0, weight='weight'):
+    graph, nodes, index = to_native_graph(G, weight if max_length else None)
+    bound = cpp.enumeration.PathBound(max_hops=max_hops, max_length=max_length)
+    paths = cpp.enumeration.bounded_paths(graph, index[src], index[dst], bound)
+    return [[nodes[i - 1] for i in path] for path in paths]
\ No newline at end of file
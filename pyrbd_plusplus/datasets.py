@@ -6,7 +6,7 @@ from itertools import combinations
 from tqdm import tqdm
 import numpy as np
 
-from .algorithms.sets import minimalcuts_optimized, minimalpaths
+from .algorithms.sets import minimalcuts_optimized, minimalpaths_native
 from .utils import relabel_boolexpr_to_str, sdp_boolexpr_to_str, sdp_boolexpr_length
 
 
@@ -122,7 +122,7 @@ def save_pathset(directory, top):
 
     # Iterate through each pair of nodes and find the simple paths
     for src, dst in tqdm(node_pairs, desc=f"Saving Pathsets for {top}", leave=False):
-        pathset = minimalpaths(G, src, dst)
+        pathset = minimalpaths_native(G, src, dst)
         if pathset:
             # Sort paths by length and for the same length, sort by lexicographical order
             pathset = sorted(pathset, key=lambda x: (len(x), x))
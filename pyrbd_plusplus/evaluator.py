@@ -16,7 +16,8 @@ def evaluate_availability(
         nodes_probabilities (dict): A dictionary mapping node IDs to their availability probabilities.
         src (int, optional): The source node ID. Defaults to None.
         dst (int, optional): The destination node ID. Defaults to None.
-        algorithm (str, optional): The algorithm to use for evaluation. Defaults to 'sdp'. Can be 'mcs', 'pathset', 'sdp', or 'pyrbd'.
+        algorithm (str, optional): The algorithm to use for evaluation. Defaults to 'sdp'. Can be 'mcs', 'pathset', 'sdp', 'auto' or 'pyrbd'.
+            'auto' selects the predicted fastest engine per pair and also returns the selected engine.
         parallel (bool, optional): Whether to evaluate in parallel. Defaults to False.
     """
     # Read the graph from the specified directory and topology